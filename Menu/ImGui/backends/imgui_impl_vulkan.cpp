@@ -5,6 +5,9 @@
 //  [!] Renderer: User texture binding. Use 'VkDescriptorSet' as ImTextureID. Read the FAQ about ImTextureID! See https://github.com/ocornut/imgui/pull/914 for discussions.
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
 //  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Optional quad instances (ImDrawQuad) for glyphs and axis-aligned rectangles, expanded in a dedicated vertex shader, see ImGui_ImplVulkan_InitInfo::UseQuadInstances.
+//  [X] Renderer: Optional shape instances (ImDrawQuadKind_Shape) for rounded rectangles, circles and borders, evaluated as a signed distance field in a dedicated fragment shader, see ImGui_ImplVulkan_InitInfo::UseShapeInstances.
+//  [X] Renderer: Optional upload arena (ImDrawUploadArena) where draw lists directly store vertices/indices, see ImGui_ImplVulkan_InitInfo::UploadArenaSize.
 
 // The aim of imgui_impl_vulkan.h/.cpp is to be usable in your engine without any modification.
 // IF YOU FEEL YOU NEED TO MAKE ANY CHANGE TO THIS CODE, please share them and your feedback at https://github.com/ocornut/imgui/
@@ -26,6 +29,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Vulkan: Added optional support for ImGuiBackendFlags_RendererHasUploadArena with ImGui_ImplVulkan_InitInfo::UploadArenaSize: draw lists stored in the persistently mapped arena are rendered without copying their vertices/indices.
+//  2026-10-19: Vulkan: Added optional support for ImGuiBackendFlags_RendererHasShapeInstances with ImGui_ImplVulkan_InitInfo::UseShapeInstances: ImDrawCmd with QuadInstances == ImDrawQuadKind_Shape are drawn with a third pipeline computing coverage from the shape distance field.
+//  2026-10-19: Vulkan: Added optional support for ImGuiBackendFlags_RendererHasQuadInstances with ImGui_ImplVulkan_InitInfo::UseQuadInstances: ImDrawCmd with QuadInstances != 0 are drawn with a second pipeline expanding one ImDrawQuad instance into a 4 vertices triangle strip.
 //  2024-10-07: Vulkan: Changed default texture sampler to Clamp instead of Repeat/Wrap.
 //  2024-10-07: Vulkan: Expose selected render state in ImGui_ImplVulkan_RenderState, which you can access in 'void* platform_io.Renderer_RenderState' during draw callbacks.
 //  2024-10-07: Vulkan: Compiling with '#define ImTextureID=ImU64' is unnecessary now that dear imgui defaults ImTextureID to u64 instead of void*.
@@ -124,6 +130,7 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdBindPipeline) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdBindVertexBuffers) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdCopyBufferToImage) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDraw) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDrawIndexed) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPipelineBarrier) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPushConstants) \
@@ -195,10 +202,13 @@ struct ImGui_ImplVulkan_FrameRenderBuffers
 {
     VkDeviceMemory      VertexBufferMemory;
     VkDeviceMemory      IndexBufferMemory;
+    VkDeviceMemory      QuadBufferMemory;
     VkDeviceSize        VertexBufferSize;
     VkDeviceSize        IndexBufferSize;
+    VkDeviceSize        QuadBufferSize;
     VkBuffer            VertexBuffer;
     VkBuffer            IndexBuffer;
+    VkBuffer            QuadBuffer;
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -219,8 +229,13 @@ struct ImGui_ImplVulkan_Data
     VkDescriptorSetLayout       DescriptorSetLayout;
     VkPipelineLayout            PipelineLayout;
     VkPipeline                  Pipeline;
+    VkPipeline                  PipelineQuad;           // For ImDrawCmd with QuadInstances == ImDrawQuadKind_Textured
+    VkPipeline                  PipelineShape;          // For ImDrawCmd with QuadInstances == ImDrawQuadKind_Shape
     VkShaderModule              ShaderModuleVert;
+    VkShaderModule              ShaderModuleVertQuad;
+    VkShaderModule              ShaderModuleVertShape;
     VkShaderModule              ShaderModuleFrag;
+    VkShaderModule              ShaderModuleFragShape;
 
     // Font data
     VkSampler                   FontSampler;
@@ -234,6 +249,14 @@ struct ImGui_ImplVulkan_Data
     // Render buffers for main window
     ImGui_ImplVulkan_WindowRenderBuffers MainWindowRenderBuffers;
 
+    // Upload arena (optional, see ImGui_ImplVulkan_InitInfo::UploadArenaSize). One region of UploadArenaFrameSize bytes per in-flight frame.
+    VkBuffer                    UploadArenaBuffer;
+    VkDeviceMemory              UploadArenaMemory;
+    VkDeviceSize                UploadArenaFrameSize;
+    uint32_t                    UploadArenaFrameCount;  // Number of regions, == ImageCount when the arena was created
+    bool                        UploadArenaNeedFlush;   // Memory is not host coherent
+    ImDrawUploadArena           UploadArena;
+
     ImGui_ImplVulkan_Data()
     {
         memset((void*)this, 0, sizeof(*this));
@@ -309,6 +332,78 @@ static uint32_t __glsl_shader_vert_spv[] =
     0x0000002d,0x0000002c,0x000100fd,0x00010038
 };
 
+// backends/vulkan/glsl_shader_quad.vert, to be compiled with:
+// # glslangValidator -V -x -o glsl_shader_quad.vert.u32 glsl_shader_quad.vert
+// FIXME: This array was assembled by hand from the source below, not by glslangValidator. Regenerate it with backends/vulkan/generate_spv.sh.
+/*
+#version 450 core
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in uvec2 aSize;
+layout(location = 2) in vec4 aUV;
+layout(location = 3) in vec4 aColor;
+layout(push_constant) uniform uPushConstant { vec2 uScale; vec2 uTranslate; } pc;
+
+out gl_PerVertex { vec4 gl_Position; };
+layout(location = 0) out struct { vec4 Color; vec2 UV; } Out;
+
+void main()
+{
+    vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+    Out.Color = aColor;
+    Out.UV = mix(aUV.xy, aUV.zw, corner);
+    gl_Position = vec4((aPos + vec2(aSize) * (1.0 / 16.0) * corner) * pc.uScale + pc.uTranslate, 0, 1);
+}
+*/
+static uint32_t __glsl_shader_quad_vert_spv[] =
+{
+    0x07230203,0x00010000,0x00000000,0x00000059,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x000c000f,0x00000000,0x00000004,0x6e69616d,0x00000000,0x0000000b,0x0000000f,0x00000010,
+    0x00000015,0x0000001b,0x00000035,0x00000037,0x00040047,0x0000000b,0x0000001e,0x00000000,
+    0x00040047,0x0000000f,0x0000001e,0x00000003,0x00040047,0x00000010,0x0000001e,0x00000002,
+    0x00040047,0x00000015,0x0000001e,0x00000000,0x00040047,0x00000035,0x0000001e,0x00000001,
+    0x00040047,0x00000037,0x0000000b,0x0000002a,0x00050048,0x00000019,0x00000000,0x0000000b,
+    0x00000000,0x00030047,0x00000019,0x00000002,0x00050048,0x0000001e,0x00000000,0x00000023,
+    0x00000000,0x00050048,0x0000001e,0x00000001,0x00000023,0x00000008,0x00030047,0x0000001e,
+    0x00000002,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,
+    0x00000020,0x00040017,0x00000007,0x00000006,0x00000004,0x00040017,0x00000008,0x00000006,
+    0x00000002,0x0004001e,0x00000009,0x00000007,0x00000008,0x00040020,0x0000000a,0x00000003,
+    0x00000009,0x0004003b,0x0000000a,0x0000000b,0x00000003,0x00040015,0x0000000c,0x00000020,
+    0x00000001,0x0004002b,0x0000000c,0x0000000d,0x00000000,0x00040020,0x0000000e,0x00000001,
+    0x00000007,0x0004003b,0x0000000e,0x0000000f,0x00000001,0x0004003b,0x0000000e,0x00000010,
+    0x00000001,0x00040020,0x00000011,0x00000003,0x00000007,0x0004002b,0x0000000c,0x00000013,
+    0x00000001,0x00040020,0x00000014,0x00000001,0x00000008,0x0004003b,0x00000014,0x00000015,
+    0x00000001,0x00040020,0x00000017,0x00000003,0x00000008,0x0003001e,0x00000019,0x00000007,
+    0x00040020,0x0000001a,0x00000003,0x00000019,0x0004003b,0x0000001a,0x0000001b,0x00000003,
+    0x0004001e,0x0000001e,0x00000008,0x00000008,0x00040020,0x0000001f,0x00000009,0x0000001e,
+    0x0004003b,0x0000001f,0x00000020,0x00000009,0x00040020,0x00000021,0x00000009,0x00000008,
+    0x0004002b,0x00000006,0x00000028,0x00000000,0x0004002b,0x00000006,0x00000029,0x3f800000,
+    0x00040015,0x00000032,0x00000020,0x00000000,0x00040017,0x00000033,0x00000032,0x00000002,
+    0x00040020,0x00000034,0x00000001,0x00000033,0x0004003b,0x00000034,0x00000035,0x00000001,
+    0x00040020,0x00000036,0x00000001,0x0000000c,0x0004003b,0x00000036,0x00000037,0x00000001,
+    0x0004002b,0x00000006,0x00000038,0x3d800000,0x00050036,0x00000002,0x00000004,0x00000000,
+    0x00000003,0x000200f8,0x00000005,0x0004003d,0x0000000c,0x0000003c,0x00000037,0x000500c7,
+    0x0000000c,0x0000003d,0x0000003c,0x00000013,0x000500c3,0x0000000c,0x0000003e,0x0000003c,
+    0x00000013,0x0004006f,0x00000006,0x0000003f,0x0000003d,0x0004006f,0x00000006,0x00000040,
+    0x0000003e,0x00050050,0x00000008,0x00000041,0x0000003f,0x00000040,0x0004003d,0x00000007,
+    0x00000042,0x0000000f,0x00050041,0x00000011,0x00000043,0x0000000b,0x0000000d,0x0003003e,
+    0x00000043,0x00000042,0x0004003d,0x00000007,0x00000044,0x00000010,0x0007004f,0x00000008,
+    0x00000045,0x00000044,0x00000044,0x00000000,0x00000001,0x0007004f,0x00000008,0x00000046,
+    0x00000044,0x00000044,0x00000002,0x00000003,0x0008000c,0x00000008,0x00000047,0x00000001,
+    0x0000002e,0x00000045,0x00000046,0x00000041,0x00050041,0x00000017,0x00000048,0x0000000b,
+    0x00000013,0x0003003e,0x00000048,0x00000047,0x0004003d,0x00000008,0x00000049,0x00000015,
+    0x0004003d,0x00000033,0x0000004a,0x00000035,0x00040070,0x00000008,0x0000004b,0x0000004a,
+    0x0005008e,0x00000008,0x0000004c,0x0000004b,0x00000038,0x00050085,0x00000008,0x0000004d,
+    0x0000004c,0x00000041,0x00050081,0x00000008,0x0000004e,0x00000049,0x0000004d,0x00050041,
+    0x00000021,0x0000004f,0x00000020,0x0000000d,0x0004003d,0x00000008,0x00000050,0x0000004f,
+    0x00050085,0x00000008,0x00000051,0x0000004e,0x00000050,0x00050041,0x00000021,0x00000052,
+    0x00000020,0x00000013,0x0004003d,0x00000008,0x00000053,0x00000052,0x00050081,0x00000008,
+    0x00000054,0x00000051,0x00000053,0x00050051,0x00000006,0x00000055,0x00000054,0x00000000,
+    0x00050051,0x00000006,0x00000056,0x00000054,0x00000001,0x00070050,0x00000007,0x00000057,
+    0x00000055,0x00000056,0x00000028,0x00000029,0x00050041,0x00000011,0x00000058,0x0000001b,
+    0x0000000d,0x0003003e,0x00000058,0x00000057,0x000100fd,0x00010038
+};
+
 // backends/vulkan/glsl_shader.frag, compiled with:
 // # glslangValidator -V -x -o glsl_shader.frag.u32 glsl_shader.frag
 /*
@@ -350,6 +445,200 @@ static uint32_t __glsl_shader_frag_spv[] =
     0x00010038
 };
 
+// backends/vulkan/glsl_shader_shape.vert, to be compiled with:
+// # glslangValidator -V -x -o glsl_shader_shape.vert.u32 glsl_shader_shape.vert
+// FIXME: This array was assembled by hand from the source below, not by glslangValidator. Regenerate it with backends/vulkan/generate_spv.sh.
+/*
+#version 450 core
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in uvec2 aSize;
+layout(location = 2) in uvec4 aParams;
+layout(location = 3) in vec4 aColor;
+
+layout(push_constant) uniform uPushConstant {
+    vec2 uScale;
+    vec2 uTranslate;
+} pc;
+
+out gl_PerVertex {
+    vec4 gl_Position;
+};
+
+layout(location = 0) out vec4 Color;
+layout(location = 1) out vec2 Pos;
+layout(location = 2) flat out vec2 HalfSize;
+layout(location = 3) flat out vec4 Radii;
+layout(location = 4) flat out vec3 Stroke;
+
+// One ImDrawQuadKind_Shape instance expanded to a 4 vertices triangle strip.
+// aParams = (rounding, thickness, corners mask | 0x10 if anti-aliased, inset), lengths in 1/16th of a pixel.
+void main()
+{
+    vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+    vec2 size = vec2(aSize) * (1.0 / 16.0);
+    Color = aColor;
+    Pos = (corner - 0.5) * size;
+    HalfSize = size * 0.5 - float(aParams.w) * (1.0 / 16.0);
+    Radii = vec4((uvec4(aParams.z) >> uvec4(0, 1, 2, 3)) & 1u) * (float(aParams.x) * (1.0 / 16.0));
+    Stroke = vec3(aParams.y != 0u ? 1.0 : 0.0, float(aParams.y) * (1.0 / 32.0), (aParams.z & 16u) != 0u ? 1.0 : 65536.0);
+    gl_Position = vec4((aPos + size * corner) * pc.uScale + pc.uTranslate, 0, 1);
+}
+*/
+static uint32_t __glsl_shader_shape_vert_spv[] =
+{
+    0x07230203,0x00010000,0x00000000,0x0000006a,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x0010000f,0x00000000,0x00000066,0x6e69616d,0x00000000,0x0000000a,0x0000000c,0x0000000e,
+    0x00000010,0x00000012,0x00000014,0x00000016,0x00000018,0x00000019,0x0000001a,0x0000001d,
+    0x00040047,0x0000000a,0x0000001e,0x00000000,0x00040047,0x0000000c,0x0000001e,0x00000001,
+    0x00040047,0x0000000e,0x0000001e,0x00000002,0x00040047,0x00000010,0x0000001e,0x00000003,
+    0x00040047,0x00000014,0x0000001e,0x00000000,0x00040047,0x00000016,0x0000001e,0x00000001,
+    0x00040047,0x00000018,0x0000001e,0x00000002,0x00040047,0x00000019,0x0000001e,0x00000003,
+    0x00040047,0x0000001a,0x0000001e,0x00000004,0x00030047,0x00000018,0x0000000e,0x00030047,
+    0x00000019,0x0000000e,0x00030047,0x0000001a,0x0000000e,0x00040047,0x00000012,0x0000000b,
+    0x0000002a,0x00050048,0x0000001c,0x00000000,0x0000000b,0x00000000,0x00030047,0x0000001c,
+    0x00000002,0x00050048,0x0000001f,0x00000000,0x00000023,0x00000000,0x00050048,0x0000001f,
+    0x00000001,0x00000023,0x00000008,0x00030047,0x0000001f,0x00000002,0x00030016,0x00000002,
+    0x00000020,0x00040015,0x00000003,0x00000020,0x00000001,0x00040015,0x00000004,0x00000020,
+    0x00000000,0x00040017,0x00000005,0x00000002,0x00000002,0x00040017,0x00000006,0x00000002,
+    0x00000003,0x00040017,0x00000007,0x00000002,0x00000004,0x00040017,0x00000008,0x00000004,
+    0x00000002,0x00040017,0x00000009,0x00000004,0x00000004,0x00040020,0x0000000b,0x00000001,
+    0x00000005,0x0004003b,0x0000000b,0x0000000a,0x00000001,0x00040020,0x0000000d,0x00000001,
+    0x00000008,0x0004003b,0x0000000d,0x0000000c,0x00000001,0x00040020,0x0000000f,0x00000001,
+    0x00000009,0x0004003b,0x0000000f,0x0000000e,0x00000001,0x00040020,0x00000011,0x00000001,
+    0x00000007,0x0004003b,0x00000011,0x00000010,0x00000001,0x00040020,0x00000013,0x00000001,
+    0x00000003,0x0004003b,0x00000013,0x00000012,0x00000001,0x00040020,0x00000015,0x00000003,
+    0x00000007,0x0004003b,0x00000015,0x00000014,0x00000003,0x00040020,0x00000017,0x00000003,
+    0x00000005,0x0004003b,0x00000017,0x00000016,0x00000003,0x0004003b,0x00000017,0x00000018,
+    0x00000003,0x0004003b,0x00000015,0x00000019,0x00000003,0x00040020,0x0000001b,0x00000003,
+    0x00000006,0x0004003b,0x0000001b,0x0000001a,0x00000003,0x0003001e,0x0000001c,0x00000007,
+    0x00040020,0x0000001e,0x00000003,0x0000001c,0x0004003b,0x0000001e,0x0000001d,0x00000003,
+    0x0004001e,0x0000001f,0x00000005,0x00000005,0x00040020,0x00000021,0x00000009,0x0000001f,
+    0x0004003b,0x00000021,0x00000020,0x00000009,0x0004002b,0x00000002,0x00000022,0x3d800000,
+    0x0004002b,0x00000002,0x00000023,0x3d000000,0x0004002b,0x00000002,0x00000024,0x3f000000,
+    0x0004002b,0x00000002,0x00000025,0x00000000,0x0004002b,0x00000002,0x00000026,0x3f800000,
+    0x0004002b,0x00000002,0x00000027,0x47800000,0x0004002b,0x00000003,0x00000028,0x00000000,
+    0x0004002b,0x00000003,0x00000029,0x00000001,0x0004002b,0x00000004,0x0000002a,0x00000000,
+    0x0004002b,0x00000004,0x0000002b,0x00000001,0x0004002b,0x00000004,0x0000002c,0x00000002,
+    0x0004002b,0x00000004,0x0000002d,0x00000003,0x0004002b,0x00000004,0x0000002e,0x00000010,
+    0x00020014,0x0000002f,0x0007002c,0x00000009,0x00000048,0x0000002a,0x0000002b,0x0000002c,
+    0x0000002d,0x0007002c,0x00000009,0x0000004a,0x0000002b,0x0000002b,0x0000002b,0x0000002b,
+    0x00040020,0x0000005b,0x00000009,0x00000005,0x00020013,0x00000067,0x00030021,0x00000068,
+    0x00000067,0x00050036,0x00000067,0x00000066,0x00000000,0x00000068,0x000200f8,0x00000069,
+    0x0004003d,0x00000003,0x00000030,0x00000012,0x000500c7,0x00000003,0x00000031,0x00000030,
+    0x00000029,0x0004006f,0x00000002,0x00000032,0x00000031,0x000500c3,0x00000003,0x00000033,
+    0x00000030,0x00000029,0x0004006f,0x00000002,0x00000034,0x00000033,0x00050050,0x00000005,
+    0x00000035,0x00000032,0x00000034,0x0004003d,0x00000008,0x00000036,0x0000000c,0x00040070,
+    0x00000005,0x00000037,0x00000036,0x0005008e,0x00000005,0x00000038,0x00000037,0x00000022,
+    0x0004003d,0x00000007,0x00000039,0x00000010,0x0003003e,0x00000014,0x00000039,0x00050050,
+    0x00000005,0x0000003a,0x00000024,0x00000024,0x00050083,0x00000005,0x0000003b,0x00000035,
+    0x0000003a,0x00050085,0x00000005,0x0000003c,0x0000003b,0x00000038,0x0003003e,0x00000016,
+    0x0000003c,0x0004003d,0x00000009,0x0000003d,0x0000000e,0x00050051,0x00000004,0x0000003e,
+    0x0000003d,0x00000000,0x00050051,0x00000004,0x0000003f,0x0000003d,0x00000001,0x00050051,
+    0x00000004,0x00000040,0x0000003d,0x00000002,0x00050051,0x00000004,0x00000041,0x0000003d,
+    0x00000003,0x00040070,0x00000002,0x00000042,0x00000041,0x00050085,0x00000002,0x00000043,
+    0x00000042,0x00000022,0x0005008e,0x00000005,0x00000044,0x00000038,0x00000024,0x00050050,
+    0x00000005,0x00000045,0x00000043,0x00000043,0x00050083,0x00000005,0x00000046,0x00000044,
+    0x00000045,0x0003003e,0x00000018,0x00000046,0x00070050,0x00000009,0x00000047,0x00000040,
+    0x00000040,0x00000040,0x00000040,0x000500c2,0x00000009,0x00000049,0x00000047,0x00000048,
+    0x000500c7,0x00000009,0x0000004b,0x00000049,0x0000004a,0x00040070,0x00000002,0x0000004c,
+    0x0000003e,0x00050085,0x00000002,0x0000004d,0x0000004c,0x00000022,0x00040070,0x00000007,
+    0x0000004e,0x0000004b,0x0005008e,0x00000007,0x0000004f,0x0000004e,0x0000004d,0x0003003e,
+    0x00000019,0x0000004f,0x000500ab,0x0000002f,0x00000050,0x0000003f,0x0000002a,0x000600a9,
+    0x00000002,0x00000051,0x00000050,0x00000026,0x00000025,0x00040070,0x00000002,0x00000052,
+    0x0000003f,0x00050085,0x00000002,0x00000053,0x00000052,0x00000023,0x000500c7,0x00000004,
+    0x00000054,0x00000040,0x0000002e,0x000500ab,0x0000002f,0x00000055,0x00000054,0x0000002a,
+    0x000600a9,0x00000002,0x00000056,0x00000055,0x00000026,0x00000027,0x00060050,0x00000006,
+    0x00000057,0x00000051,0x00000053,0x00000056,0x0003003e,0x0000001a,0x00000057,0x0004003d,
+    0x00000005,0x00000058,0x0000000a,0x00050085,0x00000005,0x00000059,0x00000038,0x00000035,
+    0x00050081,0x00000005,0x0000005a,0x00000058,0x00000059,0x00050041,0x0000005b,0x0000005c,
+    0x00000020,0x00000028,0x0004003d,0x00000005,0x0000005d,0x0000005c,0x00050041,0x0000005b,
+    0x0000005e,0x00000020,0x00000029,0x0004003d,0x00000005,0x0000005f,0x0000005e,0x00050085,
+    0x00000005,0x00000060,0x0000005a,0x0000005d,0x00050081,0x00000005,0x00000061,0x00000060,
+    0x0000005f,0x00050051,0x00000002,0x00000062,0x00000061,0x00000000,0x00050051,0x00000002,
+    0x00000063,0x00000061,0x00000001,0x00070050,0x00000007,0x00000064,0x00000062,0x00000063,
+    0x00000025,0x00000026,0x00050041,0x00000015,0x00000065,0x0000001d,0x00000028,0x0003003e,
+    0x00000065,0x00000064,0x000100fd,0x00010038
+};
+
+// backends/vulkan/glsl_shader_shape.frag, to be compiled with:
+// # glslangValidator -V -x -o glsl_shader_shape.frag.u32 glsl_shader_shape.frag
+// FIXME: This array was assembled by hand from the source below, not by glslangValidator. Regenerate it with backends/vulkan/generate_spv.sh.
+/*
+#version 450 core
+layout(location = 0) out vec4 fColor;
+
+layout(location = 0) in vec4 Color;
+layout(location = 1) in vec2 Pos;
+layout(location = 2) flat in vec2 HalfSize;
+layout(location = 3) flat in vec4 Radii;
+layout(location = 4) flat in vec3 Stroke;
+
+// Signed distance to a rounded rectangle (per-corner radius, square corners when radius is 0), turned into coverage.
+// Filled shapes fade over [-0.5,+0.5] pixel around the edge, borders over the same distance around each side of the stroke.
+void main()
+{
+    float r = Pos.y > 0.0 ? (Pos.x > 0.0 ? Radii.w : Radii.z) : (Pos.x > 0.0 ? Radii.y : Radii.x);
+    vec2 q = abs(Pos) - HalfSize + r;
+    float d = r > 0.0 ? min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - r : max(q.x, q.y);
+    d = mix(d, abs(d) - Stroke.y, Stroke.x);
+    fColor = vec4(Color.rgb, Color.a * clamp(0.5 - d * Stroke.z, 0.0, 1.0));
+}
+*/
+static uint32_t __glsl_shader_shape_frag_spv[] =
+{
+    0x07230203,0x00010000,0x00000000,0x00000046,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x000b000f,0x00000004,0x00000042,0x6e69616d,0x00000000,0x00000007,0x00000009,0x0000000b,
+    0x0000000d,0x0000000e,0x0000000f,0x00030010,0x00000042,0x00000007,0x00040047,0x00000007,
+    0x0000001e,0x00000000,0x00040047,0x00000009,0x0000001e,0x00000000,0x00040047,0x0000000b,
+    0x0000001e,0x00000001,0x00040047,0x0000000d,0x0000001e,0x00000002,0x00040047,0x0000000e,
+    0x0000001e,0x00000003,0x00040047,0x0000000f,0x0000001e,0x00000004,0x00030047,0x0000000d,
+    0x0000000e,0x00030047,0x0000000e,0x0000000e,0x00030047,0x0000000f,0x0000000e,0x00030016,
+    0x00000002,0x00000020,0x00040017,0x00000003,0x00000002,0x00000002,0x00040017,0x00000004,
+    0x00000002,0x00000003,0x00040017,0x00000005,0x00000002,0x00000004,0x00020014,0x00000006,
+    0x00040020,0x00000008,0x00000003,0x00000005,0x0004003b,0x00000008,0x00000007,0x00000003,
+    0x00040020,0x0000000a,0x00000001,0x00000005,0x0004003b,0x0000000a,0x00000009,0x00000001,
+    0x00040020,0x0000000c,0x00000001,0x00000003,0x0004003b,0x0000000c,0x0000000b,0x00000001,
+    0x0004003b,0x0000000c,0x0000000d,0x00000001,0x0004003b,0x0000000a,0x0000000e,0x00000001,
+    0x00040020,0x00000010,0x00000001,0x00000004,0x0004003b,0x00000010,0x0000000f,0x00000001,
+    0x0004002b,0x00000002,0x00000011,0x00000000,0x0004002b,0x00000002,0x00000012,0x3f800000,
+    0x0004002b,0x00000002,0x00000013,0x3f000000,0x00020013,0x00000043,0x00030021,0x00000044,
+    0x00000043,0x00050036,0x00000043,0x00000042,0x00000000,0x00000044,0x000200f8,0x00000045,
+    0x0004003d,0x00000003,0x00000014,0x0000000b,0x0004003d,0x00000005,0x00000015,0x0000000e,
+    0x00050051,0x00000002,0x00000016,0x00000014,0x00000000,0x00050051,0x00000002,0x00000017,
+    0x00000014,0x00000001,0x000500ba,0x00000006,0x00000018,0x00000016,0x00000011,0x000500ba,
+    0x00000006,0x00000019,0x00000017,0x00000011,0x00050051,0x00000002,0x0000001a,0x00000015,
+    0x00000001,0x00050051,0x00000002,0x0000001b,0x00000015,0x00000000,0x000600a9,0x00000002,
+    0x0000001c,0x00000018,0x0000001a,0x0000001b,0x00050051,0x00000002,0x0000001d,0x00000015,
+    0x00000003,0x00050051,0x00000002,0x0000001e,0x00000015,0x00000002,0x000600a9,0x00000002,
+    0x0000001f,0x00000018,0x0000001d,0x0000001e,0x000600a9,0x00000002,0x00000020,0x00000019,
+    0x0000001f,0x0000001c,0x0006000c,0x00000003,0x00000021,0x00000001,0x00000004,0x00000014,
+    0x0004003d,0x00000003,0x00000022,0x0000000d,0x00050083,0x00000003,0x00000023,0x00000021,
+    0x00000022,0x00050050,0x00000003,0x00000024,0x00000020,0x00000020,0x00050081,0x00000003,
+    0x00000025,0x00000023,0x00000024,0x00050051,0x00000002,0x00000026,0x00000025,0x00000000,
+    0x00050051,0x00000002,0x00000027,0x00000025,0x00000001,0x0007000c,0x00000002,0x00000028,
+    0x00000001,0x00000028,0x00000026,0x00000027,0x0007000c,0x00000002,0x00000029,0x00000001,
+    0x00000025,0x00000028,0x00000011,0x00050050,0x00000003,0x0000002a,0x00000011,0x00000011,
+    0x0007000c,0x00000003,0x0000002b,0x00000001,0x00000028,0x00000025,0x0000002a,0x0006000c,
+    0x00000002,0x0000002c,0x00000001,0x00000042,0x0000002b,0x00050081,0x00000002,0x0000002d,
+    0x00000029,0x0000002c,0x00050083,0x00000002,0x0000002e,0x0000002d,0x00000020,0x000500ba,
+    0x00000006,0x0000002f,0x00000020,0x00000011,0x000600a9,0x00000002,0x00000030,0x0000002f,
+    0x0000002e,0x00000028,0x0004003d,0x00000004,0x00000031,0x0000000f,0x0006000c,0x00000002,
+    0x00000032,0x00000001,0x00000004,0x00000030,0x00050051,0x00000002,0x00000033,0x00000031,
+    0x00000001,0x00050083,0x00000002,0x00000034,0x00000032,0x00000033,0x00050051,0x00000002,
+    0x00000035,0x00000031,0x00000000,0x0008000c,0x00000002,0x00000036,0x00000001,0x0000002e,
+    0x00000030,0x00000034,0x00000035,0x00050051,0x00000002,0x00000037,0x00000031,0x00000002,
+    0x00050085,0x00000002,0x00000038,0x00000036,0x00000037,0x00050083,0x00000002,0x00000039,
+    0x00000013,0x00000038,0x0008000c,0x00000002,0x0000003a,0x00000001,0x0000002b,0x00000039,
+    0x00000011,0x00000012,0x0004003d,0x00000005,0x0000003b,0x00000009,0x00050051,0x00000002,
+    0x0000003c,0x0000003b,0x00000000,0x00050051,0x00000002,0x0000003d,0x0000003b,0x00000001,
+    0x00050051,0x00000002,0x0000003e,0x0000003b,0x00000002,0x00050051,0x00000002,0x0000003f,
+    0x0000003b,0x00000003,0x00050085,0x00000002,0x00000040,0x0000003f,0x0000003a,0x00070050,
+    0x00000005,0x00000041,0x0000003c,0x0000003d,0x0000003e,0x00000040,0x0003003e,0x00000007,
+    0x00000041,0x000100fd,0x00010038
+};
+
 //-----------------------------------------------------------------------------
 // FUNCTIONS
 //-----------------------------------------------------------------------------
@@ -424,6 +713,73 @@ static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory
     buffer_size = buffer_size_aligned;
 }
 
+// Create a single buffer holding one region per in-flight frame, which stays mapped and is exposed to dear imgui as an ImDrawUploadArena
+static void ImGui_ImplVulkan_CreateUploadArena()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    VkResult err;
+
+    bd->UploadArenaFrameSize = AlignBufferSize(v->UploadArenaSize, bd->BufferMemoryAlignment);
+    bd->UploadArenaFrameCount = v->ImageCount;
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = bd->UploadArenaFrameSize * bd->UploadArenaFrameCount;
+    buffer_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &bd->UploadArenaBuffer);
+    check_vk_result(err);
+
+    // Prefer host cached memory: dear imgui reads back some vertices while building draw lists (e.g. ShadeVertsXXX functions), which is very slow on write-combined memory.
+    VkMemoryRequirements req;
+    vkGetBufferMemoryRequirements(v->Device, bd->UploadArenaBuffer, &req);
+    uint32_t memory_type = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, req.memoryTypeBits);
+    if (memory_type == 0xFFFFFFFF)
+        memory_type = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, req.memoryTypeBits);
+    bd->UploadArenaNeedFlush = (memory_type == 0xFFFFFFFF);
+    if (memory_type == 0xFFFFFFFF)
+        memory_type = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = req.size;
+    alloc_info.memoryTypeIndex = memory_type;
+    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &bd->UploadArenaMemory);
+    check_vk_result(err);
+    err = vkBindBufferMemory(v->Device, bd->UploadArenaBuffer, bd->UploadArenaMemory, 0);
+    check_vk_result(err);
+
+    void* data = nullptr;
+    err = vkMapMemory(v->Device, bd->UploadArenaMemory, 0, VK_WHOLE_SIZE, 0, &data);
+    check_vk_result(err);
+    bd->UploadArena.Data = data;
+    bd->UploadArena.Size = (size_t)buffer_info.size;
+    bd->UploadArena.FrameBegin = bd->UploadArena.FrameEnd = bd->UploadArena.FrameUsed = 0;
+
+    ImGui::GetIO().BackendFlags |= ImGuiBackendFlags_RendererHasUploadArena;
+    ImGui::GetPlatformIO().Renderer_UploadArena = &bd->UploadArena;
+}
+
+static void ImGui_ImplVulkan_DestroyUploadArena()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererHasUploadArena;
+    ImGui::GetPlatformIO().Renderer_UploadArena = nullptr;
+    if (bd->UploadArenaMemory) { vkUnmapMemory(v->Device, bd->UploadArenaMemory); }
+    if (bd->UploadArenaBuffer) { vkDestroyBuffer(v->Device, bd->UploadArenaBuffer, v->Allocator); bd->UploadArenaBuffer = VK_NULL_HANDLE; }
+    if (bd->UploadArenaMemory) { vkFreeMemory(v->Device, bd->UploadArenaMemory, v->Allocator); bd->UploadArenaMemory = VK_NULL_HANDLE; }
+    bd->UploadArenaFrameCount = 0;
+    bd->UploadArena = ImDrawUploadArena();
+}
+
+// Return true when vertices and indices of a draw list are stored in the current region of the upload arena, so they can be rendered without a copy
+static bool ImGui_ImplVulkan_IsInUploadArena(const ImDrawUploadArena* arena, const ImDrawList* draw_list)
+{
+    if (arena == nullptr)
+        return false;
+    return (draw_list->VtxBuffer.Size == 0 || arena->GetOffset(draw_list->VtxBuffer.Data) >= 0) && (draw_list->IdxBuffer.Size == 0 || arena->GetOffset(draw_list->IdxBuffer.Data) >= 0);
+}
+
 static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkan_FrameRenderBuffers* rb, int fb_width, int fb_height)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
@@ -434,7 +790,8 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
     }
 
     // Bind Vertex And Index Buffer:
-    if (draw_data->TotalVtxCount > 0)
+    // (not created when all draw lists are stored in the upload arena, in which case ImGui_ImplVulkan_RenderDrawData() binds the arena buffer)
+    if (draw_data->TotalVtxCount > 0 && rb->VertexBuffer != VK_NULL_HANDLE)
     {
         VkBuffer vertex_buffers[1] = { rb->VertexBuffer };
         VkDeviceSize vertex_offset[1] = { 0 };
@@ -442,6 +799,14 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
         vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
     }
 
+    // Bind Quad Instance Buffer (on binding 1, so switching between 'pipeline', bd->PipelineQuad and bd->PipelineShape only requires binding the pipeline):
+    if (draw_data->TotalQuadCount > 0)
+    {
+        VkBuffer quad_buffers[1] = { rb->QuadBuffer };
+        VkDeviceSize quad_offset[1] = { 0 };
+        vkCmdBindVertexBuffers(command_buffer, 1, 1, quad_buffers, quad_offset);
+    }
+
     // Setup viewport:
     {
         VkViewport viewport;
@@ -495,11 +860,43 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     wrb->Index = (wrb->Index + 1) % wrb->Count;
     ImGui_ImplVulkan_FrameRenderBuffers* rb = &wrb->FrameRenderBuffers[wrb->Index];
 
-    if (draw_data->TotalVtxCount > 0)
+    // Draw lists stored in the upload arena are rendered from it directly. Only copy the other ones.
+    // The region selected by ImGui_ImplVulkan_NewFrame() needs to be the one of these render buffers, so it is protected by the same fence.
+    // (it isn't when rendering more than once per ImGui_ImplVulkan_NewFrame() call: all draw lists are copied then)
+    const ImDrawUploadArena* upload_arena = nullptr;
+    if (bd->UploadArenaBuffer != VK_NULL_HANDLE)
+    {
+        IM_ASSERT(bd->UploadArenaFrameCount == wrb->Count);
+        IM_ASSERT(bd->UploadArena.FrameBegin <= bd->UploadArena.FrameEnd && bd->UploadArena.FrameEnd <= bd->UploadArena.Size);
+        if (bd->UploadArena.FrameBegin == bd->UploadArenaFrameSize * wrb->Index)
+            upload_arena = &bd->UploadArena;
+    }
+    int copy_vtx_count = 0;
+    int copy_idx_count = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        if (!ImGui_ImplVulkan_IsInUploadArena(upload_arena, draw_list))
+        {
+            copy_vtx_count += draw_list->VtxBuffer.Size;
+            copy_idx_count += draw_list->IdxBuffer.Size;
+        }
+    }
+    if (upload_arena != nullptr && bd->UploadArenaNeedFlush && copy_vtx_count < draw_data->TotalVtxCount)
+    {
+        VkMappedMemoryRange range = {};
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.memory = bd->UploadArenaMemory;
+        range.size = VK_WHOLE_SIZE;
+        VkResult err = vkFlushMappedMemoryRanges(v->Device, 1, &range);
+        check_vk_result(err);
+    }
+
+    if (copy_vtx_count > 0)
     {
         // Create or resize the vertex/index buffers
-        VkDeviceSize vertex_size = AlignBufferSize(draw_data->TotalVtxCount * sizeof(ImDrawVert), bd->BufferMemoryAlignment);
-        VkDeviceSize index_size = AlignBufferSize(draw_data->TotalIdxCount * sizeof(ImDrawIdx), bd->BufferMemoryAlignment);
+        VkDeviceSize vertex_size = AlignBufferSize(copy_vtx_count * sizeof(ImDrawVert), bd->BufferMemoryAlignment);
+        VkDeviceSize index_size = AlignBufferSize(copy_idx_count * sizeof(ImDrawIdx), bd->BufferMemoryAlignment);
         if (rb->VertexBuffer == VK_NULL_HANDLE || rb->VertexBufferSize < vertex_size)
             CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, vertex_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
         if (rb->IndexBuffer == VK_NULL_HANDLE || rb->IndexBufferSize < index_size)
@@ -515,6 +912,8 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         for (int n = 0; n < draw_data->CmdListsCount; n++)
         {
             const ImDrawList* draw_list = draw_data->CmdLists[n];
+            if (ImGui_ImplVulkan_IsInUploadArena(upload_arena, draw_list))
+                continue;
             memcpy(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
             memcpy(idx_dst, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
             vtx_dst += draw_list->VtxBuffer.Size;
@@ -532,6 +931,29 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         vkUnmapMemory(v->Device, rb->VertexBufferMemory);
         vkUnmapMemory(v->Device, rb->IndexBufferMemory);
     }
+    if (draw_data->TotalQuadCount > 0)
+    {
+        // Create or resize the quad instance buffer, then upload quad instances into it
+        VkDeviceSize quad_size = AlignBufferSize(draw_data->TotalQuadCount * sizeof(ImDrawQuad), bd->BufferMemoryAlignment);
+        if (rb->QuadBuffer == VK_NULL_HANDLE || rb->QuadBufferSize < quad_size)
+            CreateOrResizeBuffer(rb->QuadBuffer, rb->QuadBufferMemory, rb->QuadBufferSize, quad_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+        ImDrawQuad* quad_dst = nullptr;
+        VkResult err = vkMapMemory(v->Device, rb->QuadBufferMemory, 0, quad_size, 0, (void**)&quad_dst);
+        check_vk_result(err);
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[n];
+            memcpy(quad_dst, draw_list->QuadBuffer.Data, draw_list->QuadBuffer.Size * sizeof(ImDrawQuad));
+            quad_dst += draw_list->QuadBuffer.Size;
+        }
+        VkMappedMemoryRange range = {};
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.memory = rb->QuadBufferMemory;
+        range.size = VK_WHOLE_SIZE;
+        err = vkFlushMappedMemoryRanges(v->Device, 1, &range);
+        check_vk_result(err);
+        vkUnmapMemory(v->Device, rb->QuadBufferMemory);
+    }
 
     // Setup desired Vulkan state
     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
@@ -550,20 +972,56 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
 
     // Render command lists
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
+    // (Draw lists stored in the upload arena are drawn from bd->UploadArenaBuffer, using their offset in the arena)
+    // (Quad/shape instances commands are drawn with bd->PipelineQuad/bd->PipelineShape. We rebind 'pipeline' before the next triangles command or user callback, so callbacks always see the regular render state)
     int global_vtx_offset = 0;
     int global_idx_offset = 0;
+    int global_quad_offset = 0;
+    VkPipeline bound_pipeline = pipeline;
+    VkBuffer bound_vtx_buffer = (draw_data->TotalVtxCount > 0) ? rb->VertexBuffer : VK_NULL_HANDLE;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
+        const bool in_upload_arena = ImGui_ImplVulkan_IsInUploadArena(upload_arena, draw_list);
+        VkBuffer list_vtx_buffer = in_upload_arena ? bd->UploadArenaBuffer : rb->VertexBuffer;
+        VkBuffer list_idx_buffer = in_upload_arena ? bd->UploadArenaBuffer : rb->IndexBuffer;
+        int list_vtx_offset = global_vtx_offset;
+        int list_idx_offset = global_idx_offset;
+        if (in_upload_arena)
+        {
+            list_vtx_offset = draw_list->VtxBuffer.Size ? (int)(upload_arena->GetOffset(draw_list->VtxBuffer.Data) / sizeof(ImDrawVert)) : 0;
+            list_idx_offset = draw_list->IdxBuffer.Size ? (int)(upload_arena->GetOffset(draw_list->IdxBuffer.Data) / sizeof(ImDrawIdx)) : 0;
+        }
+        if (list_vtx_buffer != bound_vtx_buffer && draw_list->IdxBuffer.Size > 0)
+        {
+            VkDeviceSize vertex_offset[1] = { 0 };
+            vkCmdBindVertexBuffers(command_buffer, 0, 1, &list_vtx_buffer, vertex_offset);
+            vkCmdBindIndexBuffer(command_buffer, list_idx_buffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+            bound_vtx_buffer = list_vtx_buffer;
+        }
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (bound_pipeline != pipeline && (pcmd->UserCallback != nullptr || !pcmd->QuadInstances))
+            {
+                vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+                bound_pipeline = pipeline;
+            }
             if (pcmd->UserCallback != nullptr)
             {
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
+                    if (list_vtx_buffer != rb->VertexBuffer)
+                    {
+                        VkDeviceSize vertex_offset[1] = { 0 };
+                        vkCmdBindVertexBuffers(command_buffer, 0, 1, &list_vtx_buffer, vertex_offset);
+                        vkCmdBindIndexBuffer(command_buffer, list_idx_buffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+                    }
+                    bound_vtx_buffer = list_vtx_buffer;
+                }
                 else
                     pcmd->UserCallback(draw_list, pcmd);
             }
@@ -600,12 +1058,30 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, desc_set, 0, nullptr);
 
                 // Draw
-                vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
+                if (pcmd->QuadInstances)
+                {
+                    VkPipeline quad_pipeline = (pcmd->QuadInstances == ImDrawQuadKind_Shape) ? bd->PipelineShape : bd->PipelineQuad;
+                    IM_ASSERT(quad_pipeline != VK_NULL_HANDLE && "Quad/shape instances require ImGui_ImplVulkan_InitInfo::UseQuadInstances/UseShapeInstances!");
+                    if (bound_pipeline != quad_pipeline)
+                        vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, quad_pipeline);
+                    bound_pipeline = quad_pipeline;
+                    vkCmdDraw(command_buffer, 4, pcmd->ElemCount, 0, pcmd->IdxOffset + global_quad_offset);
+                }
+                else
+                {
+                    vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + list_idx_offset, pcmd->VtxOffset + list_vtx_offset, 0);
+                }
             }
         }
-        global_idx_offset += draw_list->IdxBuffer.Size;
-        global_vtx_offset += draw_list->VtxBuffer.Size;
+        if (!in_upload_arena)
+        {
+            global_idx_offset += draw_list->IdxBuffer.Size;
+            global_vtx_offset += draw_list->VtxBuffer.Size;
+        }
+        global_quad_offset += draw_list->QuadBuffer.Size;
     }
+    if (bound_pipeline != pipeline)
+        vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
     platform_io.Renderer_RenderState = NULL;
 
     // Note: at this point both vkCmdSetViewport() and vkCmdSetScissor() have been called.
@@ -846,6 +1322,24 @@ static void ImGui_ImplVulkan_CreateShaderModules(VkDevice device, const VkAlloca
         VkResult err = vkCreateShaderModule(device, &vert_info, allocator, &bd->ShaderModuleVert);
         check_vk_result(err);
     }
+    if (bd->ShaderModuleVertQuad == VK_NULL_HANDLE && bd->VulkanInitInfo.UseQuadInstances)
+    {
+        VkShaderModuleCreateInfo vert_info = {};
+        vert_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        vert_info.codeSize = sizeof(__glsl_shader_quad_vert_spv);
+        vert_info.pCode = (uint32_t*)__glsl_shader_quad_vert_spv;
+        VkResult err = vkCreateShaderModule(device, &vert_info, allocator, &bd->ShaderModuleVertQuad);
+        check_vk_result(err);
+    }
+    if (bd->ShaderModuleVertShape == VK_NULL_HANDLE && bd->VulkanInitInfo.UseShapeInstances)
+    {
+        VkShaderModuleCreateInfo vert_info = {};
+        vert_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        vert_info.codeSize = sizeof(__glsl_shader_shape_vert_spv);
+        vert_info.pCode = (uint32_t*)__glsl_shader_shape_vert_spv;
+        VkResult err = vkCreateShaderModule(device, &vert_info, allocator, &bd->ShaderModuleVertShape);
+        check_vk_result(err);
+    }
     if (bd->ShaderModuleFrag == VK_NULL_HANDLE)
     {
         VkShaderModuleCreateInfo frag_info = {};
@@ -855,21 +1349,33 @@ static void ImGui_ImplVulkan_CreateShaderModules(VkDevice device, const VkAlloca
         VkResult err = vkCreateShaderModule(device, &frag_info, allocator, &bd->ShaderModuleFrag);
         check_vk_result(err);
     }
+    if (bd->ShaderModuleFragShape == VK_NULL_HANDLE && bd->VulkanInitInfo.UseShapeInstances)
+    {
+        VkShaderModuleCreateInfo frag_info = {};
+        frag_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        frag_info.codeSize = sizeof(__glsl_shader_shape_frag_spv);
+        frag_info.pCode = (uint32_t*)__glsl_shader_shape_frag_spv;
+        VkResult err = vkCreateShaderModule(device, &frag_info, allocator, &bd->ShaderModuleFragShape);
+        check_vk_result(err);
+    }
 }
 
-static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass)
+// 'quad_kind' != ImDrawQuadKind_None: create the pipeline used for ImDrawCmd with QuadInstances == quad_kind, sourcing ImDrawQuad instances from vertex binding 1.
+static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass, unsigned int quad_kind = ImDrawQuadKind_None)
 {
+    const bool quad_instances = (quad_kind != ImDrawQuadKind_None);
+    const bool shape_instances = (quad_kind == ImDrawQuadKind_Shape);
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_CreateShaderModules(device, allocator);
 
     VkPipelineShaderStageCreateInfo stage[2] = {};
     stage[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-    stage[0].module = bd->ShaderModuleVert;
+    stage[0].module = shape_instances ? bd->ShaderModuleVertShape : quad_instances ? bd->ShaderModuleVertQuad : bd->ShaderModuleVert;
     stage[0].pName = "main";
     stage[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    stage[1].module = bd->ShaderModuleFrag;
+    stage[1].module = shape_instances ? bd->ShaderModuleFragShape : bd->ShaderModuleFrag;
     stage[1].pName = "main";
 
     VkVertexInputBindingDescription binding_desc[1] = {};
@@ -890,16 +1396,39 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     attribute_desc[2].format = VK_FORMAT_R8G8B8A8_UNORM;
     attribute_desc[2].offset = offsetof(ImDrawVert, col);
 
+    VkVertexInputBindingDescription quad_binding_desc[1] = {};
+    quad_binding_desc[0].binding = 1;
+    quad_binding_desc[0].stride = sizeof(ImDrawQuad);
+    quad_binding_desc[0].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+    VkVertexInputAttributeDescription quad_attribute_desc[4] = {};
+    quad_attribute_desc[0].location = 0;
+    quad_attribute_desc[0].binding = quad_binding_desc[0].binding;
+    quad_attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+    quad_attribute_desc[0].offset = offsetof(ImDrawQuad, Pos);
+    quad_attribute_desc[1].location = 1;
+    quad_attribute_desc[1].binding = quad_binding_desc[0].binding;
+    quad_attribute_desc[1].format = VK_FORMAT_R16G16_UINT;
+    quad_attribute_desc[1].offset = offsetof(ImDrawQuad, Size);
+    quad_attribute_desc[2].location = 2;
+    quad_attribute_desc[2].binding = quad_binding_desc[0].binding;
+    quad_attribute_desc[2].format = shape_instances ? VK_FORMAT_R16G16B16A16_UINT : VK_FORMAT_R16G16B16A16_UNORM; // Shape parameters or UV
+    quad_attribute_desc[2].offset = offsetof(ImDrawQuad, UV);
+    quad_attribute_desc[3].location = 3;
+    quad_attribute_desc[3].binding = quad_binding_desc[0].binding;
+    quad_attribute_desc[3].format = VK_FORMAT_R8G8B8A8_UNORM;
+    quad_attribute_desc[3].offset = offsetof(ImDrawQuad, Col);
+
     VkPipelineVertexInputStateCreateInfo vertex_info = {};
     vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
     vertex_info.vertexBindingDescriptionCount = 1;
-    vertex_info.pVertexBindingDescriptions = binding_desc;
-    vertex_info.vertexAttributeDescriptionCount = 3;
-    vertex_info.pVertexAttributeDescriptions = attribute_desc;
+    vertex_info.pVertexBindingDescriptions = quad_instances ? quad_binding_desc : binding_desc;
+    vertex_info.vertexAttributeDescriptionCount = quad_instances ? 4 : 3;
+    vertex_info.pVertexAttributeDescriptions = quad_instances ? quad_attribute_desc : attribute_desc;
 
     VkPipelineInputAssemblyStateCreateInfo ia_info = {};
     ia_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    ia_info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    ia_info.topology = quad_instances ? VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP : VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
 
     VkPipelineViewportStateCreateInfo viewport_info = {};
     viewport_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
@@ -1029,6 +1558,13 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
     }
 
     ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->Pipeline, v->Subpass);
+    if (v->UseQuadInstances)
+        ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->PipelineQuad, v->Subpass, ImDrawQuadKind_Textured);
+    if (v->UseShapeInstances)
+        ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->PipelineShape, v->Subpass, ImDrawQuadKind_Shape);
+
+    if (v->UploadArenaSize > 0 && !bd->UploadArenaBuffer)
+        ImGui_ImplVulkan_CreateUploadArena();
 
     return true;
 }
@@ -1038,16 +1574,22 @@ void    ImGui_ImplVulkan_DestroyDeviceObjects()
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
     ImGui_ImplVulkan_DestroyWindowRenderBuffers(v->Device, &bd->MainWindowRenderBuffers, v->Allocator);
+    ImGui_ImplVulkan_DestroyUploadArena();
     ImGui_ImplVulkan_DestroyFontsTexture();
 
     if (bd->FontCommandBuffer)    { vkFreeCommandBuffers(v->Device, bd->FontCommandPool, 1, &bd->FontCommandBuffer); bd->FontCommandBuffer = VK_NULL_HANDLE; }
     if (bd->FontCommandPool)      { vkDestroyCommandPool(v->Device, bd->FontCommandPool, v->Allocator); bd->FontCommandPool = VK_NULL_HANDLE; }
     if (bd->ShaderModuleVert)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleVert, v->Allocator); bd->ShaderModuleVert = VK_NULL_HANDLE; }
+    if (bd->ShaderModuleVertQuad) { vkDestroyShaderModule(v->Device, bd->ShaderModuleVertQuad, v->Allocator); bd->ShaderModuleVertQuad = VK_NULL_HANDLE; }
+    if (bd->ShaderModuleVertShape) { vkDestroyShaderModule(v->Device, bd->ShaderModuleVertShape, v->Allocator); bd->ShaderModuleVertShape = VK_NULL_HANDLE; }
     if (bd->ShaderModuleFrag)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleFrag, v->Allocator); bd->ShaderModuleFrag = VK_NULL_HANDLE; }
+    if (bd->ShaderModuleFragShape) { vkDestroyShaderModule(v->Device, bd->ShaderModuleFragShape, v->Allocator); bd->ShaderModuleFragShape = VK_NULL_HANDLE; }
     if (bd->FontSampler)          { vkDestroySampler(v->Device, bd->FontSampler, v->Allocator); bd->FontSampler = VK_NULL_HANDLE; }
     if (bd->DescriptorSetLayout)  { vkDestroyDescriptorSetLayout(v->Device, bd->DescriptorSetLayout, v->Allocator); bd->DescriptorSetLayout = VK_NULL_HANDLE; }
     if (bd->PipelineLayout)       { vkDestroyPipelineLayout(v->Device, bd->PipelineLayout, v->Allocator); bd->PipelineLayout = VK_NULL_HANDLE; }
     if (bd->Pipeline)             { vkDestroyPipeline(v->Device, bd->Pipeline, v->Allocator); bd->Pipeline = VK_NULL_HANDLE; }
+    if (bd->PipelineQuad)         { vkDestroyPipeline(v->Device, bd->PipelineQuad, v->Allocator); bd->PipelineQuad = VK_NULL_HANDLE; }
+    if (bd->PipelineShape)        { vkDestroyPipeline(v->Device, bd->PipelineShape, v->Allocator); bd->PipelineShape = VK_NULL_HANDLE; }
 }
 
 bool    ImGui_ImplVulkan_LoadFunctions(PFN_vkVoidFunction(*loader_func)(const char* function_name, void* user_data), void* user_data)
@@ -1105,6 +1647,10 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info)
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_vulkan";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    if (info->UseQuadInstances)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasQuadInstances; // We can honor the ImDrawCmd::QuadInstances field, allowing glyphs and rectangles to be submitted as ImDrawQuad instances.
+    if (info->UseShapeInstances)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasShapeInstances; // We can honor ImDrawCmd::QuadInstances == ImDrawQuadKind_Shape, allowing rounded rectangles, circles and borders to be submitted as single ImDrawQuad instances.
 
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
     IM_ASSERT(info->PhysicalDevice != VK_NULL_HANDLE);
@@ -1132,7 +1678,7 @@ void ImGui_ImplVulkan_Shutdown()
     ImGui_ImplVulkan_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasQuadInstances | ImGuiBackendFlags_RendererHasShapeInstances | ImGuiBackendFlags_RendererHasUploadArena);
     IM_DELETE(bd);
 }
 
@@ -1143,6 +1689,15 @@ void ImGui_ImplVulkan_NewFrame()
 
     if (!bd->FontDescriptorSet)
         ImGui_ImplVulkan_CreateFontsTexture();
+
+    // Select the upload arena region matching the render buffers which the next ImGui_ImplVulkan_RenderDrawData() call will use
+    if (bd->UploadArenaBuffer)
+    {
+        uint32_t frame_index = (bd->MainWindowRenderBuffers.Index + 1) % bd->UploadArenaFrameCount;
+        bd->UploadArena.FrameBegin = (size_t)(bd->UploadArenaFrameSize * frame_index);
+        bd->UploadArena.FrameEnd = (size_t)(bd->UploadArenaFrameSize * (frame_index + 1));
+        IM_ASSERT(bd->UploadArena.FrameEnd <= bd->UploadArena.Size);
+    }
 }
 
 void ImGui_ImplVulkan_SetMinImageCount(uint32_t min_image_count)
@@ -1157,6 +1712,13 @@ void ImGui_ImplVulkan_SetMinImageCount(uint32_t min_image_count)
     check_vk_result(err);
     ImGui_ImplVulkan_DestroyWindowRenderBuffers(v->Device, &bd->MainWindowRenderBuffers, v->Allocator);
     bd->VulkanInitInfo.MinImageCount = min_image_count;
+
+    // Upload arena has one region per render buffers: recreate it along with them
+    if (bd->UploadArenaBuffer)
+    {
+        ImGui_ImplVulkan_DestroyUploadArena();
+        ImGui_ImplVulkan_CreateUploadArena();
+    }
 }
 
 // Register a texture
@@ -1208,8 +1770,11 @@ void ImGui_ImplVulkan_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulka
     if (buffers->VertexBufferMemory) { vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
     if (buffers->IndexBuffer) { vkDestroyBuffer(device, buffers->IndexBuffer, allocator); buffers->IndexBuffer = VK_NULL_HANDLE; }
     if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
+    if (buffers->QuadBuffer) { vkDestroyBuffer(device, buffers->QuadBuffer, allocator); buffers->QuadBuffer = VK_NULL_HANDLE; }
+    if (buffers->QuadBufferMemory) { vkFreeMemory(device, buffers->QuadBufferMemory, allocator); buffers->QuadBufferMemory = VK_NULL_HANDLE; }
     buffers->VertexBufferSize = 0;
     buffers->IndexBufferSize = 0;
+    buffers->QuadBufferSize = 0;
 }
 
 void ImGui_ImplVulkan_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkan_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
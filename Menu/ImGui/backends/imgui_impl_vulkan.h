@@ -94,6 +94,19 @@ struct ImGui_ImplVulkan_InitInfo
     const VkAllocationCallbacks*    Allocator;
     void                            (*CheckVkResultFn)(VkResult err);
     VkDeviceSize                    MinAllocationSize;      // Minimum allocation size. Set to 1024*1024 to satisfy zealous best practices validation layer and waste a little memory.
+
+    // (Optional) Quad instances: draw glyphs and axis-aligned rectangles as ImDrawQuad instances (sets ImGuiBackendFlags_RendererHasQuadInstances).
+    // Uses an extra pipeline built from backends/vulkan/glsl_shader_quad.vert. Disabled by default.
+    bool                            UseQuadInstances;
+    // (Optional) Shape instances: draw rounded rectangles, circles and borders as single ImDrawQuadKind_Shape instances (sets ImGuiBackendFlags_RendererHasShapeInstances).
+    // Uses an extra pipeline built from backends/vulkan/glsl_shader_shape.vert/.frag. Coverage is computed per-pixel, so edges are smoother than the tessellated shapes. Disabled by default.
+    bool                            UseShapeInstances;
+
+    // (Optional) Upload arena: size in bytes of persistently mapped memory per in-flight frame, where draw lists directly store their vertices and indices.
+    // This removes the vertex/index copy done by ImGui_ImplVulkan_RenderDrawData(). Draw lists which don't fit are copied as usual. 0 to disable.
+    // The memory of a frame is written between ImGui::NewFrame() and ImGui::Render(), so the GPU needs to be done with the frame submitted ImageCount frames ago before you call ImGui::NewFrame().
+    // One region per render buffers (ImageCount of them): the arena is recreated along with them by ImGui_ImplVulkan_SetMinImageCount().
+    VkDeviceSize                    UploadArenaSize;
 };
 
 // Follow "Getting Started" link and check examples/ folder to learn about using backends!
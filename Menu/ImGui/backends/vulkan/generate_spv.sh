@@ -4,3 +4,6 @@
 ## -o: output file
 glslangValidator -V -x -o glsl_shader.frag.u32 glsl_shader.frag
 glslangValidator -V -x -o glsl_shader.vert.u32 glsl_shader.vert
+glslangValidator -V -x -o glsl_shader_quad.vert.u32 glsl_shader_quad.vert
+glslangValidator -V -x -o glsl_shader_shape.frag.u32 glsl_shader_shape.frag
+glslangValidator -V -x -o glsl_shader_shape.vert.u32 glsl_shader_shape.vert
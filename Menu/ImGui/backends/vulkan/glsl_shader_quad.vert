@@ -0,0 +1,28 @@
+#version 450 core
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in uvec2 aSize;
+layout(location = 2) in vec4 aUV;
+layout(location = 3) in vec4 aColor;
+
+layout(push_constant) uniform uPushConstant {
+    vec2 uScale;
+    vec2 uTranslate;
+} pc;
+
+out gl_PerVertex {
+    vec4 gl_Position;
+};
+
+layout(location = 0) out struct {
+    vec4 Color;
+    vec2 UV;
+} Out;
+
+// One ImDrawQuad instance expanded to a 4 vertices triangle strip.
+void main()
+{
+    vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+    Out.Color = aColor;
+    Out.UV = mix(aUV.xy, aUV.zw, corner);
+    gl_Position = vec4((aPos + vec2(aSize) * (1.0 / 16.0) * corner) * pc.uScale + pc.uTranslate, 0, 1);
+}
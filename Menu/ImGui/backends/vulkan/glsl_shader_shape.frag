@@ -0,0 +1,19 @@
+#version 450 core
+layout(location = 0) out vec4 fColor;
+
+layout(location = 0) in vec4 Color;
+layout(location = 1) in vec2 Pos;
+layout(location = 2) flat in vec2 HalfSize;
+layout(location = 3) flat in vec4 Radii;
+layout(location = 4) flat in vec3 Stroke;
+
+// Signed distance to a rounded rectangle (per-corner radius, square corners when radius is 0), turned into coverage.
+// Filled shapes fade over [-0.5,+0.5] pixel around the edge, borders over the same distance around each side of the stroke.
+void main()
+{
+    float r = Pos.y > 0.0 ? (Pos.x > 0.0 ? Radii.w : Radii.z) : (Pos.x > 0.0 ? Radii.y : Radii.x);
+    vec2 q = abs(Pos) - HalfSize + r;
+    float d = r > 0.0 ? min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - r : max(q.x, q.y);
+    d = mix(d, abs(d) - Stroke.y, Stroke.x);
+    fColor = vec4(Color.rgb, Color.a * clamp(0.5 - d * Stroke.z, 0.0, 1.0));
+}
@@ -0,0 +1,34 @@
+#version 450 core
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in uvec2 aSize;
+layout(location = 2) in uvec4 aParams;
+layout(location = 3) in vec4 aColor;
+
+layout(push_constant) uniform uPushConstant {
+    vec2 uScale;
+    vec2 uTranslate;
+} pc;
+
+out gl_PerVertex {
+    vec4 gl_Position;
+};
+
+layout(location = 0) out vec4 Color;
+layout(location = 1) out vec2 Pos;
+layout(location = 2) flat out vec2 HalfSize;
+layout(location = 3) flat out vec4 Radii;
+layout(location = 4) flat out vec3 Stroke;
+
+// One ImDrawQuadKind_Shape instance expanded to a 4 vertices triangle strip.
+// aParams = (rounding, thickness, corners mask | 0x10 if anti-aliased, inset), lengths in 1/16th of a pixel.
+void main()
+{
+    vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+    vec2 size = vec2(aSize) * (1.0 / 16.0);
+    Color = aColor;
+    Pos = (corner - 0.5) * size;
+    HalfSize = size * 0.5 - float(aParams.w) * (1.0 / 16.0);
+    Radii = vec4((uvec4(aParams.z) >> uvec4(0, 1, 2, 3)) & 1u) * (float(aParams.x) * (1.0 / 16.0));
+    Stroke = vec3(aParams.y != 0u ? 1.0 : 0.0, float(aParams.y) * (1.0 / 32.0), (aParams.z & 16u) != 0u ? 1.0 : 65536.0);
+    gl_Position = vec4((aPos + size * corner) * pc.uScale + pc.uTranslate, 0, 1);
+}
@@ -429,6 +429,9 @@ CODE
  When you are not sure about an old symbol or function name, try using the Search/Find function of your IDE to look for comments or references in all imgui files.
  You can read releases logs https://github.com/ocornut/imgui/releases for more details.
 
+ - 2026/10/19 (1.91.5) - draw: added 'unsigned int QuadInstances' to ImDrawCmd (and ImDrawCmdHeader), between VtxOffset and IdxOffset. sizeof(ImDrawCmd) is unchanged on 64-bit targets (the field uses former padding) but may grow by 4 bytes on 32-bit targets.
+                         - code initializing ImDrawCmd/ImDrawCmdHeader with positional aggregate initializers, or reading draw commands with hardcoded offsets, needs updating.
+                         - the field is always 0 unless the backend sets ImGuiBackendFlags_RendererHasQuadInstances, so backends don't need to be changed.
  - 2024/11/06 (1.91.5) - commented/obsoleted out pre-1.87 IO system (equivalent to using IMGUI_DISABLE_OBSOLETE_KEYIO or IMGUI_DISABLE_OBSOLETE_FUNCTIONS before)
                             - io.KeyMap[] and io.KeysDown[] are removed (obsoleted February 2022).
                             - io.NavInputs[] and ImGuiNavInput are removed (obsoleted July 2022).
@@ -1292,6 +1295,260 @@ static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
 
+// ImGuiPoolAllocator
+// - Every allocation is preceded by a 16 bytes ImGuiPoolAllocatorHeader pointing to its page (NULL for large allocations),
+//   so Free() doesn't need the allocation size, and neither pages nor large allocations need any alignment padding.
+// - Each page is IM_POOL_PAGE_SIZE bytes, starts with a ImGuiPoolAllocatorPage header and holds slots of a single size class.
+// - Regions (groups of IM_POOL_PAGES_PER_REGION pages) are returned to the host once all their pages are free,
+//   as long as another region worth of free pages stays around, so we don't thrash the host on a repeating pattern.
+#define IM_POOL_PAGE_SIZE           (16 * 1024)
+#define IM_POOL_PAGES_PER_REGION    16
+#define IM_POOL_CLASS_COUNT         24
+#define IM_POOL_CLASS_SIZE_MAX      2048            // Including header
+#define IM_POOL_PAGE_HEADER_SIZE    ((int)IM_MEMALIGN(sizeof(ImGuiPoolAllocatorPage), 16))
+
+// Fields are widened to 64-bit so the header is 16 bytes on 32-bit targets too, keeping slots and user pointers on the same alignment.
+struct ImGuiPoolAllocatorHeader
+{
+    union { ImGuiPoolAllocatorPage* Page;   ImU64 _PagePad; };  // NULL for a large allocation
+    union { size_t LargeSize;               ImU64 _SizePad; };  // Large allocation: size requested
+};
+
+struct ImGuiPoolAllocatorRegion
+{
+    ImGuiPoolAllocatorRegion*   Next;
+    char*                       PagesBase;          // Also the pointer to free
+    int                         UsedPages;
+};
+
+struct ImGuiPoolAllocatorPage
+{
+    ImGuiPoolAllocatorPage*     Prev;               // Links in ImGuiPoolAllocator::_PartialPages[] or _FreePages
+    ImGuiPoolAllocatorPage*     Next;
+    ImGuiPoolAllocatorRegion*   Region;
+    void*                       FreeSlots;          // Freed slots, linked through their first bytes
+    int                         ClassIdx;           // -1 when the page is free
+    int                         SlotSize;
+    int                         UsedSlots;
+    int                         BumpOffset;         // Offset of the first slot which was never allocated
+    bool                        InPartialList;
+};
+
+// Size classes: multiples of 16 up to 128, then 4 classes per power of two up to 2048.
+static int ImPoolAllocatorClassSize(int class_idx)
+{
+    if (class_idx < 8)
+        return (class_idx + 1) * 16;
+    const int k = class_idx - 8;
+    return (5 + (k & 3)) << (5 + (k >> 2));
+}
+
+static int ImPoolAllocatorSizeToClass(size_t size)
+{
+    IM_ASSERT(size > 0 && size <= IM_POOL_CLASS_SIZE_MAX);
+    if (size <= 128)
+        return (int)((size - 1) >> 4);
+    const size_t n = size - 1;
+    int log2 = 7;
+    while ((n >> (log2 + 1)) != 0)
+        log2++;
+    return 8 + (log2 - 7) * 4 + (int)(n >> (log2 - 2)) - 4;
+}
+
+static void* ImPoolAllocatorHostAlloc(ImGuiPoolAllocator* pool, size_t size) { return pool->HostAllocFunc ? pool->HostAllocFunc(size, pool->HostUserData) : MallocWrapper(size, NULL); }
+static void  ImPoolAllocatorHostFree(ImGuiPoolAllocator* pool, void* ptr)    { if (pool->HostFreeFunc) pool->HostFreeFunc(ptr, pool->HostUserData); else FreeWrapper(ptr, NULL); }
+
+static void ImPoolAllocatorLinkPage(ImGuiPoolAllocatorPage** p_head, ImGuiPoolAllocatorPage* page)
+{
+    page->Prev = NULL;
+    page->Next = *p_head;
+    if (*p_head)
+        (*p_head)->Prev = page;
+    *p_head = page;
+}
+
+static void ImPoolAllocatorUnlinkPage(ImGuiPoolAllocatorPage** p_head, ImGuiPoolAllocatorPage* page)
+{
+    if (page->Prev)
+        page->Prev->Next = page->Next;
+    else
+        *p_head = page->Next;
+    if (page->Next)
+        page->Next->Prev = page->Prev;
+    page->Prev = page->Next = NULL;
+}
+
+static ImGuiPoolAllocatorPage* ImPoolAllocatorAcquirePage(ImGuiPoolAllocator* pool)
+{
+    if (pool->_FreePages == NULL)
+    {
+        // Region struct is stored after its pages
+        const size_t raw_size = (size_t)IM_POOL_PAGE_SIZE * IM_POOL_PAGES_PER_REGION + sizeof(ImGuiPoolAllocatorRegion);
+        char* pages_base = (char*)ImPoolAllocatorHostAlloc(pool, raw_size);
+        if (pages_base == NULL)
+            return NULL;
+        ImGuiPoolAllocatorRegion* region = (ImGuiPoolAllocatorRegion*)(void*)(pages_base + (size_t)IM_POOL_PAGE_SIZE * IM_POOL_PAGES_PER_REGION);
+        region->Next = pool->_Regions;
+        region->PagesBase = pages_base;
+        region->UsedPages = 0;
+        pool->_Regions = region;
+        pool->BytesReserved += raw_size;
+        for (int n = IM_POOL_PAGES_PER_REGION - 1; n >= 0; n--)
+        {
+            ImGuiPoolAllocatorPage* page = (ImGuiPoolAllocatorPage*)(void*)(pages_base + (size_t)IM_POOL_PAGE_SIZE * n);
+            memset(page, 0, sizeof(*page));
+            page->Region = region;
+            page->ClassIdx = -1;
+            ImPoolAllocatorLinkPage(&pool->_FreePages, page);
+        }
+        pool->FreePageCount += IM_POOL_PAGES_PER_REGION;
+    }
+    ImGuiPoolAllocatorPage* page = pool->_FreePages;
+    ImPoolAllocatorUnlinkPage(&pool->_FreePages, page);
+    page->Region->UsedPages++;
+    pool->FreePageCount--;
+    pool->PageCount++;
+    return page;
+}
+
+static void ImPoolAllocatorReleasePage(ImGuiPoolAllocator* pool, ImGuiPoolAllocatorPage* page)
+{
+    ImGuiPoolAllocatorRegion* region = page->Region;
+    page->ClassIdx = -1;
+    ImPoolAllocatorLinkPage(&pool->_FreePages, page);
+    region->UsedPages--;
+    pool->FreePageCount++;
+    pool->PageCount--;
+    if (region->UsedPages > 0 || pool->FreePageCount < IM_POOL_PAGES_PER_REGION * 2)
+        return;
+
+    // Return region to the host
+    for (int n = 0; n < IM_POOL_PAGES_PER_REGION; n++)
+        ImPoolAllocatorUnlinkPage(&pool->_FreePages, (ImGuiPoolAllocatorPage*)(void*)(region->PagesBase + (size_t)IM_POOL_PAGE_SIZE * n));
+    pool->FreePageCount -= IM_POOL_PAGES_PER_REGION;
+    for (ImGuiPoolAllocatorRegion** p_region = &pool->_Regions; *p_region != NULL; p_region = &(*p_region)->Next)
+        if (*p_region == region)
+        {
+            *p_region = region->Next;
+            break;
+        }
+    pool->BytesReserved -= (size_t)IM_POOL_PAGE_SIZE * IM_POOL_PAGES_PER_REGION + sizeof(ImGuiPoolAllocatorRegion);
+    ImPoolAllocatorHostFree(pool, region->PagesBase);
+}
+
+ImGuiPoolAllocator::ImGuiPoolAllocator()
+{
+    memset(this, 0, sizeof(*this));
+}
+
+ImGuiPoolAllocator::~ImGuiPoolAllocator()
+{
+    // Live allocations would point into our regions: leave them to the OS (e.g. static ImVector<> destroyed after us at exit).
+    if (AllocCount > 0)
+        return;
+    while (ImGuiPoolAllocatorRegion* region = _Regions)
+    {
+        _Regions = region->Next;
+        ImPoolAllocatorHostFree(this, region->PagesBase);
+    }
+    memset(this, 0, sizeof(*this));
+}
+
+void* ImGuiPoolAllocator::Alloc(size_t size)
+{
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(_PartialPages) == IM_POOL_CLASS_COUNT);
+    IM_STATIC_ASSERT(sizeof(ImGuiPoolAllocatorHeader) == 16);
+    const size_t total_size = size + sizeof(ImGuiPoolAllocatorHeader);
+    if (total_size > IM_POOL_CLASS_SIZE_MAX)
+    {
+        ImGuiPoolAllocatorHeader* header = (ImGuiPoolAllocatorHeader*)ImPoolAllocatorHostAlloc(this, total_size);
+        if (header == NULL)
+            return NULL;
+        header->Page = NULL;
+        header->LargeSize = size;
+        AllocCount++;
+        LargeAllocCount++;
+        BytesInUse += total_size;
+        BytesReserved += total_size;
+        return header + 1;
+    }
+
+    const int class_idx = ImPoolAllocatorSizeToClass(total_size);
+    ImGuiPoolAllocatorPage* page = _PartialPages[class_idx];
+    if (page == NULL)
+    {
+        page = ImPoolAllocatorAcquirePage(this);
+        if (page == NULL)
+            return NULL;
+        page->FreeSlots = NULL;
+        page->ClassIdx = class_idx;
+        page->SlotSize = ImPoolAllocatorClassSize(class_idx);
+        page->UsedSlots = 0;
+        page->BumpOffset = IM_POOL_PAGE_HEADER_SIZE;
+        page->InPartialList = true;
+        ImPoolAllocatorLinkPage(&_PartialPages[class_idx], page);
+    }
+
+    ImGuiPoolAllocatorHeader* header;
+    if (page->FreeSlots != NULL)
+    {
+        header = (ImGuiPoolAllocatorHeader*)page->FreeSlots;
+        page->FreeSlots = *(void**)page->FreeSlots;
+    }
+    else
+    {
+        header = (ImGuiPoolAllocatorHeader*)(void*)((char*)page + page->BumpOffset);
+        page->BumpOffset += page->SlotSize;
+    }
+    header->Page = page;
+    page->UsedSlots++;
+    if (page->FreeSlots == NULL && page->BumpOffset + page->SlotSize > IM_POOL_PAGE_SIZE)
+    {
+        ImPoolAllocatorUnlinkPage(&_PartialPages[class_idx], page);
+        page->InPartialList = false;
+    }
+    AllocCount++;
+    BytesInUse += (size_t)page->SlotSize;
+    return header + 1;
+}
+
+void ImGuiPoolAllocator::Free(void* ptr)
+{
+    if (ptr == NULL)
+        return;
+    ImGuiPoolAllocatorHeader* header = (ImGuiPoolAllocatorHeader*)ptr - 1;
+    ImGuiPoolAllocatorPage* page = header->Page;
+    IM_ASSERT(AllocCount > 0);
+    AllocCount--;
+    if (page == NULL)
+    {
+        const size_t total_size = header->LargeSize + sizeof(ImGuiPoolAllocatorHeader);
+        LargeAllocCount--;
+        BytesInUse -= total_size;
+        BytesReserved -= total_size;
+        ImPoolAllocatorHostFree(this, header);
+        return;
+    }
+
+    IM_ASSERT(page->ClassIdx >= 0 && page->UsedSlots > 0 && "Pointer wasn't allocated by this ImGuiPoolAllocator, or was already freed!");
+    *(void**)header = page->FreeSlots;
+    page->FreeSlots = header;
+    page->UsedSlots--;
+    BytesInUse -= (size_t)page->SlotSize;
+    if (page->UsedSlots == 0)
+    {
+        if (page->InPartialList)
+            ImPoolAllocatorUnlinkPage(&_PartialPages[page->ClassIdx], page);
+        page->InPartialList = false;
+        ImPoolAllocatorReleasePage(this, page);
+    }
+    else if (!page->InPartialList)
+    {
+        ImPoolAllocatorLinkPage(&_PartialPages[page->ClassIdx], page);
+        page->InPartialList = true;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO, ImGuiPlatformIO)
 //-----------------------------------------------------------------------------
@@ -1435,6 +1692,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigDrawListCulling = false;
+    ConfigMemoryBudget = 0;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugBeginReturnValueOnce = false;
@@ -2048,6 +2307,16 @@ const char* ImStrSkipBlank(const char* str)
     return str;
 }
 
+// On some platform vsnprintf() takes va_list by reference and modifies it.
+// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
+#ifndef va_copy
+#if defined(__GNUC__) || defined(__clang__)
+#define va_copy(dest, src) __builtin_va_copy(dest, src)
+#else
+#define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
 // A) MSVC version appears to return -1 on overflow, whereas glibc appears to return total count (which may be >= buf_size).
 // Ideally we would test for only one of those limits at runtime depending on the behavior the vsnprintf(), but trying to deduct it at compile time sounds like a pandora can of worm.
 // B) When buf==NULL vsnprintf() will return the output size.
@@ -2072,28 +2341,368 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
+// Built-in formatter for the printf subset commonly used with Dear ImGui, much faster than vsnprintf() on some platforms (e.g. Android's bionic).
+// - Handles %d %i %u %x %X %c %s %% %f %F %g %G, flags '-' '+' ' ' '0', width and precision (including '*') and length modifiers hh h l ll z t.
+// - %f/%g are printed exactly (correctly rounded, ties to even) when |v| * 10^digits fits in 64-bit and %g doesn't need the exponent form.
+// - Anything else (e.g. %e %p %a %o, '#' flag, positional arguments, NULL strings, inf/nan) returns -1: the caller then uses vsnprintf().
+// - Output is identical to vsnprintf() in the "C" locale: the decimal separator is always '.'.
+//   Define IMGUI_DISABLE_FAST_FORMAT_FUNCTIONS if you rely on setlocale(LC_NUMERIC, ...) changing it.
+#if !defined(IMGUI_USE_STB_SPRINTF) && !defined(IMGUI_DISABLE_FAST_FORMAT_FUNCTIONS)
+#define IMGUI_ENABLE_FAST_FORMAT
+
+struct ImFormatWriter
+{
+    char*   Buf;
+    size_t  BufSize;
+    size_t  Len;        // Total output length, may exceed BufSize (we always leave room for the zero terminator)
+
+    void    Write(const char* s, size_t n)  { if (Len + 1 < BufSize) memcpy(Buf + Len, s, ImMin(n, BufSize - 1 - Len)); Len += n; }
+    void    Fill(char c, int n)             { if (n <= 0) return; if (Len + 1 < BufSize) memset(Buf + Len, c, ImMin((size_t)n, BufSize - 1 - Len)); Len += (size_t)n; }
+};
+
+// Write 'sign' (0 if none), 'zeroes' leading zeroes then 'digits', padded to 'width' according to the '-' and '0' flags.
+static void ImFormatWritePadded(ImFormatWriter* w, char sign, int zeroes, const char* digits, int digits_len, int width, bool left_align, bool zero_pad)
+{
+    int len = (sign ? 1 : 0) + zeroes + digits_len;
+    if (zero_pad && !left_align && width > len)
+    {
+        zeroes += width - len;
+        len = width;
+    }
+    if (!left_align)
+        w->Fill(' ', width - len);
+    if (sign)
+        w->Write(&sign, 1);
+    w->Fill('0', zeroes);
+    w->Write(digits, (size_t)digits_len);
+    if (left_align)
+        w->Fill(' ', width - len);
+}
+
+// Write 'v' backward ending at 'buf_end', return pointer to first digit. Nothing is written for v == 0.
+static char* ImFormatU64Backward(char* buf_end, ImU64 v, unsigned int base, bool uppercase)
+{
+    const char* digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+    char* p = buf_end;
+    if (base == 16)
+        for (; v != 0; v >>= 4)
+            *--p = digits[v & 15];
+    else
+        for (; v != 0; v /= 10)
+            *--p = (char)('0' + (int)(v % 10));
+    return p;
+}
+
+// Round |v| * 10^scale to the nearest integer (ties to even) exactly, using v == m * 2^e and 10^scale == 5^scale * 2^scale.
+// Return false if the result doesn't fit in 64-bit.
+static bool ImFormatRoundScaled(double v, int scale, ImU64* out)
+{
+    static const ImU64 pow5[] = { 1ULL, 5ULL, 25ULL, 125ULL, 625ULL, 3125ULL, 15625ULL, 78125ULL, 390625ULL, 1953125ULL, 9765625ULL, 48828125ULL, 244140625ULL, 1220703125ULL, 6103515625ULL,
+        30517578125ULL, 152587890625ULL, 762939453125ULL, 3814697265625ULL, 19073486328125ULL, 95367431640625ULL, 476837158203125ULL, 2384185791015625ULL };
+    IM_ASSERT(scale >= 0 && scale < IM_ARRAYSIZE(pow5));
+    ImU64 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    const int exp_bits = (int)((bits >> 52) & 0x7FF);
+    ImU64 m = bits & ((1ULL << 52) - 1);
+    int e = -1074;
+    if (exp_bits != 0)
+    {
+        m |= 1ULL << 52;
+        e = exp_bits - 1075;
+    }
+    if (m == 0)
+    {
+        *out = 0;
+        return true;
+    }
+
+    // 128-bit product hi:lo = m * 5^scale (m < 2^53, 5^scale < 2^52)
+    const ImU64 p = pow5[scale];
+    const ImU64 m_lo = m & 0xFFFFFFFF, m_hi = m >> 32, p_lo = p & 0xFFFFFFFF, p_hi = p >> 32;
+    const ImU64 ll = m_lo * p_lo, lh = m_lo * p_hi, hl = m_hi * p_lo, hh = m_hi * p_hi;
+    const ImU64 mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    ImU64 lo = (ll & 0xFFFFFFFF) | (mid << 32);
+    ImU64 hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+
+    const int shift = e + scale;
+    if (shift >= 0)
+    {
+        if (hi != 0 || shift >= 64 || (shift > 0 && (lo >> (64 - shift)) != 0))
+            return false;
+        *out = lo << shift;
+        return true;
+    }
+
+    // Shift right by k, rounding to nearest even on the discarded bits
+    const int k = -shift;
+    if (k >= 128)
+    {
+        *out = 0; // hi:lo < 2^106 <= 2^(k-1)
+        return true;
+    }
+    ImU64 q;
+    if (k < 64)
+    {
+        if ((hi >> k) != 0)
+            return false;
+        q = (lo >> k) | (hi << (64 - k)); // 1 <= k < 64
+    }
+    else
+    {
+        q = (k == 64) ? hi : (hi >> (k - 64));
+    }
+    const int r = k - 1; // Rounding bit position
+    const bool round_bit = ((r < 64) ? (lo >> r) : (hi >> (r - 64))) & 1;
+    const bool sticky = (r == 0) ? false : (r <= 64) ? (lo & (~0ULL >> (64 - r))) != 0 : (lo != 0 || (hi & (~0ULL >> (128 - r))) != 0);
+    if (round_bit && (sticky || (q & 1)))
+        if (++q == 0)
+            return false;
+    *out = q;
+    return true;
+}
+
+// Return output length as vsnprintf() would, or -1 if the format isn't supported. 'args' is consumed either way.
+static int ImFormatStringFastV(char* buf, size_t buf_size, const char* fmt, va_list args)
+{
+    ImFormatWriter w = { buf, buf ? buf_size : 0, 0 };
+    char tmp[72]; // Enough for a 64-bit value in base 10 with up to 27 fractional digits and a decimal point
+    char* const tmp_end = tmp + IM_ARRAYSIZE(tmp);
+    for (const char* p = fmt; *p; )
+    {
+        // Literal text
+        if (*p != '%')
+        {
+            const char* lit_begin = p;
+            while (*p && *p != '%')
+                p++;
+            w.Write(lit_begin, (size_t)(p - lit_begin));
+            continue;
+        }
+        p++;
+        if (*p == '%')
+        {
+            w.Write(p++, 1);
+            continue;
+        }
+
+        // Flags
+        bool left_align = false, zero_pad = false;
+        char sign_pos = 0; // '+' or ' '
+        for (;; p++)
+        {
+            if (*p == '-')      left_align = true;
+            else if (*p == '0') zero_pad = true;
+            else if (*p == '+') sign_pos = '+';
+            else if (*p == ' ') { if (sign_pos == 0) sign_pos = ' '; }
+            else break;
+        }
+
+        // Width, precision
+        int width = 0, precision = -1;
+        if (*p == '*')
+        {
+            width = va_arg(args, int);
+            if (width < 0) { left_align = true; width = (width == INT_MIN) ? INT_MAX : -width; }
+            p++;
+        }
+        else
+        {
+            while (*p >= '0' && *p <= '9')
+                if ((width = width * 10 + (*p++ - '0')) > 4096)
+                    return -1;
+            if (*p == '$')
+                return -1; // Positional arguments
+        }
+        if (*p == '.')
+        {
+            p++;
+            precision = 0;
+            if (*p == '*')
+            {
+                precision = va_arg(args, int);
+                if (precision < 0)
+                    precision = -1;
+                p++;
+            }
+            else
+            {
+                while (*p >= '0' && *p <= '9')
+                    if ((precision = precision * 10 + (*p++ - '0')) > 4096)
+                        return -1;
+            }
+        }
+
+        // Length modifier
+        int length = 0; // 'H' for hh, 'h', 'l', 'L' for ll, 'z' (size_t and ptrdiff_t)
+        if (p[0] == 'h')        { length = (p[1] == 'h') ? 'H' : 'h'; p += (p[1] == 'h') ? 2 : 1; }
+        else if (p[0] == 'l')   { length = (p[1] == 'l') ? 'L' : 'l'; p += (p[1] == 'l') ? 2 : 1; }
+        else if (p[0] == 'z' || p[0] == 't') { length = 'z'; p++; }
+
+        const char conv = *p++;
+        switch (conv)
+        {
+        case 'd': case 'i': case 'u': case 'x': case 'X':
+        {
+            ImU64 v;
+            bool negative = false;
+            if (conv == 'd' || conv == 'i')
+            {
+                long long sv;
+                if (length == 'L')      sv = va_arg(args, long long);
+                else if (length == 'l') sv = va_arg(args, long);
+                else if (length == 'z') sv = va_arg(args, ptrdiff_t);
+                else if (length == 'h') sv = (short)va_arg(args, int);
+                else if (length == 'H') sv = (signed char)va_arg(args, int);
+                else                    sv = va_arg(args, int);
+                negative = sv < 0;
+                v = negative ? (ImU64)0 - (ImU64)sv : (ImU64)sv;
+            }
+            else
+            {
+                if (length == 'L')      v = va_arg(args, unsigned long long);
+                else if (length == 'l') v = va_arg(args, unsigned long);
+                else if (length == 'z') v = va_arg(args, size_t);
+                else if (length == 'h') v = (unsigned short)va_arg(args, unsigned int);
+                else if (length == 'H') v = (unsigned char)va_arg(args, unsigned int);
+                else                    v = va_arg(args, unsigned int);
+            }
+            const char* digits = ImFormatU64Backward(tmp_end, v, (conv == 'x' || conv == 'X') ? 16 : 10, conv == 'X');
+            int digits_len = (int)(tmp_end - digits);
+            if (precision < 0 && digits_len == 0)
+                digits_len = 1, digits = "0";
+            const char sign = negative ? '-' : (conv == 'd' || conv == 'i') ? sign_pos : 0;
+            ImFormatWritePadded(&w, sign, ImMax(precision - digits_len, 0), digits, digits_len, width, left_align, zero_pad && precision < 0);
+            break;
+        }
+        case 'f': case 'F': case 'g': case 'G':
+        {
+            if (length == 'L')
+                return -1;
+            const double v = va_arg(args, double);
+            ImU64 bits;
+            memcpy(&bits, &v, sizeof(bits));
+            if (((bits >> 52) & 0x7FF) == 0x7FF)
+                return -1; // inf, nan
+            const double v_abs = (bits >> 63) ? -v : v;
+            const char sign = (bits >> 63) ? '-' : sign_pos;
+            if (precision < 0)
+                precision = 6;
+
+            // Integer 'q' with 'frac_digits' implied decimals
+            ImU64 q;
+            int frac_digits = precision;
+            bool strip_zeroes = false;
+            if (conv == 'f' || conv == 'F')
+            {
+                if (precision > 22 || !ImFormatRoundScaled(v_abs, precision, &q))
+                    return -1;
+            }
+            else
+            {
+                // %g: style of %f with precision P-1-X when P > X >= -4, where X is the decimal exponent after rounding to P significant digits
+                const int sig_digits = (precision == 0) ? 1 : precision;
+                if (sig_digits > 18)
+                    return -1;
+                ImU64 pow10_lo = 1;
+                for (int n = 1; n < sig_digits; n++)
+                    pow10_lo *= 10;
+                int x = 0;
+                q = 0;
+                if (v_abs != 0.0)
+                {
+                    const int exp2 = (int)((bits >> 52) & 0x7FF) - 1023; // Subnormals have x < -4 anyway
+                    x = (exp2 * 78913) >> 18; // floor(exp2 * log10(2)), then adjust
+                    for (int attempt = 0; ; attempt++)
+                    {
+                        if (attempt == 3 || x < -4 || x >= sig_digits)
+                            return -1;
+                        if (!ImFormatRoundScaled(v_abs, sig_digits - 1 - x, &q))
+                            return -1;
+                        if (q < pow10_lo)           x--;
+                        else if (q / 10 >= pow10_lo) x++;
+                        else break;
+                    }
+                }
+                frac_digits = sig_digits - 1 - x;
+                strip_zeroes = true;
+            }
+
+            // Digits, decimal point
+            char* digits = ImFormatU64Backward(tmp_end, q, 10, false);
+            while (tmp_end - digits < frac_digits + 1)
+                *--digits = '0';
+            int digits_len = (int)(tmp_end - digits);
+            if (frac_digits > 0)
+            {
+                memmove(digits - 1, digits, (size_t)(digits_len - frac_digits));
+                digits--;
+                tmp_end[-frac_digits - 1] = '.';
+                digits_len++;
+                if (strip_zeroes)
+                {
+                    while (digits[digits_len - 1] == '0')
+                        digits_len--;
+                    if (digits[digits_len - 1] == '.')
+                        digits_len--;
+                }
+            }
+            ImFormatWritePadded(&w, sign, 0, digits, digits_len, width, left_align, zero_pad);
+            break;
+        }
+        case 'c':
+        {
+            if (length != 0 || zero_pad)
+                return -1;
+            const char c = (char)va_arg(args, int);
+            ImFormatWritePadded(&w, 0, 0, &c, 1, width, left_align, false);
+            break;
+        }
+        case 's':
+        {
+            if (length != 0 || zero_pad)
+                return -1;
+            const char* s = va_arg(args, const char*);
+            if (s == NULL)
+                return -1;
+            int s_len = 0;
+            if (precision < 0)
+                s_len = (int)strlen(s);
+            else
+                while (s_len < precision && s[s_len] != 0)
+                    s_len++;
+            ImFormatWritePadded(&w, 0, 0, s, s_len, width, left_align, false);
+            break;
+        }
+        default:
+            return -1;
+        }
+    }
+    if (w.Len > (size_t)INT_MAX)
+        return -1;
+    return (int)w.Len;
+}
+#endif // #ifdef IMGUI_ENABLE_FAST_FORMAT
+
 int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 {
     va_list args;
     va_start(args, fmt);
-#ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
-#else
-    int w = vsnprintf(buf, buf_size, fmt, args);
-#endif
+    int w = ImFormatStringV(buf, buf_size, fmt, args);
     va_end(args);
-    if (buf == NULL)
-        return w;
-    if (w == -1 || w >= (int)buf_size)
-        w = (int)buf_size - 1;
-    buf[w] = 0;
     return w;
 }
 
 int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 {
-#ifdef IMGUI_USE_STB_SPRINTF
+#if defined(IMGUI_USE_STB_SPRINTF)
     int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
+#elif defined(IMGUI_ENABLE_FAST_FORMAT)
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int w = ImFormatStringFastV(buf, buf_size, fmt, args_copy);
+    va_end(args_copy);
+    if (w < 0)
+        w = vsnprintf(buf, buf_size, fmt, args);
 #else
     int w = vsnprintf(buf, buf_size, fmt, args);
 #endif
@@ -2152,6 +2761,9 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
+// By default we use CRC-32 (polynomial 0x04C11DB7). With IMGUI_USE_CRC32C_HASH we use CRC-32C (polynomial 0x1EDC6F41) which x86 SSE 4.2 can compute,
+// but all IDs change: e.g. tables settings saved in .ini files by a build using the other polynomial won't be found.
+#ifndef IMGUI_USE_CRC32C_HASH
 static const ImU32 GCrc32LookupTable[256] =
 {
     0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
@@ -2171,6 +2783,167 @@ static const ImU32 GCrc32LookupTable[256] =
     0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
 };
+#else
+static const ImU32 GCrc32LookupTable[256] =
+{
+    0x00000000,0xF26B8303,0xE13B70F7,0x1350F3F4,0xC79A971F,0x35F1141C,0x26A1E7E8,0xD4CA64EB,0x8AD958CF,0x78B2DBCC,0x6BE22838,0x9989AB3B,0x4D43CFD0,0xBF284CD3,0xAC78BF27,0x5E133C24,
+    0x105EC76F,0xE235446C,0xF165B798,0x030E349B,0xD7C45070,0x25AFD373,0x36FF2087,0xC494A384,0x9A879FA0,0x68EC1CA3,0x7BBCEF57,0x89D76C54,0x5D1D08BF,0xAF768BBC,0xBC267848,0x4E4DFB4B,
+    0x20BD8EDE,0xD2D60DDD,0xC186FE29,0x33ED7D2A,0xE72719C1,0x154C9AC2,0x061C6936,0xF477EA35,0xAA64D611,0x580F5512,0x4B5FA6E6,0xB93425E5,0x6DFE410E,0x9F95C20D,0x8CC531F9,0x7EAEB2FA,
+    0x30E349B1,0xC288CAB2,0xD1D83946,0x23B3BA45,0xF779DEAE,0x05125DAD,0x1642AE59,0xE4292D5A,0xBA3A117E,0x4851927D,0x5B016189,0xA96AE28A,0x7DA08661,0x8FCB0562,0x9C9BF696,0x6EF07595,
+    0x417B1DBC,0xB3109EBF,0xA0406D4B,0x522BEE48,0x86E18AA3,0x748A09A0,0x67DAFA54,0x95B17957,0xCBA24573,0x39C9C670,0x2A993584,0xD8F2B687,0x0C38D26C,0xFE53516F,0xED03A29B,0x1F682198,
+    0x5125DAD3,0xA34E59D0,0xB01EAA24,0x42752927,0x96BF4DCC,0x64D4CECF,0x77843D3B,0x85EFBE38,0xDBFC821C,0x2997011F,0x3AC7F2EB,0xC8AC71E8,0x1C661503,0xEE0D9600,0xFD5D65F4,0x0F36E6F7,
+    0x61C69362,0x93AD1061,0x80FDE395,0x72966096,0xA65C047D,0x5437877E,0x4767748A,0xB50CF789,0xEB1FCBAD,0x197448AE,0x0A24BB5A,0xF84F3859,0x2C855CB2,0xDEEEDFB1,0xCDBE2C45,0x3FD5AF46,
+    0x7198540D,0x83F3D70E,0x90A324FA,0x62C8A7F9,0xB602C312,0x44694011,0x5739B3E5,0xA55230E6,0xFB410CC2,0x092A8FC1,0x1A7A7C35,0xE811FF36,0x3CDB9BDD,0xCEB018DE,0xDDE0EB2A,0x2F8B6829,
+    0x82F63B78,0x709DB87B,0x63CD4B8F,0x91A6C88C,0x456CAC67,0xB7072F64,0xA457DC90,0x563C5F93,0x082F63B7,0xFA44E0B4,0xE9141340,0x1B7F9043,0xCFB5F4A8,0x3DDE77AB,0x2E8E845F,0xDCE5075C,
+    0x92A8FC17,0x60C37F14,0x73938CE0,0x81F80FE3,0x55326B08,0xA759E80B,0xB4091BFF,0x466298FC,0x1871A4D8,0xEA1A27DB,0xF94AD42F,0x0B21572C,0xDFEB33C7,0x2D80B0C4,0x3ED04330,0xCCBBC033,
+    0xA24BB5A6,0x502036A5,0x4370C551,0xB11B4652,0x65D122B9,0x97BAA1BA,0x84EA524E,0x7681D14D,0x2892ED69,0xDAF96E6A,0xC9A99D9E,0x3BC21E9D,0xEF087A76,0x1D63F975,0x0E330A81,0xFC588982,
+    0xB21572C9,0x407EF1CA,0x532E023E,0xA145813D,0x758FE5D6,0x87E466D5,0x94B49521,0x66DF1622,0x38CC2A06,0xCAA7A905,0xD9F75AF1,0x2B9CD9F2,0xFF56BD19,0x0D3D3E1A,0x1E6DCDEE,0xEC064EED,
+    0xC38D26C4,0x31E6A5C7,0x22B65633,0xD0DDD530,0x0417B1DB,0xF67C32D8,0xE52CC12C,0x1747422F,0x49547E0B,0xBB3FFD08,0xA86F0EFC,0x5A048DFF,0x8ECEE914,0x7CA56A17,0x6FF599E3,0x9D9E1AE0,
+    0xD3D3E1AB,0x21B862A8,0x32E8915C,0xC083125F,0x144976B4,0xE622F5B7,0xF5720643,0x07198540,0x590AB964,0xAB613A67,0xB831C993,0x4A5A4A90,0x9E902E7B,0x6CFBAD78,0x7FAB5E8C,0x8DC0DD8F,
+    0xE330A81A,0x115B2B19,0x020BD8ED,0xF0605BEE,0x24AA3F05,0xD6C1BC06,0xC5914FF2,0x37FACCF1,0x69E9F0D5,0x9B8273D6,0x88D28022,0x7AB90321,0xAE7367CA,0x5C18E4C9,0x4F48173D,0xBD23943E,
+    0xF36E6F75,0x0105EC76,0x12551F82,0xE03E9C81,0x34F4F86A,0xC69F7B69,0xD5CF889D,0x27A40B9E,0x79B737BA,0x8BDCB4B9,0x988C474D,0x6AE7C44E,0xBE2DA0A5,0x4C4623A6,0x5F16D052,0xAD7D5351,
+};
+#endif
+
+// Hardware CRC32, giving the exact same results as the lookup table.
+// - AArch64: CRC32 instructions are optional in ARMv8.0. Used if __ARM_FEATURE_CRC32 is defined (e.g. -march=armv8-a+crc), otherwise checked at runtime on Linux/Android.
+// - x86/x64: SSE 4.2 only implements CRC-32C, so this is only used with IMGUI_USE_CRC32C_HASH. Checked at runtime unless __SSE4_2__ is defined.
+// - Define IMGUI_DISABLE_CRC32_INTRINSICS to always use the lookup table.
+#if !defined(IMGUI_DISABLE_CRC32_INTRINSICS) && defined(__aarch64__) && !defined(__AARCH64EB__) && (defined(__clang__) || defined(__GNUC__))
+#define IMGUI_ENABLE_CRC32_INTRINSICS
+#if defined(__ARM_FEATURE_CRC32)
+#define IM_CRC32_TARGET
+#define IM_CRC32_ALWAYS_AVAILABLE
+#elif defined(__linux__)
+#include <sys/auxv.h>   // getauxval()
+#ifndef AT_HWCAP
+#define AT_HWCAP        16
+#endif
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32     (1 << 7)
+#endif
+#define IM_CRC32_TARGET __attribute__((target(IM_CRC32_TARGET_FEATURE)))
+static bool ImCrc32DetectIntrinsics() { return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0; }
+#else
+#undef IMGUI_ENABLE_CRC32_INTRINSICS
+#endif
+#if defined(__clang__)
+#define IM_CRC32_TARGET_FEATURE "crc"
+#define IM_CRC32_U8(_CRC, _V)   (IM_CRC32_POLY_C ? __builtin_arm_crc32cb(_CRC, _V) : __builtin_arm_crc32b(_CRC, _V))
+#define IM_CRC32_U16(_CRC, _V)  (IM_CRC32_POLY_C ? __builtin_arm_crc32ch(_CRC, _V) : __builtin_arm_crc32h(_CRC, _V))
+#define IM_CRC32_U32(_CRC, _V)  (IM_CRC32_POLY_C ? __builtin_arm_crc32cw(_CRC, _V) : __builtin_arm_crc32w(_CRC, _V))
+#define IM_CRC32_U64(_CRC, _V)  (IM_CRC32_POLY_C ? __builtin_arm_crc32cd(_CRC, _V) : __builtin_arm_crc32d(_CRC, _V))
+#else
+#define IM_CRC32_TARGET_FEATURE "+crc"
+#define IM_CRC32_U8(_CRC, _V)   (IM_CRC32_POLY_C ? __builtin_aarch64_crc32cb(_CRC, _V) : __builtin_aarch64_crc32b(_CRC, _V))
+#define IM_CRC32_U16(_CRC, _V)  (IM_CRC32_POLY_C ? __builtin_aarch64_crc32ch(_CRC, _V) : __builtin_aarch64_crc32h(_CRC, _V))
+#define IM_CRC32_U32(_CRC, _V)  (IM_CRC32_POLY_C ? __builtin_aarch64_crc32cw(_CRC, _V) : __builtin_aarch64_crc32w(_CRC, _V))
+#define IM_CRC32_U64(_CRC, _V)  (IM_CRC32_POLY_C ? __builtin_aarch64_crc32cx(_CRC, _V) : __builtin_aarch64_crc32x(_CRC, _V))
+#endif
+#elif !defined(IMGUI_DISABLE_CRC32_INTRINSICS) && defined(IMGUI_USE_CRC32C_HASH) && defined(IMGUI_ENABLE_SSE) && (defined(__x86_64__) || defined(_M_X64))
+#define IMGUI_ENABLE_CRC32_INTRINSICS
+#include <nmmintrin.h>  // _mm_crc32_u8(), _mm_crc32_u64()
+#if defined(__SSE4_2__)
+#define IM_CRC32_TARGET
+#define IM_CRC32_ALWAYS_AVAILABLE
+#elif defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // __cpuid()
+#define IM_CRC32_TARGET
+static bool ImCrc32DetectIntrinsics() { int info[4]; __cpuid(info, 1); return (info[2] & (1 << 20)) != 0; }
+#else
+#define IM_CRC32_TARGET __attribute__((target("sse4.2")))
+static bool ImCrc32DetectIntrinsics() { __builtin_cpu_init(); return __builtin_cpu_supports("sse4.2") != 0; } // __builtin_cpu_init() needed when called from static constructors
+#endif
+#define IM_CRC32_U8(_CRC, _V)   _mm_crc32_u8(_CRC, _V)
+#define IM_CRC32_U16(_CRC, _V)  _mm_crc32_u16(_CRC, _V)
+#define IM_CRC32_U32(_CRC, _V)  _mm_crc32_u32(_CRC, _V)
+#define IM_CRC32_U64(_CRC, _V)  (ImU32)_mm_crc32_u64(_CRC, _V)
+#endif
+
+#ifdef IMGUI_ENABLE_CRC32_INTRINSICS
+#ifdef IMGUI_USE_CRC32C_HASH
+#define IM_CRC32_POLY_C         1
+#else
+#define IM_CRC32_POLY_C         0
+#endif
+
+static inline bool ImCrc32HasIntrinsics()
+{
+#ifdef IM_CRC32_ALWAYS_AVAILABLE
+    return true;
+#else
+    static const bool available = ImCrc32DetectIntrinsics(); // Thread-safe initialization
+    return available;
+#endif
+}
+
+// Load 'size' (< 8) bytes into the low bytes of a zero-padded word, in memory order (little-endian)
+static inline ImU64 ImCrc32LoadTail(const unsigned char* data, size_t size)
+{
+    ImU64 v = 0;
+    unsigned int shift = 0;
+    if (size & 4) { ImU32 w; memcpy(&w, data, 4); v = w; data += 4; shift = 32; }
+    if (size & 2) { ImU16 w; memcpy(&w, data, 2); v |= (ImU64)w << shift; data += 2; shift += 16; }
+    if (size & 1) { v |= (ImU64)*data << shift; }
+    return v;
+}
+
+// Hash the 'size' (< 8) low bytes of 'v', in memory order
+IM_CRC32_TARGET
+static inline ImU32 ImCrc32IntrinsicsTail(ImU32 crc, ImU64 v, size_t size)
+{
+    if (size & 4) { crc = IM_CRC32_U32(crc, (ImU32)v); v >>= 32; }
+    if (size & 2) { crc = IM_CRC32_U16(crc, (ImU16)v); v >>= 16; }
+    if (size & 1) { crc = IM_CRC32_U8(crc, (ImU8)v); }
+    return crc;
+}
+
+IM_CRC32_TARGET
+static ImU32 ImHashDataIntrinsics(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = IM_CRC32_U64(crc, v);
+    }
+    return data_size ? ImCrc32IntrinsicsTail(crc, ImCrc32LoadTail(data, data_size), data_size) : crc;
+}
+
+// Word-at-a-time: 8 bytes without any '#' are hashed at once, otherwise they go through the same per-byte loop as ImHashStr().
+IM_CRC32_TARGET
+static ImU32 ImHashStrIntrinsics(ImU32 seed, const unsigned char* data, size_t data_size)
+{
+    const ImU64 ones = 0x0101010101010101ULL;
+    ImU32 crc = seed;
+    while (data_size > 0)
+    {
+        const size_t chunk_size = data_size < 8 ? data_size : 8;
+        ImU64 v;
+        if (chunk_size == 8)
+            memcpy(&v, data, 8);
+        else
+            v = ImCrc32LoadTail(data, chunk_size); // Zero padding can't be mistaken for '#'
+        const ImU64 v_xor_hash = v ^ (ones * '#');
+        if (((v_xor_hash - ones) & ~v_xor_hash & (ones * 0x80)) == 0) // No byte equal to '#'
+        {
+            crc = (chunk_size == 8) ? IM_CRC32_U64(crc, v) : ImCrc32IntrinsicsTail(crc, v, chunk_size);
+            data += chunk_size;
+            data_size -= chunk_size;
+            continue;
+        }
+        for (size_t n = chunk_size; n > 0; n--)
+        {
+            unsigned char c = *data++;
+            data_size--;
+            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
+                crc = seed;
+            crc = IM_CRC32_U8(crc, c);
+        }
+    }
+    return crc;
+}
+#endif // #ifdef IMGUI_ENABLE_CRC32_INTRINSICS
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
@@ -2179,6 +2952,10 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 {
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#ifdef IMGUI_ENABLE_CRC32_INTRINSICS
+    if (ImCrc32HasIntrinsics())
+        return ~ImHashDataIntrinsics(crc, data, data_size);
+#endif
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data_size-- != 0)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
@@ -2196,6 +2973,10 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#ifdef IMGUI_ENABLE_CRC32_INTRINSICS
+    if (ImCrc32HasIntrinsics())
+        return ~ImHashStrIntrinsics(seed, data, data_size != 0 ? data_size : strlen(data_p));
+#endif
     const ImU32* crc32_lut = GCrc32LookupTable;
     if (data_size != 0)
     {
@@ -2219,6 +3000,20 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     return ~crc;
 }
 
+// Label hash with precomputed data (see ImGuiLabel), == ImHashStr(label.Text, 0, seed)
+// CRC is linear in its initial register: crc(reg, data) == reg * x^(8 * data_size) mod P ^ crc(0, data),
+// so we only need to multiply the seed register by label.SeedMul[1], which we do 4 bits at a time.
+// Shifting the product by 4 zero bits uses the byte table: GCrc32LookupTable[n << 4] == n * x^4 mod P.
+ImGuiID ImHashLabel(const ImGuiLabel& label, ImGuiID seed)
+{
+    const ImU32* crc32_lut = GCrc32LookupTable;
+    ImU32 reg = ~seed;
+    ImU32 crc = 0;
+    for (int n = 0; n < 8; n++, reg >>= 4)
+        crc = (crc >> 4) ^ crc32_lut[(crc & 0x0F) << 4] ^ label.SeedMul[reg & 0x0F];
+    return ~(crc ^ label.Hash);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -2315,6 +3110,11 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     static const uint32_t mins[] = { 0x400000, 0, 0x80, 0x800, 0x10000 };
     static const int shiftc[] = { 0, 18, 12, 6, 0 };
     static const int shifte[] = { 0, 6, 4, 2, 0 };
+    if (*(const unsigned char*)in_text < 0x80 && (in_text_end == NULL || in_text < in_text_end)) // Fast path for ASCII, same result as below
+    {
+        *out_char = *(const unsigned char*)in_text;
+        return 1;
+    }
     int len = lengths[*(const unsigned char*)in_text >> 3];
     int wanted = len + (len ? 0 : 1);
 
@@ -2360,14 +3160,105 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     return wanted;
 }
 
+// Helpers for ImTextStrFromUtf8() and ImTextCountCharsFromUtf8(), processing 16 bytes at a time (SSE2 on x86/x64, NEON on AArch64).
+// - ImTextIsAscii16() returns true when the 16 bytes are all in 0x01..0x7F, i.e. 16 single-byte characters and no zero terminator.
+// - ImTextWidenAscii16() writes those 16 bytes as ImWchar.
+#if defined(IMGUI_ENABLE_SSE)
+#define IMGUI_ENABLE_SIMD_UTF8
+static inline bool ImTextIsAscii16(const char* p)
+{
+    __m128i v = _mm_loadu_si128((const __m128i*)(const void*)p);
+    return _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, _mm_setzero_si128()))) == 0; // High bit set for bytes >= 0x80 or == 0
+}
+static inline void ImTextWidenAscii16(ImWchar* dst, const char* p)
+{
+    __m128i v = _mm_loadu_si128((const __m128i*)(const void*)p);
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(v, zero);
+    __m128i hi = _mm_unpackhi_epi8(v, zero);
+#ifdef IMGUI_USE_WCHAR32
+    _mm_storeu_si128((__m128i*)(void*)(dst + 0), _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(void*)(dst + 4), _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(void*)(dst + 8), _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128((__m128i*)(void*)(dst + 12), _mm_unpackhi_epi16(hi, zero));
+#else
+    _mm_storeu_si128((__m128i*)(void*)(dst + 0), lo);
+    _mm_storeu_si128((__m128i*)(void*)(dst + 8), hi);
+#endif
+}
+#elif defined(IMGUI_ENABLE_NEON)
+#define IMGUI_ENABLE_SIMD_UTF8
+static inline bool ImTextIsAscii16(const char* p)
+{
+    uint8x16_t v = vld1q_u8((const uint8_t*)p);
+    return vmaxvq_u8(vsubq_u8(v, vdupq_n_u8(1))) < 0x7F; // (byte - 1) wraps to >= 0x7F for bytes >= 0x80 or == 0
+}
+static inline void ImTextWidenAscii16(ImWchar* dst, const char* p)
+{
+    uint8x16_t v = vld1q_u8((const uint8_t*)p);
+    uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+    uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+#ifdef IMGUI_USE_WCHAR32
+    vst1q_u32((uint32_t*)(dst + 0), vmovl_u16(vget_low_u16(lo)));
+    vst1q_u32((uint32_t*)(dst + 4), vmovl_u16(vget_high_u16(lo)));
+    vst1q_u32((uint32_t*)(dst + 8), vmovl_u16(vget_low_u16(hi)));
+    vst1q_u32((uint32_t*)(dst + 12), vmovl_u16(vget_high_u16(hi)));
+#else
+    vst1q_u16((uint16_t*)(dst + 0), lo);
+    vst1q_u16((uint16_t*)(dst + 8), hi);
+#endif
+}
+#endif
+
+// Decode a well-formed 2 or 3 bytes sequence with all its bytes before 'in_text_end', return 0 for anything else.
+// This gives the same result as ImTextCharFromUtf8(), which remains in charge of 4 bytes sequences and decoding errors.
+static inline int ImTextCharFromUtf8Fast(unsigned int* out_char, const char* in_text, const char* in_text_end)
+{
+    const unsigned char* s = (const unsigned char*)in_text;
+    if ((s[0] & 0xE0) == 0xC0 && s[0] >= 0xC2 && in_text_end - in_text >= 2 && (s[1] & 0xC0) == 0x80)
+    {
+        *out_char = ((unsigned int)(s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+        return 2;
+    }
+    if ((s[0] & 0xF0) == 0xE0 && in_text_end - in_text >= 3 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80)
+    {
+        unsigned int c = ((unsigned int)(s[0] & 0x0F) << 12) | ((unsigned int)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        if (c < 0x800 || (c >> 11) == 0x1B) // Non-canonical encoding or surrogate half
+            return 0;
+        *out_char = c;
+        return 3;
+    }
+    return 0;
+}
+
+// When in_text_end == NULL, vectorized loads and the fast decoder are bounded by the zero terminator ('scan_end').
+// ImTextCharFromUtf8() may consume bytes past a zero terminator on invalid input: we then fall back to it until the end.
 int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
 {
     ImWchar* buf_out = buf;
     ImWchar* buf_end = buf + buf_size;
+    const char* scan_end = in_text_end ? in_text_end : in_text + strlen(in_text);
     while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
-        unsigned int c;
-        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+        unsigned int c = *(const unsigned char*)in_text;
+        if (c < 0x80)
+        {
+#ifdef IMGUI_ENABLE_SIMD_UTF8
+            if (scan_end - in_text >= 16 && buf_end - 1 - buf_out >= 16 && ImTextIsAscii16(in_text))
+            {
+                ImTextWidenAscii16(buf_out, in_text);
+                buf_out += 16;
+                in_text += 16;
+                continue;
+            }
+#endif
+            in_text++;
+        }
+        else
+        {
+            int len = (in_text < scan_end) ? ImTextCharFromUtf8Fast(&c, in_text, scan_end) : 0;
+            in_text += len ? len : ImTextCharFromUtf8(&c, in_text, in_text_end);
+        }
         *buf_out++ = (ImWchar)c;
     }
     *buf_out = 0;
@@ -2379,10 +3270,27 @@ int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const cha
 int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
 {
     int char_count = 0;
+    const char* scan_end = in_text_end ? in_text_end : in_text + strlen(in_text);
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
-        unsigned int c;
-        in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
+        unsigned int c = *(const unsigned char*)in_text;
+        if (c < 0x80)
+        {
+#ifdef IMGUI_ENABLE_SIMD_UTF8
+            if (scan_end - in_text >= 16 && ImTextIsAscii16(in_text))
+            {
+                char_count += 16;
+                in_text += 16;
+                continue;
+            }
+#endif
+            in_text++;
+        }
+        else
+        {
+            int len = (in_text < scan_end) ? ImTextCharFromUtf8Fast(&c, in_text, scan_end) : 0;
+            in_text += len ? len : ImTextCharFromUtf8(&c, in_text, in_text_end);
+        }
         char_count++;
     }
     return char_count;
@@ -2624,18 +3532,109 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+// Hashed mode: linear probing into _HashIndex[], kept at most half full. Storages with few pairs are scanned and don't allocate an index.
+static const int IM_STORAGE_HASH_INDEX_MIN_PAIRS = 16;
+
+static inline int StorageHashSlot(ImGuiID key, int mask)
+{
+    // Keys are generally already hashes, but IDs from PushID(int) and such are not: mix bits before masking.
+    key *= 0x9E3779B1u;
+    return (int)((key ^ (key >> 16)) & (ImU32)mask);
+}
+
+static void StorageHashIndexAdd(ImGuiStorage* storage, int data_idx)
+{
+    const int mask = storage->_HashIndex.Size - 1;
+    int slot = StorageHashSlot(storage->Data.Data[data_idx].key, mask);
+    while (storage->_HashIndex.Data[slot] != 0)
+        slot = (slot + 1) & mask;
+    storage->_HashIndex.Data[slot] = data_idx + 1;
+}
+
+static void StorageHashIndexRebuild(ImGuiStorage* storage)
+{
+    if (storage->Data.Size <= IM_STORAGE_HASH_INDEX_MIN_PAIRS)
+    {
+        storage->_HashIndex.clear();
+        return;
+    }
+    int index_size = 64;
+    while (index_size < storage->Data.Size * 4)
+        index_size <<= 1;
+    storage->_HashIndex.resize(index_size);
+    memset(storage->_HashIndex.Data, 0, (size_t)index_size * sizeof(int));
+    for (int data_idx = 0; data_idx < storage->Data.Size; data_idx++)
+        StorageHashIndexAdd(storage, data_idx);
+}
+
+// Return NULL when not found
+static ImGuiStoragePair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStoragePair* data_begin = const_cast<ImGuiStoragePair*>(storage->Data.Data);
+    ImGuiStoragePair* data_end = data_begin + storage->Data.Size;
+    if (!storage->_Hashed)
+    {
+        ImGuiStoragePair* it = ImLowerBound(data_begin, data_end, key);
+        return (it == data_end || it->key != key) ? NULL : it;
+    }
+    if (storage->_HashIndex.Size == 0)
+    {
+        for (ImGuiStoragePair* it = data_begin; it < data_end; it++)
+            if (it->key == key)
+                return it;
+        return NULL;
+    }
+    const int mask = storage->_HashIndex.Size - 1;
+    for (int slot = StorageHashSlot(key, mask); storage->_HashIndex.Data[slot] != 0; slot = (slot + 1) & mask)
+    {
+        ImGuiStoragePair* it = data_begin + storage->_HashIndex.Data[slot] - 1;
+        if (it->key == key)
+            return it;
+    }
+    return NULL;
+}
+
+// Return existing pair, or insert 'default_pair'
+static ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStoragePair& default_pair)
+{
+    if (!storage->_Hashed)
+    {
+        ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + storage->Data.Size, default_pair.key);
+        if (it == storage->Data.Data + storage->Data.Size || it->key != default_pair.key)
+            it = storage->Data.insert(it, default_pair);
+        return it;
+    }
+    if (ImGuiStoragePair* it = StorageFind(storage, default_pair.key))
+        return it;
+    storage->Data.push_back(default_pair);
+    if (storage->Data.Size * 2 > storage->_HashIndex.Size)
+        StorageHashIndexRebuild(storage); // Also handle transition from scanning to index
+    else
+        StorageHashIndexAdd(storage, storage->Data.Size - 1);
+    return &storage->Data.back();
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    if (_Hashed)
+        StorageHashIndexRebuild(this);
+}
+
+void ImGuiStorage::SetHashed(bool hashed)
+{
+    if (_Hashed == hashed)
+        return;
+    _Hashed = hashed;
+    _HashIndex.clear();
+    BuildSortByKey(); // Sorted mode requires sorted pairs, hashed mode needs its index built
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2645,27 +3644,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2675,28 +3667,18 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_i = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2706,20 +3688,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_f = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_p = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2830,16 +3804,6 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
 //-----------------------------------------------------------------------------
 
-// On some platform vsnprintf() takes va_list by reference and modifies it.
-// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
-#ifndef va_copy
-#if defined(__GNUC__) || defined(__clang__)
-#define va_copy(dest, src) __builtin_va_copy(dest, src)
-#else
-#define va_copy(dest, src) (dest = src)
-#endif
-#endif
-
 char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
@@ -2945,7 +3909,7 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height)
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height, int row_increase = -1)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
@@ -2964,7 +3928,8 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
+        if (row_increase < 0)
+            row_increase = (int)((off_y / line_height) + 0.5f);
         //table->CurrentRow += row_increase; // Can't do without fixing TableEndRow()
         table->RowBgColorCounter += row_increase;
     }
@@ -2998,6 +3963,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     ItemsCount = items_count;
     DisplayStart = -1;
     DisplayEnd = 0;
+    Heights = NULL;
 
     // Acquire temporary buffer
     if (++g.ClipperTempDataStacked > g.ClipperTempData.Size)
@@ -3009,6 +3975,20 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartSeekOffsetY = data->LossynessOffset;
 }
 
+// Variable-height items: positions are derived from the prefix sums stored in 'heights'.
+// ItemsHeight is set to the default height, so the clipper never needs to measure a first item to get started.
+void ImGuiListClipper::BeginWithHeights(int items_count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(heights != NULL && items_count >= 0 && items_count < INT_MAX && "Variable-height clipper needs to know the item count.");
+    if (Ctx == NULL)
+        Ctx = ImGui::GetCurrentContext();
+    if (heights->DefaultHeight <= 0.0f)
+        heights->DefaultHeight = ImGui::GetTextLineHeightWithSpacing();
+    heights->Resize(items_count);
+    Begin(items_count, heights->DefaultHeight);
+    Heights = heights;
+}
+
 void ImGuiListClipper::End()
 {
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
@@ -3048,6 +4028,17 @@ void ImGuiListClipper::SeekCursorForItem(int item_n)
     // - Perform the add and multiply with double to allow seeking through larger ranges.
     // - StartPosY starts from ItemsFrozen, by adding SeekOffsetY we generally cancel that out (SeekOffsetY == LossynessOffset - ItemsFrozen * ItemsHeight).
     // - The reason we store SeekOffsetY instead of inferring it, is because we want to allow user to perform Seek after the last step, where ImGuiListClipperData is already done.
+    if (Heights != NULL)
+    {
+        // Variable heights: row count can't be inferred from the distance, use the item the cursor is at instead.
+        IM_ASSERT(item_n >= 0 && item_n <= Heights->Size);
+        ImGuiListClipperData* data = (ImGuiListClipperData*)TempData;
+        float pos_y = (float)((double)StartPosY + StartSeekOffsetY + Heights->GetItemOffset(item_n));
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, (item_n > 0) ? Heights->GetItemHeight(item_n - 1) : ItemsHeight, data ? ImMax(item_n - data->CursorItemIdx, 0) : 0);
+        if (data)
+            data->CursorItemIdx = item_n;
+        return;
+    }
     float pos_y = (float)((double)StartPosY + StartSeekOffsetY + (double)item_n * ItemsHeight);
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, ItemsHeight);
 }
@@ -3063,6 +4054,16 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
 
+    // Variable heights: record actual height of the item displayed by previous step
+    ImGuiListClipperHeights* heights = clipper->Heights;
+    if (data->MeasureItemIdx >= 0)
+    {
+        if (data->MeasureItemIdx < heights->Size)
+            heights->SetItemHeight(data->MeasureItemIdx, ImMax(window->DC.CursorPos.y - data->MeasureItemPosY, 0.0f));
+        data->MeasureItemIdx = -1;
+    }
+    const bool measure_items = (heights != NULL && heights->MeasureItems);
+
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping())
         return false;
@@ -3075,6 +4076,11 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         clipper->DisplayEnd = ImMin(data->ItemsFrozen + 1, clipper->ItemsCount);
         if (clipper->DisplayStart < clipper->DisplayEnd)
             data->ItemsFrozen++;
+        if (measure_items && clipper->DisplayStart < clipper->DisplayEnd)
+        {
+            data->MeasureItemIdx = clipper->DisplayStart;
+            data->MeasureItemPosY = window->DC.CursorPos.y;
+        }
         return true;
     }
 
@@ -3117,7 +4123,10 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (calc_clipping)
     {
         // Record seek offset, this is so ImGuiListClipper::Seek() can be called after ImGuiListClipperData is done
-        clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
+        if (heights != NULL)
+            clipper->StartSeekOffsetY = (double)data->LossynessOffset - heights->GetItemOffset(data->ItemsFrozen);
+        else
+            clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
 
         if (g.LogEnabled)
         {
@@ -3166,11 +4175,22 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         // - Very important: when a starting position is after our maximum item, we set Min to (ItemsCount - 1). This allows us to handle most forms of wrapping.
         // - Due to how Selectable extra padding they tend to be "unaligned" with exact unit in the item list,
         //   which with the flooring/ceiling tend to lead to 2 items instead of one being submitted.
+        // - With variable heights, the cursor is at the start of item 'already_submitted', we look up items covering each position in the prefix sums.
+        const double heights_base_offset = heights ? heights->GetItemOffset(already_submitted) - window->DC.CursorPos.y - data->LossynessOffset : 0.0;
         for (ImGuiListClipperRange& range : data->Ranges)
             if (range.PosToIndexConvert)
             {
-                int m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
-                int m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                int m1, m2;
+                if (heights != NULL)
+                {
+                    m1 = heights->FindItemAtOffset(heights_base_offset + range.Min) - already_submitted;
+                    m2 = heights->FindItemAtOffset(heights_base_offset + range.Max) + 1 - already_submitted;
+                }
+                else
+                {
+                    m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
+                    m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                }
                 range.Min = ImClamp(already_submitted + m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
                 range.Max = ImClamp(already_submitted + m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
                 range.PosToIndexConvert = false;
@@ -3182,12 +4202,26 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     while (data->StepNo < data->Ranges.Size)
     {
         clipper->DisplayStart = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
-        clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
         if (clipper->DisplayStart > already_submitted) //-V1051
             clipper->SeekCursorForItem(clipper->DisplayStart);
-        data->StepNo++;
+        clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
+        if (measure_items && clipper->DisplayEnd - clipper->DisplayStart > 1)
+        {
+            // Variable heights: display items one by one so we can measure each of them. Next step carries on with the rest of the range.
+            clipper->DisplayEnd = clipper->DisplayStart + 1;
+            data->Ranges[data->StepNo].Min = clipper->DisplayEnd;
+        }
+        else
+        {
+            data->StepNo++;
+        }
         if (clipper->DisplayStart == clipper->DisplayEnd && data->StepNo < data->Ranges.Size)
             continue;
+        if (measure_items && clipper->DisplayStart < clipper->DisplayEnd)
+        {
+            data->MeasureItemIdx = clipper->DisplayStart;
+            data->MeasureItemPosY = window->DC.CursorPos.y;
+        }
         return true;
     }
 
@@ -3213,6 +4247,7 @@ bool ImGuiListClipper::Step()
     if (ret)
     {
         IMGUI_DEBUG_LOG_CLIPPER("Clipper: Step(): display %d to %d.\n", DisplayStart, DisplayEnd);
+        ((ImGuiListClipperData*)TempData)->CursorItemIdx = DisplayEnd; // Cursor will be after item DisplayEnd-1 once the caller has submitted the items
     }
     else
     {
@@ -3222,6 +4257,83 @@ bool ImGuiListClipper::Step()
     return ret;
 }
 
+ImGuiListClipperHeights::ImGuiListClipperHeights()
+{
+    Size = 0;
+    DefaultHeight = 0.0f;
+    MeasureItems = true;
+    UserData = NULL;
+    AdapterIndexToHeight = NULL;
+}
+
+void ImGuiListClipperHeights::Clear()
+{
+    Size = 0;
+    _Heights.clear();
+    _Tree.clear();
+}
+
+// Shrinking keeps the tree valid as is: nodes up to N only ever cover items up to N.
+// New nodes at the end are built from the nodes they cover, which is O(1) amortized per item.
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    const int old_size = Size;
+    _Heights.resize(items_count);
+    _Tree.resize(items_count + 1);
+    _Tree[0] = 0.0;
+    Size = items_count;
+    for (int idx = old_size; idx < items_count; idx++)
+    {
+        const float height = AdapterIndexToHeight ? AdapterIndexToHeight(this, idx) : DefaultHeight;
+        _Heights[idx] = height;
+        const int node = idx + 1;
+        double sum = height;
+        for (int child = node - 1; child > node - (node & -node); child -= (child & -child))
+            sum += _Tree[child];
+        _Tree[node] = sum;
+    }
+}
+
+void ImGuiListClipperHeights::SetItemHeight(int idx, float height)
+{
+    IM_ASSERT(idx >= 0 && idx < Size);
+    const double delta = (double)height - (double)_Heights[idx];
+    if (delta == 0.0)
+        return;
+    _Heights[idx] = height;
+    for (int node = idx + 1; node <= Size; node += (node & -node))
+        _Tree[node] += delta;
+}
+
+double ImGuiListClipperHeights::GetItemOffset(int idx) const
+{
+    IM_ASSERT(idx >= 0 && idx <= Size);
+    double offset = 0.0;
+    for (int node = idx; node > 0; node -= (node & -node))
+        offset += _Tree[node];
+    return offset;
+}
+
+// Descend the tree to find the number of items which entirely fit before 'offset', which is the index of the item covering it.
+// Node (idx + step) covers exactly 'step' items, which is how a constant spacing can be accounted for without storing it.
+int ImGuiListClipperHeights::FindItemAtOffset(double offset, float spacing) const
+{
+    if (Size == 0)
+        return 0;
+    int idx = 0;
+    int step = 1;
+    while (step * 2 <= Size)
+        step *= 2;
+    for (; step > 0; step >>= 1)
+        if (idx + step <= Size && _Tree[idx + step] + (double)spacing * step <= offset)
+        {
+            idx += step;
+            offset -= _Tree[idx] + (double)spacing * step;
+        }
+    return ImMin(idx, Size - 1);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -3533,7 +4645,11 @@ void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool
 
     if (text != text_display_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end);
+        ImFontShapedText* shaped_text = (g.CurrentItemFlags & ImGuiItemFlags_RetainedText) ? ShapedTextCacheGet(g.Font, g.FontSize, text, text_display_end) : NULL;
+        if (shaped_text)
+            window->DrawList->AddShapedText(shaped_text, pos, GetColorU32(ImGuiCol_Text));
+        else
+            window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_display_end);
     }
@@ -3584,7 +4700,12 @@ void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, co
     }
     else
     {
-        draw_list->AddText(NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, NULL);
+        ImGuiContext& g = *GImGui;
+        ImFontShapedText* shaped_text = (g.CurrentItemFlags & ImGuiItemFlags_RetainedText) ? ShapedTextCacheGet(draw_list->_Data->Font, draw_list->_Data->FontSize, text, text_display_end) : NULL;
+        if (shaped_text)
+            draw_list->AddShapedText(shaped_text, pos, GetColorU32(ImGuiCol_Text));
+        else
+            draw_list->AddText(NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, NULL);
     }
 }
 
@@ -3836,6 +4957,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     FrameCountEnded = FrameCountRendered = -1;
     WithinFrameScope = WithinFrameScopeWithImplicitWindow = WithinEndChild = false;
     GcCompactAll = false;
+    GcTrimLevel = GcTrimCount = 0;
+    GcMemoryCheckTime = 0.0;
     TestEngineHookItems = false;
     TestEngine = NULL;
     memset(ContextName, 0, sizeof(ContextName));
@@ -3956,6 +5079,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     CurrentTabBar = NULL;
     CurrentMultiSelect = NULL;
     MultiSelectTempDataStacked = 0;
+    CurrentTreeView = NULL;
 
     HoverItemDelayId = HoverItemDelayIdPreviousFrame = HoverItemUnlockedStationaryId = HoverWindowUnlockedStationaryId = 0;
     HoverItemDelayTimer = HoverItemDelayClearTimer = 0.0f;
@@ -4100,6 +5224,8 @@ void ImGui::Shutdown()
     }
     g.IO.Fonts = NULL;
     g.DrawListSharedData.TempBuffer.clear();
+    g.TextMeasureCache.ClearFreeMemory();
+    g.ShapedTextCache.Pool.Clear();
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -4228,7 +5354,11 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NUL
     DrawList = &DrawListInst;
     DrawList->_Data = &Ctx->DrawListSharedData;
     DrawList->_OwnerName = Name;
+    DrawList->_UseUploadArena = true;
     NavPreferredScoringPosRel[0] = NavPreferredScoringPosRel[1] = ImVec2(FLT_MAX, FLT_MAX);
+#ifndef IMGUI_DISABLE_HASHED_WINDOW_STORAGE
+    StateStorage.SetHashed(true); // Large trees may store thousands of open/close states
+#endif
 }
 
 ImGuiWindow::~ImGuiWindow()
@@ -4260,6 +5390,8 @@ void ImGui::GcCompactTransientMiscBuffers()
     g.GroupStack.clear();
     g.MultiSelectTempDataStacked = 0;
     g.MultiSelectTempData.clear_destruct();
+    g.TextMeasureCache.ClearFreeMemory();
+    g.ShapedTextCache.Pool.Clear();
     TableGcCompactSettings();
 }
 
@@ -4289,6 +5421,187 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+static size_t GetDrawListMemoryUsage(const ImDrawList* draw_list)
+{
+    size_t sz = ImVectorGetCapacityInBytes(draw_list->CmdBuffer) + ImVectorGetCapacityInBytes(draw_list->QuadBuffer);
+    if (draw_list->IdxBuffer.Data != draw_list->_IdxArenaData)
+        sz += ImVectorGetCapacityInBytes(draw_list->IdxBuffer);
+    if (draw_list->VtxBuffer.Data != draw_list->_VtxArenaData)
+        sz += ImVectorGetCapacityInBytes(draw_list->VtxBuffer);
+    sz += ImVectorGetCapacityInBytes(draw_list->_Path) + ImVectorGetCapacityInBytes(draw_list->_ClipRectStack) + ImVectorGetCapacityInBytes(draw_list->_TextureIdStack) + ImVectorGetCapacityInBytes(draw_list->_CallbacksDataBuf);
+    sz += ImVectorGetCapacityInBytes(draw_list->_Splitter._Channels);
+    for (const ImDrawChannel& channel : draw_list->_Splitter._Channels)
+        sz += ImVectorGetCapacityInBytes(channel._CmdBuffer) + ImVectorGetCapacityInBytes(channel._IdxBuffer);
+    return sz;
+}
+
+static size_t GetDrawListSplitterMemoryUsage(const ImDrawListSplitter* splitter)
+{
+    size_t sz = ImVectorGetCapacityInBytes(splitter->_Channels);
+    for (const ImDrawChannel& channel : splitter->_Channels)
+        sz += ImVectorGetCapacityInBytes(channel._CmdBuffer) + ImVectorGetCapacityInBytes(channel._IdxBuffer);
+    return sz;
+}
+
+// Estimate heap memory held by the current context. This walks all windows/tables/fonts so it is not free: NewFrame() only calls it when io.ConfigMemoryBudget is set, every io.ConfigMemoryCompactTimer seconds.
+ImGuiMemoryUsage ImGui::GetMemoryUsage()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMemoryUsage usage;
+
+    // Windows and their draw lists
+    usage.Windows += ImVectorGetCapacityInBytes(g.Windows) + ImVectorGetCapacityInBytes(g.WindowsFocusOrder) + ImVectorGetCapacityInBytes(g.WindowsTempSortBuffer) + ImVectorGetCapacityInBytes(g.WindowsById.Data);
+    for (ImGuiWindow* window : g.Windows)
+    {
+        usage.Windows += sizeof(ImGuiWindow) + strlen(window->Name) + 1;
+        usage.Windows += ImVectorGetCapacityInBytes(window->IDStack) + ImVectorGetCapacityInBytes(window->StateStorage.Data) + ImVectorGetCapacityInBytes(window->StateStorage._HashIndex) + ImVectorGetCapacityInBytes(window->ColumnsStorage);
+        for (const ImGuiOldColumns& columns : window->ColumnsStorage)
+            usage.Windows += ImVectorGetCapacityInBytes(columns.Columns) + GetDrawListSplitterMemoryUsage(&columns.Splitter);
+        usage.Windows += ImVectorGetCapacityInBytes(window->DC.ChildWindows) + ImVectorGetCapacityInBytes(window->DC.ItemWidthStack) + ImVectorGetCapacityInBytes(window->DC.TextWrapPosStack);
+        usage.DrawLists += GetDrawListMemoryUsage(window->DrawList);
+    }
+    for (ImGuiViewportP* viewport : g.Viewports)
+        for (ImDrawList* draw_list : viewport->BgFgDrawLists)
+            if (draw_list != NULL)
+                usage.DrawLists += sizeof(ImDrawList) + GetDrawListMemoryUsage(draw_list);
+
+    // Tables
+    usage.Tables += ImVectorGetCapacityInBytes(g.Tables.Buf) + ImVectorGetCapacityInBytes(g.Tables.Map.Data) + ImVectorGetCapacityInBytes(g.TablesLastTimeActive);
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+        {
+            if (table->RawData != NULL)
+                usage.Tables += (size_t)((char*)(void*)table->VisibleMaskByIndex - (char*)table->RawData) + ImBitArrayGetStorageSizeInBytes(table->ColumnsCount);
+            usage.Tables += ImVectorGetCapacityInBytes(table->ColumnsNames.Buf) + ImVectorGetCapacityInBytes(table->InstanceDataExtra) + ImVectorGetCapacityInBytes(table->SortSpecsMulti);
+        }
+    usage.Tables += ImVectorGetCapacityInBytes(g.TablesTempData) + ImVectorGetCapacityInBytes(g.DrawChannelsTempMergeBuffer);
+    for (const ImGuiTableTempData& table_temp_data : g.TablesTempData)
+        usage.Tables += GetDrawListSplitterMemoryUsage(&table_temp_data.DrawSplitter);
+
+    // Fonts
+    ImFontAtlas* atlas = g.IO.Fonts;
+    usage.Fonts += ImVectorGetCapacityInBytes(atlas->Fonts) + ImVectorGetCapacityInBytes(atlas->CustomRects) + ImVectorGetCapacityInBytes(atlas->ConfigData);
+    for (const ImFontConfig& font_cfg : atlas->ConfigData)
+        if (font_cfg.FontDataOwnedByAtlas)
+            usage.Fonts += (size_t)font_cfg.FontDataSize;
+    for (const ImFont* font : atlas->Fonts)
+        usage.Fonts += sizeof(ImFont) + ImVectorGetCapacityInBytes(font->IndexAdvanceX) + ImVectorGetCapacityInBytes(font->IndexLookup) + ImVectorGetCapacityInBytes(font->Glyphs);
+    if (atlas->TexPixelsAlpha8 != NULL)
+        usage.Fonts += (size_t)atlas->TexWidth * (size_t)atlas->TexHeight;
+    if (atlas->TexPixelsRGBA32 != NULL)
+        usage.Fonts += (size_t)atlas->TexWidth * (size_t)atlas->TexHeight * 4;
+
+    // Text caches
+    ImGuiTextMeasureCache& measure_cache = g.TextMeasureCache;
+    usage.TextCaches += ImVectorGetCapacityInBytes(measure_cache.Entries) + ImVectorGetCapacityInBytes(measure_cache.Map.Data) + ImVectorGetCapacityInBytes(measure_cache.SeenKeys.Data);
+    usage.TextCaches += ImVectorGetCapacityInBytes(measure_cache.TextBuf) + ImVectorGetCapacityInBytes(measure_cache.TextBufTemp);
+    ImPool<ImGuiShapedTextCacheEntry>& shaped_pool = g.ShapedTextCache.Pool;
+    usage.TextCaches += ImVectorGetCapacityInBytes(shaped_pool.Buf) + ImVectorGetCapacityInBytes(shaped_pool.Map.Data);
+    for (int n = 0; n < shaped_pool.GetMapSize(); n++)
+        if (ImGuiShapedTextCacheEntry* entry = shaped_pool.TryGetMapData(n))
+            usage.TextCaches += ImVectorGetCapacityInBytes(entry->Shaped.Glyphs) + ImVectorGetCapacityInBytes(entry->Text);
+
+    // Settings
+    usage.Settings += ImVectorGetCapacityInBytes(g.SettingsWindows.Buf) + ImVectorGetCapacityInBytes(g.SettingsTables.Buf) + ImVectorGetCapacityInBytes(g.SettingsIniData.Buf) + ImVectorGetCapacityInBytes(g.SettingsHandlers);
+
+    // Misc
+    usage.Misc += ImVectorGetCapacityInBytes(g.TempBuffer) + ImVectorGetCapacityInBytes(g.DrawListSharedData.TempBuffer);
+    usage.Misc += ImVectorGetCapacityInBytes(g.InputTextState.TextA) + ImVectorGetCapacityInBytes(g.InputTextState.TextToRevertTo) + ImVectorGetCapacityInBytes(g.InputTextState.CallbackTextBackup);
+    usage.Misc += ImVectorGetCapacityInBytes(g.InputEventsQueue) + ImVectorGetCapacityInBytes(g.InputEventsTrail) + ImVectorGetCapacityInBytes(g.CurrentWindowStack);
+    usage.Misc += ImVectorGetCapacityInBytes(g.ColorStack) + ImVectorGetCapacityInBytes(g.StyleVarStack) + ImVectorGetCapacityInBytes(g.FontStack) + ImVectorGetCapacityInBytes(g.FocusScopeStack) + ImVectorGetCapacityInBytes(g.ItemFlagsStack) + ImVectorGetCapacityInBytes(g.GroupStack);
+    usage.Misc += ImVectorGetCapacityInBytes(g.OpenPopupStack) + ImVectorGetCapacityInBytes(g.BeginPopupStack) + ImVectorGetCapacityInBytes(g.TreeNodeStack) + ImVectorGetCapacityInBytes(g.NavFocusRoute);
+    usage.Misc += ImVectorGetCapacityInBytes(g.ClipperTempData) + ImVectorGetCapacityInBytes(g.ShrinkWidthBuffer) + ImVectorGetCapacityInBytes(g.MultiSelectTempData) + ImVectorGetCapacityInBytes(g.MenusIdSubmittedThisFrame);
+    usage.Misc += ImVectorGetCapacityInBytes(g.DragDropPayloadBufHeap) + ImVectorGetCapacityInBytes(g.ClipboardHandlerData) + ImVectorGetCapacityInBytes(g.LogBuffer.Buf);
+    usage.Misc += ImVectorGetCapacityInBytes(g.DebugLogBuf.Buf) + ImVectorGetCapacityInBytes(g.DebugLogIndex.LineOffsets);
+
+    usage.Total = usage.Windows + usage.DrawLists + usage.Tables + usage.Fonts + usage.TextCaches + usage.Settings + usage.Misc;
+    return usage;
+}
+
+// Trim memory held by the context when it exceeds io.ConfigMemoryBudget. Called by NewFrame() after the regular garbage collection.
+// Usage is measured at most once every io.ConfigMemoryCompactTimer seconds (or on a full GC request), as GetMemoryUsage() walks all windows and tables.
+// Steps are increasingly aggressive (and costly to recover from), we stop as soon as usage fits the budget.
+// Buffers used by last frame are only shrunk to their last frame size, never cleared, so a budget lower than what a frame needs won't make them regrow every frame:
+// check g.GcTrimLevel in Metrics and leave some headroom.
+void ImGui::GcTrimToMemoryBudget()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.IO.ConfigMemoryBudget == 0)
+        return;
+    const float check_interval = (g.IO.ConfigMemoryCompactTimer >= 0.0f) ? g.IO.ConfigMemoryCompactTimer : FLT_MAX;
+    if (!g.GcCompactAll && g.Time - g.GcMemoryCheckTime < check_interval)
+        return;
+    g.GcMemoryCheckTime = g.Time;
+    g.GcTrimLevel = 0;
+    g.GcMemoryUsage = GetMemoryUsage();
+    if (g.GcMemoryUsage.Total <= g.IO.ConfigMemoryBudget)
+        return;
+    g.GcTrimCount++;
+    for (int level = 1; level <= 4 && g.GcMemoryUsage.Total > g.IO.ConfigMemoryBudget; level++)
+    {
+        g.GcTrimLevel = level;
+        if (level == 1)
+        {
+            // Shrink storages which are over-sized compared to their last use
+            for (ImGuiWindow* window : g.Windows)
+            {
+                ImVectorTrimCapacity(window->IDStack);
+                ImVectorTrimCapacity(window->StateStorage.Data);
+                ImVectorTrimCapacity(window->DC.ChildWindows);
+            }
+            for (ImGuiViewportP* viewport : g.Viewports)
+                for (ImDrawList* draw_list : viewport->BgFgDrawLists)
+                    if (draw_list != NULL)
+                        draw_list->_TrimFreeMemory();
+            for (int n = 0; n < g.Tables.GetMapSize(); n++)
+                if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+                    ImVectorTrimCapacity(table->ColumnsNames.Buf);
+            ImVectorTrimCapacity(g.WindowsById.Data);
+            ImVectorTrimCapacity(g.TextMeasureCache.Map.Data);
+            ImVectorTrimCapacity(g.TextMeasureCache.SeenKeys.Data);
+            ImVectorTrimCapacity(g.TextMeasureCache.TextBufTemp);
+            ImVectorTrimCapacity(g.TempBuffer);
+            ImVectorTrimCapacity(g.DrawListSharedData.TempBuffer);
+            ImVectorTrimCapacity(g.DrawChannelsTempMergeBuffer);
+        }
+        else if (level == 2)
+        {
+            // Compact windows and tables which were not used last frame, without waiting for io.ConfigMemoryCompactTimer
+            for (ImGuiWindow* window : g.Windows)
+                if (!window->WasActive && !window->MemoryCompacted)
+                    GcCompactTransientWindowBuffers(window);
+            for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
+                if (g.TablesLastTimeActive[i] >= 0.0f && g.Tables.GetByIndex(i)->LastFrameActive < g.FrameCount - 1)
+                    TableGcCompactTransientBuffers(g.Tables.GetByIndex(i));
+        }
+        else if (level == 3)
+        {
+            // Shrink draw lists of windows used last frame to their last frame size, drop caches and shared transient buffers
+            for (ImGuiWindow* window : g.Windows)
+                if (window->WasActive)
+                    window->DrawList->_TrimFreeMemory();
+            GcCompactTransientMiscBuffers();
+            for (ImGuiTableTempData& table_temp_data : g.TablesTempData)
+                TableGcCompactTransientBuffers(&table_temp_data);
+        }
+        else if (level == 4)
+        {
+            // Free CPU copy of the font atlas texture once the backend has uploaded it.
+            // If the backend ever needs to recreate its texture, GetTexDataAsXXX() will rebuild the atlas from the source font data.
+            // (we don't use ClearTexData() as the atlas is locked during the frame, and we want to preserve TexPixelsUseColors)
+            ImFontAtlas* atlas = g.IO.Fonts;
+            if (atlas->TexID != 0 && atlas->TexReady)
+            {
+                IM_FREE(atlas->TexPixelsAlpha8);
+                IM_FREE(atlas->TexPixelsRGBA32);
+                atlas->TexPixelsAlpha8 = NULL;
+                atlas->TexPixelsRGBA32 = NULL;
+            }
+        }
+        g.GcMemoryUsage = GetMemoryUsage();
+    }
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -4777,6 +6090,7 @@ static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t draw
     {
         draw_list = IM_NEW(ImDrawList)(&g.DrawListSharedData);
         draw_list->_OwnerName = drawlist_name;
+        draw_list->_UseUploadArena = true;
         viewport->BgFgDrawLists[drawlist_no] = draw_list;
     }
 
@@ -5044,6 +6358,21 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasQuadInstances)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_QuadInstances;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasShapeInstances)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_ShapeInstances;
+    if (g.IO.ConfigDrawListCulling)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_CullToClipRect;
+
+    // Backend may provide GPU-visible memory for vertices/indices. Its current region is reused for this frame's draw lists.
+    ImDrawUploadArena* upload_arena = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasUploadArena) ? g.PlatformIO.Renderer_UploadArena : NULL;
+    if (upload_arena != NULL)
+    {
+        IM_ASSERT(upload_arena->Data != NULL && upload_arena->FrameBegin <= upload_arena->FrameEnd && upload_arena->FrameEnd <= upload_arena->Size);
+        upload_arena->FrameUsed = upload_arena->FrameBegin;
+    }
+    g.DrawListSharedData.UploadArena = upload_arena;
 }
 
 void ImGui::NewFrame()
@@ -5091,6 +6420,8 @@ void ImGui::NewFrame()
     SetupDrawListSharedData();
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
+    TextMeasureCacheNewFrame();
+    ShapedTextCacheNewFrame();
 
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (ImGuiViewportP* viewport : g.Viewports)
@@ -5254,6 +6585,7 @@ void ImGui::NewFrame()
             TableGcCompactTransientBuffers(&table_temp_data);
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
+    GcTrimToMemoryBudget();
     g.GcCompactAll = false;
 
     // Closing the focused window restore focus to the first active root window in descending z-order
@@ -5346,6 +6678,8 @@ static void AddWindowToDrawData(ImGuiWindow* window, int layer)
     g.IO.MetricsRenderWindows++;
     if (window->DrawList->_Splitter._Count > 1)
         window->DrawList->ChannelsMerge(); // Merge if user forgot to merge back. Also required in Docking branch for ImGuiWindowFlags_DockNodeHost windows.
+    if (window->SkipRefresh)
+        window->DrawList->_MoveUploadArenaToHeap(); // Draw list from a previous frame: its ImDrawUploadArena region will be recycled
     ImGui::AddDrawListToDrawDataEx(&viewport->DrawDataP, viewport->DrawDataBuilder.Layers[layer], window->DrawList);
     for (ImGuiWindow* child : window->DC.ChildWindows)
         if (IsWindowActiveAndVisible(child)) // Clipped children may have been marked not active
@@ -5393,7 +6727,7 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
 
     draw_data->Valid = true;
     draw_data->CmdListsCount = 0;
-    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = draw_data->TotalQuadCount = 0;
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
@@ -5439,7 +6773,10 @@ static void ImGui::RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32
         if (draw_list->CmdBuffer.Size == 0)
             draw_list->AddDrawCmd();
         draw_list->PushClipRect(viewport_rect.Min - ImVec2(1, 1), viewport_rect.Max + ImVec2(1, 1), false); // FIXME: Need to stricty ensure ImDrawCmd are not merged (ElemCount==6 checks below will verify that)
+        ImDrawListFlags backup_flags = draw_list->Flags;
+        draw_list->Flags &= ~ImDrawListFlags_QuadInstances; // Always output triangles so the ElemCount==6 check below holds.
         draw_list->AddRectFilled(viewport_rect.Min, viewport_rect.Max, col);
+        draw_list->Flags = backup_flags;
         ImDrawCmd cmd = draw_list->CmdBuffer.back();
         IM_ASSERT(cmd.ElemCount == 6);
         draw_list->CmdBuffer.pop_back();
@@ -5644,7 +6981,7 @@ void ImGui::Render()
         RenderMouseCursor(g.IO.MousePos, g.Style.MouseCursorScale, g.MouseCursor, IM_COL32_WHITE, IM_COL32_BLACK, IM_COL32(0, 0, 0, 48));
 
     // Setup ImDrawData structures for end-user
-    g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = g.IO.MetricsRenderCulled = 0;
     for (ImGuiViewportP* viewport : g.Viewports)
     {
         FlattenDrawDataIntoSingleLayer(&viewport->DrawDataBuilder);
@@ -5657,7 +6994,10 @@ void ImGui::Render()
         ImDrawData* draw_data = &viewport->DrawDataP;
         IM_ASSERT(draw_data->CmdLists.Size == draw_data->CmdListsCount);
         for (ImDrawList* draw_list : draw_data->CmdLists)
+        {
             draw_list->_PopUnusedDrawCmd();
+            g.IO.MetricsRenderCulled += draw_list->_CulledCount;
+        }
 
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
@@ -5666,6 +7006,165 @@ void ImGui::Render()
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
+// Called by NewFrame(): rotate statistics, invalidate on atlas rebuild, evict unused entries.
+void ImGui::TextMeasureCacheNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextMeasureCache* cache = &g.TextMeasureCache;
+    cache->StatHits[1] = cache->StatHits[0];
+    cache->StatMisses[1] = cache->StatMisses[0];
+    cache->StatBytesSaved[1] = cache->StatBytesSaved[0];
+    cache->StatHits[0] = cache->StatMisses[0] = cache->StatBytesSaved[0] = 0;
+
+    if (cache->AtlasBuildGeneration != g.IO.Fonts->BuildGeneration)
+    {
+        cache->Clear();
+        cache->AtlasBuildGeneration = g.IO.Fonts->BuildGeneration;
+    }
+    if (cache->SeenKeys.Data.Size > cache->Capacity * 4)
+        cache->SeenKeys.Data.resize(0); // Keep capacity: Clear() would free it
+
+    // Evict entries which haven't been used in the last few frames, once we are getting close to capacity.
+    if (cache->Entries.Size < cache->Capacity - cache->Capacity / 8)
+        return;
+    const int frame_cutoff = g.FrameCount - 2;
+    int dst_n = 0;
+    cache->Map.Data.resize(0);
+    cache->TextBufTemp.resize(0);
+    for (int src_n = 0; src_n < cache->Entries.Size; src_n++)
+    {
+        ImGuiTextMeasureCacheEntry entry = cache->Entries[src_n];
+        if (entry.LastFrameUsed < frame_cutoff)
+        {
+            cache->StatEvictions++;
+            continue;
+        }
+        const int text_offset = cache->TextBufTemp.Size;
+        cache->TextBufTemp.resize(text_offset + entry.TextLen);
+        memcpy(cache->TextBufTemp.Data + text_offset, cache->TextBuf.Data + entry.TextOffset, (size_t)entry.TextLen);
+        entry.TextOffset = text_offset;
+        cache->Entries[dst_n] = entry;
+        cache->Map.Data.push_back(ImGuiStoragePair(entry.Key, dst_n + 1));
+        dst_n++;
+    }
+    cache->Entries.resize(dst_n);
+    cache->TextBuf.swap(cache->TextBufTemp);
+    cache->Map.BuildSortByKey();
+}
+
+// Return cached measurement for a given text, or NULL if the text hasn't been admitted in the cache (yet).
+// Text is only admitted after it has been seen on a previous frame: strings that change every frame will never be stored.
+const ImGuiTextMeasureCacheEntry* ImGui::TextMeasureCacheLookup(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextMeasureCache* cache = &g.TextMeasureCache;
+    const int text_len = (int)(text_end - text);
+    if (cache->Capacity <= 0 || text_len > cache->TextLenMax)
+        return NULL;
+
+    struct { ImFont* Font; float FontSize; float WrapWidth; } key_data = { font, font_size, wrap_width };
+    const ImGuiID key = ImHashData(text, (size_t)text_len, ImHashData(&key_data, sizeof(key_data)));
+    if (int idx = cache->Map.GetInt(key, 0))
+    {
+        ImGuiTextMeasureCacheEntry* entry = &cache->Entries[idx - 1];
+        if (entry->TextLen == text_len && memcmp(cache->TextBuf.Data + entry->TextOffset, text, (size_t)text_len) == 0)
+        {
+            entry->LastFrameUsed = g.FrameCount;
+            cache->StatHits[0]++;
+            cache->StatBytesSaved[0] += text_len;
+            return entry;
+        }
+        cache->StatMisses[0]++;
+        return NULL; // Hash collision with another text: keep the existing entry
+    }
+    cache->StatMisses[0]++;
+
+    // Admission filter
+    int* first_seen_frame = cache->SeenKeys.GetIntRef(key, -1);
+    if (*first_seen_frame == -1)
+        *first_seen_frame = g.FrameCount;
+    if (*first_seen_frame == g.FrameCount || cache->Entries.Size >= cache->Capacity)
+        return NULL;
+
+    ImGuiTextMeasureCacheEntry entry;
+    entry.Key = key;
+    entry.TextOffset = cache->TextBuf.Size;
+    entry.TextLen = text_len;
+    entry.LastFrameUsed = g.FrameCount;
+    entry.Size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_end, NULL);
+    cache->TextBuf.resize(entry.TextOffset + text_len);
+    memcpy(cache->TextBuf.Data + entry.TextOffset, text, (size_t)text_len);
+    cache->Entries.push_back(entry);
+    cache->Map.SetInt(key, cache->Entries.Size);
+    return &cache->Entries.back();
+}
+
+// Called by NewFrame(): rotate statistics, invalidate on atlas rebuild, release labels which haven't been rendered for a while.
+void ImGui::ShapedTextCacheNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiShapedTextCache* cache = &g.ShapedTextCache;
+    cache->StatHits[1] = cache->StatHits[0];
+    cache->StatMisses[1] = cache->StatMisses[0];
+    cache->StatGlyphs[1] = cache->StatGlyphs[0];
+    cache->StatHits[0] = cache->StatMisses[0] = cache->StatGlyphs[0] = 0;
+
+    if (cache->AtlasBuildGeneration != g.IO.Fonts->BuildGeneration)
+    {
+        cache->Pool.Clear();
+        cache->AtlasBuildGeneration = g.IO.Fonts->BuildGeneration;
+    }
+    if ((g.FrameCount % 60) != 0)
+        return;
+    const int frame_cutoff = g.FrameCount - 120;
+    for (int n = 0; n < cache->Pool.GetMapSize(); n++)
+        if (ImGuiShapedTextCacheEntry* entry = cache->Pool.TryGetMapData(n))
+            if (entry->LastFrameUsed < frame_cutoff)
+                cache->Pool.Remove(cache->Pool.Map.Data[n].key, entry);
+
+    // ImPool::Remove() leaves a -1 entry in the map for each released label: drop them, otherwise the map would keep growing
+    // with every distinct label ever rendered. Removing pairs keeps the map sorted.
+    ImVector<ImGuiStoragePair>& map_data = cache->Pool.Map.Data;
+    int dst_n = 0;
+    for (int src_n = 0; src_n < map_data.Size; src_n++)
+        if (map_data[src_n].val_i != -1)
+            map_data[dst_n++] = map_data[src_n];
+    map_data.resize(dst_n);
+}
+
+// Return pre-shaped glyph quads for a given label, or NULL if the cache is full/disabled.
+// Caller is expected to only use this for static text, as every new string gets shaped and stored.
+ImFontShapedText* ImGui::ShapedTextCacheGet(ImFont* font, float font_size, const char* text, const char* text_end)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiShapedTextCache* cache = &g.ShapedTextCache;
+    if (cache->Capacity <= 0)
+        return NULL;
+
+    struct { ImFont* Font; float FontSize; } key_data = { font, font_size };
+    const int text_len = (int)(text_end - text);
+    const ImGuiID key = ImHashData(text, (size_t)text_len, ImHashData(&key_data, sizeof(key_data)));
+    ImGuiShapedTextCacheEntry* entry = cache->Pool.GetByKey(key);
+    if (entry != NULL && entry->Text.Size == text_len && memcmp(entry->Text.Data, text, (size_t)text_len) == 0)
+    {
+        cache->StatHits[0]++;
+    }
+    else
+    {
+        if (entry == NULL && cache->Pool.GetAliveCount() >= cache->Capacity)
+            return NULL;
+        cache->StatMisses[0]++;
+        if (entry == NULL)
+            entry = cache->Pool.GetOrAddByKey(key);
+        entry->Text.resize(text_len);
+        memcpy(entry->Text.Data, text, (size_t)text_len);
+        font->ShapeText(&entry->Shaped, font_size, text, text_end);
+    }
+    entry->LastFrameUsed = g.FrameCount;
+    cache->StatGlyphs[0] += entry->Shaped.Glyphs.Size;
+    return &entry->Shaped;
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -5682,7 +7181,13 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    if (text_display_end == NULL)
+        text_display_end = text + strlen(text);
+    ImVec2 text_size;
+    if (const ImGuiTextMeasureCacheEntry* entry = TextMeasureCacheLookup(font, font_size, wrap_width, text, text_display_end))
+        text_size = entry->Size;
+    else
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -7472,7 +8977,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
                 // - We disable this when the parent window has zero vertices, which is a common pattern leading to laying out multiple overlapping childs
                 ImGuiWindow* previous_child = parent_window->DC.ChildWindows.Size >= 2 ? parent_window->DC.ChildWindows[parent_window->DC.ChildWindows.Size - 2] : NULL;
                 bool previous_child_overlapping = previous_child ? previous_child->Rect().Overlaps(window->Rect()) : false;
-                bool parent_is_empty = (parent_window->DrawList->VtxBuffer.Size == 0);
+                bool parent_is_empty = (parent_window->DrawList->VtxBuffer.Size == 0 && parent_window->DrawList->QuadBuffer.Size == 0);
                 if (window->DrawList->CmdBuffer.back().ElemCount == 0 && !parent_is_empty && !previous_child_overlapping)
                     render_decorations_in_parent = true;
             }
@@ -8692,6 +10197,18 @@ ImGuiID ImGuiWindow::GetID(int n)
     return id;
 }
 
+ImGuiID ImGuiWindow::GetID(const ImGuiLabel& label)
+{
+    ImGuiID seed = IDStack.back();
+    ImGuiID id = ImHashLabel(label, seed);
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    ImGuiContext& g = *Ctx;
+    if (g.DebugHookIdInfo == id)
+        ImGui::DebugHookIdInfo(id, ImGuiDataType_String, label.Text, NULL);
+#endif
+    return id;
+}
+
 // This is only used in rare/specific situations to manufacture an ID out of nowhere.
 // FIXME: Consider instead storing last non-zero ID + count of successive zero-ID, and combine those?
 ImGuiID ImGuiWindow::GetIDFromPos(const ImVec2& p_abs)
@@ -8743,6 +10260,14 @@ void ImGui::PushID(int int_id)
     window->IDStack.push_back(id);
 }
 
+void ImGui::PushID(const ImGuiLabel& str_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiID id = window->GetID(str_id);
+    window->IDStack.push_back(id);
+}
+
 // Push a given id value ignoring the ID stack as a seed.
 void ImGui::PushOverrideID(ImGuiID id)
 {
@@ -8803,6 +10328,12 @@ ImGuiID ImGui::GetID(const char* str_id_begin, const char* str_id_end)
     return window->GetID(str_id_begin, str_id_end);
 }
 
+ImGuiID ImGui::GetID(const ImGuiLabel& str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    return window->GetID(str_id);
+}
+
 ImGuiID ImGui::GetID(const void* ptr_id)
 {
     ImGuiWindow* window = GImGui->CurrentWindow;
@@ -15241,7 +16772,9 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         Text("(Context Name: \"%s\")", g.ContextName);
     }
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
-    Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+    Text("%d vertices, %d indices (%d triangles), %d primitives culled", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3, io.MetricsRenderCulled);
+    if (ImDrawUploadArena* upload_arena = g.DrawListSharedData.UploadArena)
+        Text("Upload arena: %d/%d KB used by vertices/indices", (int)((upload_arena->FrameUsed - upload_arena->FrameBegin) / 1024), (int)((upload_arena->FrameEnd - upload_arena->FrameBegin) / 1024));
     Text("%d visible windows, %d current allocations", io.MetricsRenderWindows, g.DebugAllocInfo.TotalAllocCount - g.DebugAllocInfo.TotalFreeCount);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
@@ -15584,6 +17117,21 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     {
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
+        if (GImAllocatorAllocFunc == ImGuiPoolAllocator::AllocFunc)
+        {
+            ImGuiPoolAllocator* pool = (ImGuiPoolAllocator*)GImAllocatorUserData;
+            Text("Pool allocator: %d KB used, %d KB reserved from host (%.0f%% utilization)", (int)(pool->BytesInUse / 1024), (int)(pool->BytesReserved / 1024), pool->BytesReserved ? pool->BytesInUse * 100.0 / pool->BytesReserved : 0.0);
+            Text("Pool allocator: %d pages (+%d free), %d large allocations", pool->PageCount, pool->FreePageCount, pool->LargeAllocCount);
+        }
+        ImGuiMemoryUsage usage = GetMemoryUsage();
+        Text("Memory usage: %d KB", (int)(usage.Total / 1024));
+        if (g.IO.ConfigMemoryBudget != 0)
+        {
+            SameLine();
+            Text("(budget: %d KB, exceeded on %d frames, last trim step: %d)", (int)(g.IO.ConfigMemoryBudget / 1024), g.GcTrimCount, g.GcTrimLevel);
+        }
+        BulletText("Windows: %d KB, DrawLists: %d KB, Tables: %d KB, Fonts: %d KB", (int)(usage.Windows / 1024), (int)(usage.DrawLists / 1024), (int)(usage.Tables / 1024), (int)(usage.Fonts / 1024));
+        BulletText("TextCaches: %d KB, Settings: %d KB, Misc: %d KB", (int)(usage.TextCaches / 1024), (int)(usage.Settings / 1024), (int)(usage.Misc / 1024));
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
@@ -15600,6 +17148,36 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    if (TreeNode("Text caches"))
+    {
+        ImGuiTextMeasureCache* cache = &g.TextMeasureCache;
+        const int lookups = cache->StatHits[1] + cache->StatMisses[1];
+        SeparatorText("Measurement (CalcTextSize)");
+        Text("Entries: %d / %d, seen keys: %d, text: %d bytes", cache->Entries.Size, cache->Capacity, cache->SeenKeys.Data.Size, cache->TextBuf.Size);
+        Text("Last frame: %d lookups, %d hits, %d misses (%.1f%% hit rate)", lookups, cache->StatHits[1], cache->StatMisses[1], lookups ? cache->StatHits[1] * 100.0f / lookups : 0.0f);
+        Text("Last frame: %d bytes of text not measured again", cache->StatBytesSaved[1]);
+        Text("Evictions: %d", cache->StatEvictions);
+        SetNextItemWidth(GetFontSize() * 8);
+        DragInt("Capacity##Measure", &cache->Capacity, 8.0f, 0, 65536);
+        SameLine();
+        if (SmallButton("Clear##Measure"))
+        {
+            cache->ClearFreeMemory();
+            cache->ClearStats();
+        }
+
+        ImGuiShapedTextCache* shaped_cache = &g.ShapedTextCache;
+        SeparatorText("Retained labels (ImGuiItemFlags_RetainedText)");
+        Text("Entries: %d / %d", shaped_cache->Pool.GetAliveCount(), shaped_cache->Capacity);
+        Text("Last frame: %d hits, %d misses, %d glyphs appended from shaped data", shaped_cache->StatHits[1], shaped_cache->StatMisses[1], shaped_cache->StatGlyphs[1]);
+        SetNextItemWidth(GetFontSize() * 8);
+        DragInt("Capacity##Shaped", &shaped_cache->Capacity, 8.0f, 0, 65536);
+        SameLine();
+        if (SmallButton("Clear##Shaped"))
+            shaped_cache->Pool.Clear();
+        TreePop();
+    }
+
     if (TreeNode("Inputs"))
     {
         Text("KEYBOARD/GAMEPAD/MOUSE KEYS");
@@ -15887,7 +17465,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
     int cmd_count = draw_list->CmdBuffer.Size;
     if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d quads, %d cmds, %d culled", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->QuadBuffer.Size, cmd_count, draw_list->_CulledCount);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -15917,14 +17495,46 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         char texid_desc[20];
         FormatTextureIDForDebugDisplay(texid_desc, IM_ARRAYSIZE(texid_desc), pcmd->TextureId);
         char buf[300];
-        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
-            pcmd->ElemCount / 3, texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d %s, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+            pcmd->QuadInstances ? pcmd->ElemCount : pcmd->ElemCount / 3, (pcmd->QuadInstances == ImDrawQuadKind_Shape) ? "shapes" : pcmd->QuadInstances ? "quads" : "tris", texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
         bool pcmd_node_open = TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "%s", buf);
         if (IsItemHovered() && (cfg->ShowDrawCmdMesh || cfg->ShowDrawCmdBoundingBoxes) && fg_draw_list)
             DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, cfg->ShowDrawCmdMesh, cfg->ShowDrawCmdBoundingBoxes);
         if (!pcmd_node_open)
             continue;
 
+        // Quad instances: display instance summary, then individual instances.
+        if (pcmd->QuadInstances)
+        {
+            const ImDrawQuad* quad_buffer = draw_list->QuadBuffer.Data + pcmd->IdxOffset;
+            float total_area = 0.0f;
+            for (unsigned int quad_n = 0; quad_n < pcmd->ElemCount; quad_n++)
+                total_area += (quad_buffer[quad_n].Size[0] / 16.0f) * (quad_buffer[quad_n].Size[1] / 16.0f);
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "Quads: ElemCount: %d, QuadOffset: +%d, Area: ~%0.f px", pcmd->ElemCount, pcmd->IdxOffset, total_area);
+            Selectable(buf);
+            if (IsItemHovered() && fg_draw_list)
+                DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, true, false);
+            ImGuiListClipper clipper;
+            clipper.Begin(pcmd->ElemCount);
+            while (clipper.Step())
+                for (int quad_n = clipper.DisplayStart; quad_n < clipper.DisplayEnd; quad_n++)
+                {
+                    const ImDrawQuad& q = quad_buffer[quad_n];
+                    const ImVec2 p_max(q.Pos.x + q.Size[0] / 16.0f, q.Pos.y + q.Size[1] / 16.0f);
+                    if (pcmd->QuadInstances == ImDrawQuadKind_Shape)
+                        ImFormatString(buf, IM_ARRAYSIZE(buf), "Shape: %04d: pos (%8.2f,%8.2f)-(%8.2f,%8.2f), rounding %.2f, thickness %.2f, corners 0x%X%s, col %08X",
+                            pcmd->IdxOffset + quad_n, q.Pos.x, q.Pos.y, p_max.x, p_max.y, q.UV[0] / 16.0f, q.UV[1] / 16.0f, q.UV[2] & 0x0F, (q.UV[2] & 0x10) ? ", AA" : "", q.Col);
+                    else
+                        ImFormatString(buf, IM_ARRAYSIZE(buf), "Quad: %04d: pos (%8.2f,%8.2f)-(%8.2f,%8.2f), uv (%.6f,%.6f)-(%.6f,%.6f), col %08X",
+                            pcmd->IdxOffset + quad_n, q.Pos.x, q.Pos.y, p_max.x, p_max.y, q.UV[0] / 65535.0f, q.UV[1] / 65535.0f, q.UV[2] / 65535.0f, q.UV[3] / 65535.0f, q.Col);
+                    Selectable(buf, false);
+                    if (fg_draw_list && IsItemHovered())
+                        fg_draw_list->AddRect(q.Pos, p_max, IM_COL32(255, 255, 0, 255));
+                }
+            TreePop();
+            continue;
+        }
+
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
         const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
@@ -15984,7 +17594,16 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
     ImRect vtxs_rect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
     ImDrawListFlags backup_flags = out_draw_list->Flags;
     out_draw_list->Flags &= ~ImDrawListFlags_AntiAliasedLines; // Disable AA on triangle outlines is more readable for very large and thin triangles.
-    for (unsigned int idx_n = draw_cmd->IdxOffset, idx_end = draw_cmd->IdxOffset + draw_cmd->ElemCount; idx_n < idx_end; )
+    for (unsigned int quad_n = draw_cmd->IdxOffset, quad_end = draw_cmd->IdxOffset + draw_cmd->ElemCount; draw_cmd->QuadInstances && quad_n < quad_end; quad_n++)
+    {
+        ImDrawQuad q = draw_list->QuadBuffer.Data[quad_n]; // Copy as ->AddRect() may invalidate pointers if out_draw_list==draw_list
+        ImVec2 p_max(q.Pos.x + q.Size[0] / 16.0f, q.Pos.y + q.Size[1] / 16.0f);
+        vtxs_rect.Add(q.Pos);
+        vtxs_rect.Add(p_max);
+        if (show_mesh)
+            out_draw_list->AddRect(q.Pos, p_max, IM_COL32(255, 255, 0, 255)); // In yellow: quad instances
+    }
+    for (unsigned int idx_n = draw_cmd->IdxOffset, idx_end = draw_cmd->IdxOffset + draw_cmd->ElemCount; !draw_cmd->QuadInstances && idx_n < idx_end; )
     {
         ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL; // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
         ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset;
@@ -16108,7 +17727,7 @@ void ImGui::DebugNodeFontGlyph(ImFont*, const ImFontGlyph* glyph)
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
-    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+    if (!TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->_HashIndex.size_in_bytes(), storage->_Hashed ? " (hashed)" : ""))
         return;
     for (const ImGuiStoragePair& p : storage->Data)
     {
@@ -40,13 +40,13 @@ Index of this file:
 // [SECTION] Dear ImGui end-user API functions
 // [SECTION] Flags & Enumerations
 // [SECTION] Tables API flags and structures (ImGuiTableFlags, ImGuiTableColumnFlags, ImGuiTableRowFlags, ImGuiTableBgTarget, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
-// [SECTION] Helpers: Debug log, Memory allocations macros, ImVector<>
+// [SECTION] Helpers: Debug log, Memory allocations macros, ImGuiPoolAllocator, ImVector<>, ImSmallVector<>
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
-// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
-// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiMemoryUsage)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiLabel, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage, ImGuiSelectionRangeStorage)
+// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawUploadArena)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
 // [SECTION] ImGuiPlatformIO + other Platform Dependent Interfaces (ImGuiPlatformImeData)
@@ -119,6 +119,13 @@ Index of this file:
 #define IM_MSVC_RUNTIME_CHECKS_RESTORE
 #endif
 
+// Helper Macros - IM_CONSTEXPR14: constexpr for functions using loops/locals, which requires C++14 (used by ImGuiLabel to hash string literals at compile-time).
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define IM_CONSTEXPR14              constexpr
+#else
+#define IM_CONSTEXPR14
+#endif
+
 // Warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -164,31 +171,41 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
+struct ImDrawUploadArena;           // GPU-visible memory provided by the renderer backend, where draw lists directly store their vertices and indices (ImGuiBackendFlags_RendererHasUploadArena)
+struct ImDrawQuad;                  // A single axis-aligned textured quad instance (pos + size + uv rect + col = 24 bytes), used when ImGuiBackendFlags_RendererHasQuadInstances is set
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
+struct ImFontShapedText;            // Text shaped once into glyph quads relative to an origin, to be appended with ImDrawList::AddShapedText()
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui (also see: ImGuiPlatformIO)
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
+struct ImGuiLabel;                  // Helper for a widget label with its ID hash precomputed (at compile-time with IM_LABEL("..."))
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store per-item heights for a variable-height ImGuiListClipper (prefix sums in a Fenwick tree)
+struct ImGuiMemoryUsage;            // Heap memory held by a context, per subsystem, as returned by GetMemoryUsage()
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformIO;             // Interface between platform/renderer backends and ImGui (e.g. Clipboard, IME hooks). Extends ImGuiIO. In docking branch, this gets extended to support multi-viewports.
 struct ImGuiPlatformImeData;        // Platform IME data for io.PlatformSetImeDataFn() function.
+struct ImGuiPoolAllocator;          // Optional pooled allocator to pass to SetAllocatorFunctions(), to avoid fragmenting the host heap
 struct ImGuiSelectionBasicStorage;  // Optional helper to store multi-selection state + apply multi-selection requests.
 struct ImGuiSelectionExternalStorage;//Optional helper to apply multi-selection requests to existing randomly accessible storage.
+struct ImGuiSelectionRangeStorage;  // Optional helper to store multi-selection state as sorted ranges of item indices, for very large lists.
 struct ImGuiSelectionRequest;       // A selection request (stored in ImGuiMultiSelectIO)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
 struct ImGuiStoragePair;            // Helper for key->value storage (pair)
 struct ImGuiStyle;                  // Runtime data for styling/colors
+struct ImGuiTreeView;               // Helper to display a large tree as a flat list of visible rows, to be used with ImGuiListClipper (see BeginTreeView())
+struct ImGuiTreeViewRow;            // A visible row of a ImGuiTreeView
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
@@ -521,11 +538,13 @@ namespace ImGui
     IMGUI_API void          PushID(const char* str_id_begin, const char* str_id_end);       // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const void* ptr_id);                                     // push pointer into the ID stack (will hash pointer).
     IMGUI_API void          PushID(int int_id);                                             // push integer into the ID stack (will hash integer).
+    IMGUI_API void          PushID(const ImGuiLabel& str_id);                               // push string into the ID stack (using precomputed hash, e.g. PushID(IM_LABEL("Options"))).
     IMGUI_API void          PopID();                                                        // pop from the ID stack.
     IMGUI_API ImGuiID       GetID(const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(const void* ptr_id);
     IMGUI_API ImGuiID       GetID(int int_id);
+    IMGUI_API ImGuiID       GetID(const ImGuiLabel& str_id);
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
@@ -547,10 +566,12 @@ namespace ImGui
     // - Most widgets return true when the value has been changed or when pressed/selected
     // - You may also use one of the many IsItemXXX functions (e.g. IsItemActive, IsItemHovered, etc.) to query widget state.
     IMGUI_API bool          Button(const char* label, const ImVec2& size = ImVec2(0, 0));   // button
+    IMGUI_API bool          Button(const ImGuiLabel& label, const ImVec2& size = ImVec2(0, 0)); // button, with precomputed label hash: Button(IM_LABEL("Save"))
     IMGUI_API bool          SmallButton(const char* label);                                 // button with (FramePadding.y == 0) to easily embed within text
     IMGUI_API bool          InvisibleButton(const char* str_id, const ImVec2& size, ImGuiButtonFlags flags = 0); // flexible button behavior without the visuals, frequently useful to build custom behaviors using the public api (along with IsItemActive, IsItemHovered, etc.)
     IMGUI_API bool          ArrowButton(const char* str_id, ImGuiDir dir);                  // square button with an arrow shape
     IMGUI_API bool          Checkbox(const char* label, bool* v);
+    IMGUI_API bool          Checkbox(const ImGuiLabel& label, bool* v);
     IMGUI_API bool          CheckboxFlags(const char* label, int* flags, int flags_value);
     IMGUI_API bool          CheckboxFlags(const char* label, unsigned int* flags, unsigned int flags_value);
     IMGUI_API bool          RadioButton(const char* label, bool active);                    // use with e.g. if (RadioButton("one", my_value==1)) { my_value = 1; }
@@ -653,6 +674,7 @@ namespace ImGui
     // Widgets: Trees
     // - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
     IMGUI_API bool          TreeNode(const char* label);
+    IMGUI_API bool          TreeNode(const ImGuiLabel& label);
     IMGUI_API bool          TreeNode(const char* str_id, const char* fmt, ...) IM_FMTARGS(2);   // helper variation to easily decorelate the id from the displayed string. Read the FAQ about why and how to use ID. to align arbitrary text at the same level as a TreeNode() you can use Bullet().
     IMGUI_API bool          TreeNode(const void* ptr_id, const char* fmt, ...) IM_FMTARGS(2);   // "
     IMGUI_API bool          TreeNodeV(const char* str_id, const char* fmt, va_list args) IM_FMTLIST(2);
@@ -667,14 +689,20 @@ namespace ImGui
     IMGUI_API void          TreePop();                                                          // ~ Unindent()+PopID()
     IMGUI_API float         GetTreeNodeToLabelSpacing();                                        // horizontal distance preceding label when using TreeNode*() or Bullet() == (g.FontSize + style.FramePadding.x*2) for a regular unframed TreeNode
     IMGUI_API bool          CollapsingHeader(const char* label, ImGuiTreeNodeFlags flags = 0);  // if returning 'true' the header is open. doesn't indent nor push on ID stack. user doesn't have to call TreePop().
+    IMGUI_API bool          CollapsingHeader(const ImGuiLabel& label, ImGuiTreeNodeFlags flags = 0);
     IMGUI_API bool          CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFlags flags = 0); // when 'p_visible != NULL': if '*p_visible==true' display an additional small close button on upper right of the header which will set the bool to false when clicked, if '*p_visible==false' don't display the header.
     IMGUI_API void          SetNextItemOpen(bool is_open, ImGuiCond cond = 0);                  // set next TreeNode/CollapsingHeader open state.
+    IMGUI_API bool          BeginTreeView(const char* str_id, ImGuiTreeView* tree);             // virtualized tree: update tree->Rows[] (flattened open hierarchy) which you can clip with ImGuiListClipper. see ImGuiTreeView. only call EndTreeView() if returning true!
+    IMGUI_API bool          TreeViewNode(int row_n, ImGuiTreeNodeFlags flags, const char* fmt, ...) IM_FMTARGS(3);          // display tree->Rows[row_n], indented by its depth. return true when open. never call TreePop() after it.
+    IMGUI_API bool          TreeViewNodeV(int row_n, ImGuiTreeNodeFlags flags, const char* fmt, va_list args) IM_FMTLIST(3);
+    IMGUI_API void          EndTreeView();                                                      // apply open/close toggles of this frame to tree->Rows[].
     IMGUI_API void          SetNextItemStorageID(ImGuiID storage_id);                           // set id to use for open/close storage (default to same as item id).
 
     // Widgets: Selectables
     // - A selectable highlights when hovered, and can display another color when selected.
     // - Neighbors selectable extend their highlight bounds in order to leave no gap between them. This is so a series of selected Selectable appear contiguous.
     IMGUI_API bool          Selectable(const char* label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0)); // "bool selected" carry the selection state (read-only). Selectable() is clicked is returns true so you can modify your selection state. size.x==0.0: use remaining width, size.x>0.0: specify width. size.y==0.0: use label height, size.y>0.0: specify height
+    IMGUI_API bool          Selectable(const ImGuiLabel& label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));
     IMGUI_API bool          Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));      // "bool* p_selected" point to the selection state (read-write), as a convenient helper.
 
     // Multi-selection system for Selectable(), Checkbox(), TreeNode() functions [BETA]
@@ -807,12 +835,14 @@ namespace ImGui
     //        - TableNextRow() -> TableNextColumn()      -> Text("Hello 0") -> TableNextColumn()      -> Text("Hello 1")  // OK
     //        -                   TableNextColumn()      -> Text("Hello 0") -> TableNextColumn()      -> Text("Hello 1")  // OK: TableNextColumn() automatically gets to next row!
     //        - TableNextRow()                           -> Text("Hello 0")                                               // Not OK! Missing TableSetColumnIndex() or TableNextColumn()! Text will not appear!
+    //    - For large grids of plain text, TableSimpleCells() submits a whole range of rows, clipping them and skipping per-cell item processing.
     // - 5. Call EndTable()
     IMGUI_API bool          BeginTable(const char* str_id, int columns, ImGuiTableFlags flags = 0, const ImVec2& outer_size = ImVec2(0.0f, 0.0f), float inner_width = 0.0f);
     IMGUI_API void          EndTable();                                         // only call EndTable() if BeginTable() returns true!
     IMGUI_API void          TableNextRow(ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f); // append into the first cell of a new row.
     IMGUI_API bool          TableNextColumn();                                  // append into the next column (or first column of next row if currently in last column). Return true when column is visible.
     IMGUI_API bool          TableSetColumnIndex(int column_n);                  // append into the specified column. Return true when column is visible.
+    IMGUI_API void          TableSimpleCells(int row_start, int row_end, const char* (*getter)(void* user_data, int row, int column, char* buf, int buf_size), void* user_data); // append rows [row_start, row_end) made of one line of plain text per cell (clipped, much faster than TableNextColumn() + Text() for large grids). 'getter' returns its own string or formats into 'buf'.
 
     // Tables: Headers & Columns declaration
     // - Use TableSetupColumn() to specify label, resizing policy, default width/weight, id, various other flags etc.
@@ -822,8 +852,10 @@ namespace ImGui
     // - You may manually submit headers using TableNextRow() + TableHeader() calls, but this is only useful in
     //   some advanced use cases (e.g. adding custom widgets in header row).
     // - Use TableSetupScrollFreeze() to lock columns/rows so they stay visible when scrolled.
+    // - With ImGuiTableFlags_VirtualizeColumns, you only need to declare leading columns, use TableSetupVirtualColumns() to give a width to other columns.
     IMGUI_API void          TableSetupColumn(const char* label, ImGuiTableColumnFlags flags = 0, float init_width_or_weight = 0.0f, ImGuiID user_id = 0);
     IMGUI_API void          TableSetupScrollFreeze(int cols, int rows);         // lock columns/rows so they stay visible when scrolled.
+    IMGUI_API void          TableSetupVirtualColumns(float default_width);      // with ImGuiTableFlags_VirtualizeColumns: width of columns not declared with TableSetupColumn(). Otherwise they are auto-fit when they first come into view.
     IMGUI_API void          TableHeader(const char* label);                     // submit one header cell manually (rarely used)
     IMGUI_API void          TableHeadersRow();                                  // submit a row with headers cells based on data provided to TableSetupColumn() + submit context menu
     IMGUI_API void          TableAngledHeadersRow();                            // submit a row with angled headers for every column with the ImGuiTableColumnFlags_AngledHeader flag. MUST BE FIRST ROW.
@@ -842,6 +874,7 @@ namespace ImGui
     IMGUI_API ImGuiTableColumnFlags TableGetColumnFlags(int column_n = -1);     // return column flags so you can query their Enabled/Visible/Sorted/Hovered status flags. Pass -1 to use current column.
     IMGUI_API void                  TableSetColumnEnabled(int column_n, bool v);// change user accessible enabled/disabled state of a column. Set to false to hide the column. User can use the context menu to change this themselves (right-click in headers, or right-click in columns body with ImGuiTableFlags_ContextMenuInBody)
     IMGUI_API int                   TableGetHoveredColumn();                    // return hovered column. return -1 when table is not hovered. return columns_count if the unused space at the right of visible columns is hovered. Can also use (TableGetColumnFlags() & ImGuiTableColumnFlags_IsHovered) instead.
+    IMGUI_API void                  TableGetVisibleColumnsRange(int* out_start, int* out_end); // return range [start, end) of non-frozen columns in sight (+1 on each side for navigation). Frozen columns [0, TableSetupScrollFreeze() cols) are always visible. Return all non-frozen columns unless using ImGuiTableFlags_VirtualizeColumns.
     IMGUI_API void                  TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n = -1);  // change the color of a cell, row, or column. See ImGuiTableBgTarget_ flags for details.
 
     // Legacy Columns API (prefer using Tables!)
@@ -1053,6 +1086,10 @@ namespace ImGui
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
 
+    // Memory Usage
+    // - Estimate of heap memory held by the current context, based on capacity of its buffers. Set io.ConfigMemoryBudget to make NewFrame() trim it.
+    IMGUI_API ImGuiMemoryUsage GetMemoryUsage();
+
 } // namespace ImGui
 
 //-----------------------------------------------------------------------------
@@ -1140,6 +1177,7 @@ enum ImGuiItemFlags_
     ImGuiItemFlags_ButtonRepeat             = 1 << 3,   // false    // Any button-like behavior will have repeat mode enabled (based on io.KeyRepeatDelay and io.KeyRepeatRate values). Note that you can also call IsItemActive() after any button to tell if it is being held.
     ImGuiItemFlags_AutoClosePopups          = 1 << 4,   // true     // MenuItem()/Selectable() automatically close their parent popup window.
     ImGuiItemFlags_AllowDuplicateId         = 1 << 5,   // false    // Allow submitting an item with the same identifier as an item already submitted this frame without triggering a warning tooltip if io.ConfigDebugHighlightIdConflicts is set.
+    ImGuiItemFlags_RetainedText             = 1 << 6,   // false    // Labels are static: Text(), Button(), Selectable() etc. render them from a per-context cache of pre-shaped glyph quads (see ImFontShapedText) instead of decoding them every frame.
 };
 
 // Flags for ImGui::InputText()
@@ -1598,6 +1636,9 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasQuadInstances = 1 << 4, // Backend Renderer supports ImDrawCmd::QuadInstances. This enables output of glyphs and axis-aligned rectangles as ImDrawQuad instances (24 bytes) instead of 4 vertices + 6 indices (92 bytes).
+    ImGuiBackendFlags_RendererHasShapeInstances = 1 << 5, // Backend Renderer supports ImDrawCmd::QuadInstances == ImDrawQuadKind_Shape. This enables output of rounded rectangles, circles and rectangle/circle borders as a single ImDrawQuad evaluated per-pixel, instead of CPU tessellated polygons.
+    ImGuiBackendFlags_RendererHasUploadArena = 1 << 6,  // Backend Renderer provides platform_io.Renderer_UploadArena. Draw lists store VtxBuffer[]/IdxBuffer[] directly in GPU-visible memory, so the backend doesn't need to copy them.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1911,6 +1952,7 @@ enum ImGuiTableFlags_
     ImGuiTableFlags_SortTristate               = 1 << 27,  // Allow no sorting, disable default sorting. TableGetSortSpecs() may return specs where (SpecsCount == 0).
     // Miscellaneous
     ImGuiTableFlags_HighlightHoveredColumn     = 1 << 28,  // Highlight column headers when hovered (may evolve into a fuller highlight)
+    ImGuiTableFlags_VirtualizeColumns          = 1 << 29,  // Only lay out columns in sight (+ frozen and declared ones), so per-frame cost doesn't grow with columns count. Allows up to 32K columns. Require ScrollX. Columns are fixed width, not reorderable nor hideable. Use TableGetVisibleColumnsRange() to only submit visible columns.
 
     // [Internal] Combinations and masks
     ImGuiTableFlags_SizingMask_                = ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_SizingFixedSame | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_SizingStretchSame,
@@ -2003,7 +2045,7 @@ struct ImGuiTableColumnSortSpecs
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers: Debug log, memory allocations macros, ImVector<>
+// [SECTION] Helpers: Debug log, memory allocations macros, ImGuiPoolAllocator, ImVector<>, ImSmallVector<>
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
@@ -2031,6 +2073,51 @@ inline void  operator delete(void*, ImNewWrapper, void*)   {} // This is only re
 #define IM_NEW(_TYPE)                       new(ImNewWrapper(), ImGui::MemAlloc(sizeof(_TYPE))) _TYPE
 template<typename T> void IM_DELETE(T* p)   { if (p) { p->~T(); ImGui::MemFree(p); } }
 
+//-----------------------------------------------------------------------------
+// ImGuiPoolAllocator
+// Optional pooled allocator, to avoid fragmenting the host heap over long sessions (e.g. when running as an overlay in another application).
+//   static ImGuiPoolAllocator pool;
+//   ImGui::SetAllocatorFunctions(ImGuiPoolAllocator::AllocFunc, ImGuiPoolAllocator::FreeFunc, &pool);   // Before CreateContext()
+//-----------------------------------------------------------------------------
+// - Allocations up to ~2 KB are rounded up to one of 24 size classes, and served from 16 KB pages dedicated to that class.
+//   Pages are obtained from the host 16 at a time. An empty page can be reused by any size class.
+//   Larger allocations are forwarded to the host. Every allocation has a 16 bytes header.
+// - Not thread-safe, like the rest of Dear ImGui. If you use contexts from multiple threads, give each thread its own instance.
+// - The instance needs to outlive every allocation made through it (contexts, font atlases, static ImVector<> instances...).
+// - Statistics tell overlay memory apart from the host's own memory. They are displayed in Metrics/Debugger->Memory allocations.
+//-----------------------------------------------------------------------------
+
+struct ImGuiPoolAllocatorPage;
+struct ImGuiPoolAllocatorRegion;
+
+struct ImGuiPoolAllocator
+{
+    // Host memory. Default to malloc()/free() when NULL (must be set when using IMGUI_DISABLE_DEFAULT_ALLOCATORS).
+    ImGuiMemAllocFunc           HostAllocFunc;
+    ImGuiMemFreeFunc            HostFreeFunc;
+    void*                       HostUserData;
+
+    // Statistics
+    int                         AllocCount;         // Number of live allocations
+    int                         LargeAllocCount;    // Number of live allocations which were forwarded to the host
+    int                         PageCount;          // Number of pages assigned to a size class
+    int                         FreePageCount;      // Number of empty pages kept for reuse
+    size_t                      BytesInUse;         // Size of live allocations, including headers, rounded up to their size class
+    size_t                      BytesReserved;      // Memory obtained from the host, including pages not fully used
+
+    // [Internal]
+    ImGuiPoolAllocatorPage*     _PartialPages[24];  // Per size class, pages with at least one free slot
+    ImGuiPoolAllocatorPage*     _FreePages;
+    ImGuiPoolAllocatorRegion*   _Regions;
+
+    IMGUI_API ImGuiPoolAllocator();
+    IMGUI_API ~ImGuiPoolAllocator();                // Return memory to the host, unless some allocations are still alive
+    IMGUI_API void*             Alloc(size_t size);
+    IMGUI_API void              Free(void* ptr);
+    static void*                AllocFunc(size_t size, void* user_data)    { return ((ImGuiPoolAllocator*)user_data)->Alloc(size); }
+    static void                 FreeFunc(void* ptr, void* user_data)       { ((ImGuiPoolAllocator*)user_data)->Free(ptr); }
+};
+
 //-----------------------------------------------------------------------------
 // ImVector<>
 // Lightweight std::vector<>-like class to avoid dragging dependencies (also, some implementations of STL with debug enabled are absurdly slow, we bypass it so our code runs fast in debug).
@@ -2106,6 +2193,60 @@ struct ImVector
     inline bool         find_erase_unsorted(const T& v)     { const T* it = find(v); if (it < Data + Size) { erase_unsorted(it); return true; } return false; }
     inline int          index_from_ptr(const T* it) const   { IM_ASSERT(it >= Data && it < Data + Size); const ptrdiff_t off = it - Data; return (int)off; }
 };
+
+// ImSmallVector<T, N>: ImVector<> variant storing up to N elements inside the object itself, only spilling to the heap when it grows larger.
+// - Same Size/Capacity/Data layout and a subset of the ImVector<> API, so it can replace small per-window/per-drawlist stacks and buffers without touching callers.
+// - Data points to LocalBuf while contents fit. A zero-memset instance is valid (empty, no storage): LocalBuf is picked up on first growth.
+// - clear() releases heap storage and goes back to the inline buffer, so structures compacted by the GC can grow again without allocating.
+// - Important: since Data may point inside the object, it must NOT be relocated with memcpy() (e.g. stored by value in an ImVector<>).
+template<typename T, int N>
+struct ImSmallVector
+{
+    int                 Size;
+    int                 Capacity;
+    T*                  Data;
+    T                   LocalBuf[N];
+
+    typedef T                   value_type;
+    typedef value_type*         iterator;
+    typedef const value_type*   const_iterator;
+
+    inline ImSmallVector()                                          { Size = Capacity = 0; Data = NULL; }
+    inline ImSmallVector(const ImSmallVector<T, N>& src)            { Size = Capacity = 0; Data = NULL; operator=(src); }
+    inline ImSmallVector<T, N>& operator=(const ImSmallVector<T, N>& src) { Size = 0; resize(src.Size); if (src.Size > 0) memcpy(Data, src.Data, (size_t)Size * sizeof(T)); return *this; }
+    inline ~ImSmallVector()                                         { if (Data != LocalBuf && Data) IM_FREE(Data); } // Important: does not destruct anything
+
+    inline void         clear()                             { if (Data != LocalBuf && Data) IM_FREE(Data); Size = Capacity = 0; Data = NULL; } // Important: does not destruct anything
+    inline bool         is_inline() const                   { return Data == NULL || Data == LocalBuf; }
+
+    inline bool         empty() const                       { return Size == 0; }
+    inline int          size() const                        { return Size; }
+    inline int          size_in_bytes() const               { return Size * (int)sizeof(T); }
+    inline int          capacity() const                    { return Capacity; }
+    inline T&           operator[](int i)                   { IM_ASSERT(i >= 0 && i < Size); return Data[i]; }
+    inline const T&     operator[](int i) const             { IM_ASSERT(i >= 0 && i < Size); return Data[i]; }
+
+    inline T*           begin()                             { return Data; }
+    inline const T*     begin() const                       { return Data; }
+    inline T*           end()                               { return Data + Size; }
+    inline const T*     end() const                         { return Data + Size; }
+    inline T&           front()                             { IM_ASSERT(Size > 0); return Data[0]; }
+    inline const T&     front() const                       { IM_ASSERT(Size > 0); return Data[0]; }
+    inline T&           back()                              { IM_ASSERT(Size > 0); return Data[Size - 1]; }
+    inline const T&     back() const                        { IM_ASSERT(Size > 0); return Data[Size - 1]; }
+
+    inline int          _grow_capacity(int sz) const        { int new_capacity = Capacity ? (Capacity + Capacity / 2) : N; return new_capacity > sz ? new_capacity : sz; }
+    inline void         resize(int new_size)                { if (new_size > Capacity) reserve(_grow_capacity(new_size)); Size = new_size; }
+    inline void         resize(int new_size, const T& v)    { if (new_size > Capacity) reserve(_grow_capacity(new_size)); if (new_size > Size) for (int n = Size; n < new_size; n++) memcpy(&Data[n], &v, sizeof(v)); Size = new_size; }
+    inline void         shrink(int new_size)                { IM_ASSERT(new_size <= Size); Size = new_size; }
+    inline void         reserve(int new_capacity)           { if (new_capacity <= Capacity) return; if (new_capacity <= N) { Data = LocalBuf; Capacity = N; return; } T* new_data = (T*)IM_ALLOC((size_t)new_capacity * sizeof(T)); if (Size > 0) memcpy(new_data, Data, (size_t)Size * sizeof(T)); if (Data != LocalBuf && Data) IM_FREE(Data); Data = new_data; Capacity = new_capacity; }
+
+    // NB: It is illegal to call push_back() with a reference pointing inside the vector data itself! e.g. v.push_back(v[10]) is forbidden.
+    inline void         push_back(const T& v)               { if (Size == Capacity) reserve(_grow_capacity(Size + 1)); memcpy(&Data[Size], &v, sizeof(v)); Size++; }
+    inline void         pop_back()                          { IM_ASSERT(Size > 0); Size--; }
+    inline bool         contains(const T& v) const          { const T* data = Data;  const T* data_end = Data + Size; while (data < data_end) if (*data++ == v) return true; return false; }
+    inline int          index_from_ptr(const T* it) const   { IM_ASSERT(it >= Data && it < Data + Size); const ptrdiff_t off = it - Data; return (int)off; }
+};
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 //-----------------------------------------------------------------------------
@@ -2245,6 +2386,8 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigDrawListCulling;          // = false          // Skip primitives fully outside of their clip rectangle before generating any vertex (sets ImDrawListFlags_CullToClipRect). Don't enable if you modify ClipRect of draw commands after they are submitted.
+    size_t      ConfigMemoryBudget;             // = 0              // Budget (in bytes) for memory held by the context. Checked every ConfigMemoryCompactTimer seconds: when GetMemoryUsage().Total exceeds it, NewFrame() trims over-sized buffers, compacts unused windows/tables without waiting for ConfigMemoryCompactTimer, and frees the font atlas CPU pixels once the texture is uploaded. 0 to disable.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2358,6 +2501,7 @@ struct ImGuiIO
     int         MetricsRenderVertices;              // Vertices output during last call to Render()
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;               // Number of visible windows
+    int         MetricsRenderCulled;                // Primitives skipped during last frame because they were fully outside of their clip rectangle (see ImDrawListFlags_CullToClipRect)
     int         MetricsActiveWindows;               // Number of active windows
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
@@ -2427,7 +2571,7 @@ struct ImGuiIO
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
+// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiMemoryUsage)
 //-----------------------------------------------------------------------------
 
 // Shared state of InputText(), passed as an argument to your callback when a ImGuiInputTextFlags_Callback* flag is used.
@@ -2503,8 +2647,25 @@ struct ImGuiPayload
     bool IsDelivery() const                 { return Delivery; }
 };
 
+// Heap memory held by a context, in bytes, as returned by GetMemoryUsage().
+// Buffers capacity is counted (not what was used this frame), so this is what trimming can act upon.
+// Memory owned by the backend (e.g. ImDrawUploadArena storage) and by the allocator itself (e.g. ImGuiPoolAllocator free pages) is not counted.
+struct ImGuiMemoryUsage
+{
+    size_t          Windows;            // ImGuiWindow instances, names, ID stacks, state storage, layout stacks
+    size_t          DrawLists;          // ImDrawList buffers of windows and viewports, including splitter channels
+    size_t          Tables;             // ImGuiTable instances, columns data, temporary data and their splitters
+    size_t          Fonts;              // ImFontAtlas: font glyphs and lookup tables, source font data, CPU copy of texture pixels
+    size_t          TextCaches;         // Text measurement and shaped text caches
+    size_t          Settings;           // .ini settings for windows/tables
+    size_t          Misc;               // Frame arena, shared temporary buffers, input text state, debug log, various stacks
+    size_t          Total;              // Sum of the above
+
+    ImGuiMemoryUsage()  { memset(this, 0, sizeof(*this)); }
+};
+
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiLabel, ImGuiListClipper, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2589,15 +2750,22 @@ struct ImGuiStoragePair
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
 // Types are NOT stored, so it is up to you to make sure your Key don't collide with different types.
+// Hashed mode (opt-in per instance with SetHashed(true), used by default for window->StateStorage unless IMGUI_DISABLE_HASHED_WINDOW_STORAGE is defined):
+// - Pairs are kept in insertion order and an open-addressing index on keys makes both query and insertion O(1), for storages holding thousands of keys.
+// - Data[] is not sorted: if you need sorted pairs (e.g. for serialization) call BuildSortByKey(), which also rebuilds the index.
+// - If you modify Data[] directly, call BuildSortByKey() before using any other function.
 struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+    ImVector<int>                   _HashIndex;     // Hashed mode: slot -> index+1 into Data[], 0 for an empty slot. Empty when storage is small enough to be scanned.
+    bool                            _Hashed;        // Hashed mode enabled (see SetHashed())
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    ImGuiStorage()      { _Hashed = false; }
+    void                Clear() { Data.clear(); _HashIndex.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2618,6 +2786,8 @@ struct ImGuiStorage
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
     IMGUI_API void      BuildSortByKey();
+    // Advanced: switch between sorted (default) and hashed mode, see above. Existing pairs are kept.
+    IMGUI_API void      SetHashed(bool hashed);
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
@@ -2626,6 +2796,53 @@ struct ImGuiStorage
 #endif
 };
 
+// Helper: Label with a precomputed ID hash, for widgets submitted with the same string literal every frame.
+// - Use IM_LABEL("Save") to obtain a 'const ImGuiLabel&' and pass it to the ImGuiLabel overloads: ImGui::Button(IM_LABEL("Save")), ImGui::PushID(IM_LABEL("Options")) etc.
+// - When compiling as C++14 or later IM_LABEL() hashes at compile-time, otherwise it hashes once on first use (function-local static).
+// - The resulting ID is the same as with the 'const char*' label, including "##" and "###" handling.
+// - Only the ID stack seed is combined at runtime, with a fixed cost (8 table lookups) instead of hashing every character of the label.
+// - Text must be zero-terminated and outlive the ImGuiLabel (IM_LABEL() only accepts string literals).
+#ifdef IMGUI_USE_CRC32C_HASH
+#define IM_CRC32_POLY               0x82F63B78u     // Reflected CRC-32C polynomial, must match ImHashStr()
+#else
+#define IM_CRC32_POLY               0xEDB88320u     // Reflected CRC-32 polynomial, must match ImHashStr()
+#endif
+#define IM_LABEL(_LITERAL)          ([]() -> const ImGuiLabel& { static const ImGuiLabel imgui_label("" _LITERAL); return imgui_label; }())
+struct ImGuiLabel
+{
+    const char* Text;               // Label, displayed as usual
+    ImU32       Hash;               // CRC of the hashed part of Text (all of it, or from the last "###") starting from a zero CRC register
+    ImU32       SeedMul[16];        // SeedMul[n] == n * x^(8 * hashed_length) mod P, used to combine the seed (see ImHashLabel())
+
+    explicit IM_CONSTEXPR14 ImGuiLabel(const char* text) : Text(text), Hash(0), SeedMul()
+    {
+        const char* hashed = text;
+        const char* text_end = text;
+        for (; *text_end; text_end++)
+            if (text_end[0] == '#' && text_end[1] == '#' && text_end[2] == '#')
+                hashed = text_end;
+        ImU32 crc = 0;
+        ImU32 x_pow = 0x80000000u; // x^0, becomes x^(8 * hashed_length)
+        for (const char* p = hashed; p < text_end; p++)
+        {
+            crc ^= (unsigned char)*p;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc >> 1) ^ ((crc & 1) ? IM_CRC32_POLY : 0);
+                x_pow = (x_pow >> 1) ^ ((x_pow & 1) ? IM_CRC32_POLY : 0);
+            }
+        }
+        Hash = crc;
+        for (int bit = 3; bit >= 0; bit--) // Bit 'bit' of a nibble is the coefficient of x^(3 - bit)
+        {
+            for (int n = 0; n < 16; n++)
+                if (n & (1 << bit))
+                    SeedMul[n] ^= x_pow;
+            x_pow = (x_pow >> 1) ^ ((x_pow & 1) ? IM_CRC32_POLY : 0);
+        }
+    }
+};
+
 // Helper: Manually clip large list of items.
 // If you have lots evenly spaced items and you have random access to the list, you can perform coarse
 // clipping based on visibility to only submit items that are in view.
@@ -2646,6 +2863,7 @@ struct ImGuiStorage
 // - Clipper calculate the actual range of elements to display based on the current clipping rectangle, position the cursor before the first visible element.
 // - User code submit visible elements.
 // - The clipper also handles various subtleties related to keyboard/gamepad navigation, wrapping etc.
+// Items of different heights: use BeginWithHeights() with a persistent ImGuiListClipperHeights instance (see below).
 struct ImGuiListClipper
 {
     ImGuiContext*   Ctx;                // Parent UI context
@@ -2656,12 +2874,14 @@ struct ImGuiListClipper
     float           StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
     double          StartSeekOffsetY;   // [Internal] Account for frozen rows in a table and initial loss of precision in very large windows.
     void*           TempData;           // [Internal] Internal data
+    ImGuiListClipperHeights* Heights;   // [Internal] Per-item heights when using BeginWithHeights(), NULL otherwise
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step, and you can call SeekCursorForItem() manually if you need)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginWithHeights(int items_count, ImGuiListClipperHeights* heights); // Variable-height items. 'heights' is resized to items_count and must persist across frames.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2682,6 +2902,96 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Per-item heights for ImGuiListClipper::BeginWithHeights(), for lists where items have different heights (wrapped text, expanded entries...).
+// - Heights are stored along with their prefix sums in a Fenwick tree: finding the visible range, seeking or updating one item height are O(log N).
+// - Heights come from AdapterIndexToHeight() when set, or DefaultHeight, when items are added. With MeasureItems (default), the clipper then
+//   records the actual height of every item it displays, so estimates get corrected as items get scrolled into view.
+// - When an item height changes while it is not visible (e.g. an entry gets expanded/collapsed from elsewhere), call SetItemHeight().
+// - Inserting/removing items in the middle of the list is not supported incrementally: call Clear() and let it rebuild.
+// Usage:
+//   static ImGuiListClipperHeights heights;      // Persistent!
+//   ImGuiListClipper clipper;
+//   clipper.BeginWithHeights(items.Size, &heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextWrapped("%s", items[i]);
+struct ImGuiListClipperHeights
+{
+    // Members
+    int             Size;               //          // Number of items, maintained by Resize()/ImGuiListClipper::BeginWithHeights().
+    float           DefaultHeight;      // = 0.0f   // Height given to new items when AdapterIndexToHeight is not set. Left to 0.0f, BeginWithHeights() sets it to GetTextLineHeightWithSpacing().
+    bool            MeasureItems;       // = true   // Record height of items displayed by the clipper. When disabled, heights need to be exact, and the clipper can display items by ranges instead of one by one.
+    void*           UserData;           // = NULL   // User data for use by adapter function        // e.g. heights.UserData = (void*)my_items;
+    float           (*AdapterIndexToHeight)(ImGuiListClipperHeights* self, int idx);            // e.g. heights.AdapterIndexToHeight = [](ImGuiListClipperHeights* self, int idx) { return ((MyItem*)self->UserData)[idx].Height; };
+    ImVector<float> _Heights;           // [Internal] Height of each item
+    ImVector<double>_Tree;              // [Internal] Fenwick tree (1-based) of item heights: _Tree[i] holds the sum of heights of items (i - (i & -i), i]
+
+    // Methods
+    IMGUI_API ImGuiListClipperHeights();
+    IMGUI_API void  Clear();                                            // Remove all items and free memory
+    IMGUI_API void  Resize(int items_count);                            // Add items at the end (querying their heights) or remove them.
+    IMGUI_API void  SetItemHeight(int idx, float height);               // O(log N)
+    inline float    GetItemHeight(int idx) const                        { return _Heights[idx]; }
+    IMGUI_API double GetItemOffset(int idx) const;                      // Sum of heights of items before 'idx'. O(log N)
+    inline double   GetTotalHeight() const                              { return GetItemOffset(Size); }
+    IMGUI_API int   FindItemAtOffset(double offset, float spacing = 0.0f) const; // Item covering given offset from the start of the list, clamped to [0, Size - 1]. 'spacing' is added after every item. O(log N)
+};
+
+// Helper: Virtualized tree view, for hierarchies too large to be submitted with nested TreeNode()/TreePop() calls.
+// - The open part of the hierarchy is flattened into Rows[], one entry per visible row, which you can clip with ImGuiListClipper.
+// - Rows[] is maintained incrementally: when a node gets opened or closed, EndTreeView() inserts or removes the rows of its visible descendants.
+//   It is fully rebuilt on the first BeginTreeView() and after SetDirty(), e.g. when your hierarchy changes.
+// - The hierarchy is queried through adapter functions, using your own node indices. Node index -1 designates the (hidden) root.
+// - Open state is stored in the window ImGuiStorage like regular tree nodes, under GetNodeID(), so it persists when a parent gets closed.
+//   To open/close nodes from code, use SetNodeOpen(), which also patches Rows[]. If you write to the storage directly (e.g. TreeNodeSetOpen()), call SetDirty().
+// - Keyboard: Up/Down move between rows, Right/Left open/close nodes, Left on a closed node or on a leaf moves to its parent.
+// - Multi-select: use row indices as selection user data: BeginMultiSelect(flags, selection.Size, tree.Rows.Size) + SetNextItemSelectionUserData(row_n),
+//   and map rows to persistent node identifiers in ImGuiSelectionBasicStorage::AdapterIndexToStorageId, e.g. with GetRowStorageId().
+// Usage:
+//   static ImGuiTreeView tree;                   // Persistent!
+//   tree.UserData = &my_scene;
+//   tree.AdapterGetChildCount = [](ImGuiTreeView* self, int node_idx) { ... };
+//   tree.AdapterGetChild = [](ImGuiTreeView* self, int node_idx, int child_n) { ... };
+//   if (ImGui::BeginTreeView("##scene", &tree))
+//   {
+//       ImGuiListClipper clipper;
+//       clipper.Begin(tree.Rows.Size);
+//       while (clipper.Step())
+//           for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//               ImGui::TreeViewNode(row_n, ImGuiTreeNodeFlags_SpanAvailWidth, "%s", my_scene.Nodes[tree.Rows[row_n].NodeIdx].Name);
+//       ImGui::EndTreeView();
+//   }
+struct ImGuiTreeViewRow
+{
+    int             NodeIdx;            // User index of the node displayed on this row
+    int             Depth;              // 0 for children of the root
+    bool            IsOpen;
+    bool            IsLeaf;             // Node has no children
+};
+
+struct ImGuiTreeView
+{
+    // Members
+    ImVector<ImGuiTreeViewRow> Rows;    //          // Flattened visible hierarchy, maintained by BeginTreeView()/EndTreeView().
+    void*           UserData;           // = NULL   // User data for use by adapter functions          // e.g. tree.UserData = (void*)&my_scene;
+    int             (*AdapterGetChildCount)(ImGuiTreeView* self, int node_idx);                  // Return number of children of a node (node_idx == -1 for root)
+    int             (*AdapterGetChild)(ImGuiTreeView* self, int node_idx, int child_n);          // Return node index of the n-th child of a node (node_idx == -1 for root)
+    ImGuiID         (*AdapterIndexToStorageId)(ImGuiTreeView* self, int node_idx);               // = idx    // Persistent identifier of a node. Override if your node indices are not stable across changes to the hierarchy.
+    ImGuiID         ID;                 // [Internal] Set by BeginTreeView(), seed for node identifiers
+    bool            _NeedRebuild;       // [Internal]
+    ImVector<int>   _ToggledRows;       // [Internal] Rows whose open state changed during the frame, applied by EndTreeView()
+    ImVector<int>   _BuildStack;        // [Internal] (node_idx, child_n, child_count) triplets
+    ImVector<ImGuiTreeViewRow> _BuildRows; // [Internal]
+
+    // Methods
+    IMGUI_API ImGuiTreeView();
+    inline void     SetDirty()                                      { _NeedRebuild = true; }            // Rebuild Rows[] on next BeginTreeView()
+    inline ImGuiID  GetRowStorageId(int row_n)                      { return AdapterIndexToStorageId(this, Rows[row_n].NodeIdx); }
+    IMGUI_API ImGuiID GetNodeID(int node_idx);                      // ID of node widget, also used to store its open state. Requires ID (set by BeginTreeView()).
+    IMGUI_API int   FindParentRow(int row_n) const;                 // Return -1 for top-level rows. O(distance to parent row)
+    IMGUI_API void  SetNodeOpen(int node_idx, bool open);           // Open/close a node and update Rows[] accordingly. Call from the window hosting the tree, after its first BeginTreeView(). O(visible rows)
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2903,8 +3213,36 @@ struct ImGuiSelectionExternalStorage
     IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests by using AdapterSetItemSelected() calls
 };
 
+// Optional helper to store multi-selection state as sorted disjoint ranges of item indices.
+// - Suited to very large lists addressed by index: select-all, Shift+Click or box-select over 1M items store a single range,
+//   instead of one entry per item as ImGuiSelectionBasicStorage would.
+// - Contains() is O(log R) and SetRangeSelected()/InvertAll() are O(log R) + a memmove of the ranges array, with R = number of ranges.
+// - Indices are stored directly: selection doesn't follow items if they get reordered, inserted or removed. Clear() it when that happens.
+// - Iterate selection with 'void* it = NULL; int idx; while (selection.GetNextSelectedItem(&it, &idx)) { ... }',
+//   or by ranges with 'void* it = NULL; int first, last; while (selection.GetNextSelectedRange(&it, &first, &last)) { ... }'.
+struct ImGuiSelectionRangeStorage
+{
+    // Members
+    int             Size;           //          // Number of selected items, maintained by this helper.
+    ImVector<int>   _Bounds;        // [Internal] Sorted range boundaries: items in [_Bounds[n * 2], _Bounds[n * 2 + 1]) are selected.
+    int             _IterBoundsHint;// [Internal] Boundary index following the last item returned by GetNextSelectedItem(), to iterate without searching.
+
+    // Methods
+    IMGUI_API ImGuiSelectionRangeStorage();
+    IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests coming from BeginMultiSelect() and EndMultiSelect() functions. It uses 'items_count' passed to BeginMultiSelect()
+    IMGUI_API bool  Contains(int idx) const;                    // Query if an item index is in selection. O(log R)
+    IMGUI_API void  Clear();                                    // Clear selection
+    IMGUI_API void  Swap(ImGuiSelectionRangeStorage& r);        // Swap two selections
+    inline void     SetItemSelected(int idx, bool selected)     { SetRangeSelected(idx, idx, selected); }
+    IMGUI_API void  SetRangeSelected(int idx_first, int idx_last, bool selected); // Add/remove items [idx_first..idx_last] (inclusive) from selection
+    IMGUI_API void  InvertAll(int items_count);                 // Invert selection of items [0..items_count-1]
+    IMGUI_API bool  GetNextSelectedItem(void** opaque_it, int* out_idx);                        // Iterate selected items in increasing order
+    IMGUI_API bool  GetNextSelectedRange(void** opaque_it, int* out_first, int* out_last);      // Iterate selected ranges in increasing order (inclusive)
+    inline int      GetRangesCount() const                      { return _Bounds.Size / 2; }
+};
+
 //-----------------------------------------------------------------------------
-// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData, ImDrawUploadArena)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
@@ -2934,14 +3272,19 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
-// - The ClipRect/TextureId/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
+// - QuadInstances: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasQuadInstances' is enabled, commands with QuadInstances != 0
+//   reference ImDrawList::QuadBuffer[] instead of IdxBuffer[]/VtxBuffer[]: IdxOffset/ElemCount are then a start offset and a number of ImDrawQuad
+//   instances, each expanded to a 4 vertices triangle strip by the renderer. Backends not setting the flag never see such commands.
+//   The value tells how to interpret the instances (see ImDrawQuadKind_): ImDrawQuadKind_Shape commands are only emitted with 'ImGuiBackendFlags_RendererHasShapeInstances'.
+// - The ClipRect/TextureId/VtxOffset/QuadInstances fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
     ImVec4          ClipRect;           // 4*4  // Clipping rectangle (x1, y1, x2, y2). Subtract ImDrawData->DisplayPos to get clipping rectangle in "viewport" coordinates
     ImTextureID     TextureId;          // 4-8  // User-provided texture ID. Set by user in ImfontAtlas::SetTexID() for fonts or passed to Image*() functions. Ignore if never using images or multiple fonts atlas.
     unsigned int    VtxOffset;          // 4    // Start offset in vertex buffer. ImGuiBackendFlags_RendererHasVtxOffset: always 0, otherwise may be >0 to support meshes larger than 64K vertices with 16-bit indices.
-    unsigned int    IdxOffset;          // 4    // Start offset in index buffer.
-    unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
+    unsigned int    QuadInstances;      // 4    // ImGuiBackendFlags_RendererHasQuadInstances: != 0 (ImDrawQuadKind_XXX) if this command draws ImDrawQuad instances from quad_buffer[], otherwise always 0.
+    unsigned int    IdxOffset;          // 4    // Start offset in index buffer (or in quad buffer when QuadInstances != 0).
+    unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles (or number of quad instances when QuadInstances != 0). Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;   // 4-8  // Callback user data (when UserCallback != NULL). If called AddCallback() with size == 0, this is a copy of the AddCallback() argument. If called AddCallback() with size > 0, this is pointing to a buffer where data is stored.
     int             UserCallbackDataSize;  // 4 // Size of callback user data when using storage, otherwise 0.
@@ -2969,12 +3312,38 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Values for ImDrawCmd::QuadInstances
+enum ImDrawQuadKind_
+{
+    ImDrawQuadKind_None         = 0,    // Regular command using IdxBuffer[]/VtxBuffer[]
+    ImDrawQuadKind_Textured     = 1,    // Textured quads (glyphs, images, filled rectangles)
+    ImDrawQuadKind_Shape        = 2,    // Analytic shapes (rounded rectangles, circles, borders): UV[] holds shape parameters instead of texture coordinates
+};
+
+// Quad instance layout (24 bytes), used by draw commands with QuadInstances != 0
+// - Pos is the upper-left corner. Size is stored in 1/16th of a pixel (up to 4095 pixels), UV in normalized 16-bit units (0..65535 -> 0.0f..1.0f).
+// - Precision: output is visually equivalent to the ImDrawVert path, not bit-exact. Pos is stored as-is, but the lower-right corner is rounded
+//   to the nearest 1/16th of a pixel (error <= 1/32th of a pixel), and UV are rounded to the nearest 1/65535th (error <= 0.004 texel on a 512x512 texture).
+// - Corner 'i' of the triangle strip (0..3) is at Pos + Size * (i & 1, i >> 1), with UV interpolated the same way between (UV[0],UV[1]) and (UV[2],UV[3]).
+// - ImDrawQuadKind_Shape: the quad covers a rounded rectangle inset by UV[3] on each side (leaving room for anti-aliasing and borders), with
+//   UV[0] = rounding, UV[1] = border thickness (0 for a filled shape), UV[3] = inset (all in 1/16th of a pixel),
+//   UV[2] = rounded corners mask (bit 0..3 for top-left, top-right, bottom-left, bottom-right) | 0x10 if anti-aliased.
+//   Borders are centered on the rectangle edge. The texture is not sampled.
+struct ImDrawQuad
+{
+    ImVec2  Pos;
+    ImU16   Size[2];
+    ImU16   UV[4];
+    ImU32   Col;
+};
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
     ImVec4          ClipRect;
     ImTextureID     TextureId;
     unsigned int    VtxOffset;
+    unsigned int    QuadInstances;
 };
 
 // [Internal] For use by ImDrawListSplitter
@@ -2982,6 +3351,7 @@ struct ImDrawChannel
 {
     ImVector<ImDrawCmd>         _CmdBuffer;
     ImVector<ImDrawIdx>         _IdxBuffer;
+    ImVector<ImDrawQuad>        _QuadBuffer;
 };
 
 
@@ -3013,6 +3383,7 @@ enum ImDrawFlags_
     ImDrawFlags_RoundCornersBottomLeft      = 1 << 6, // AddRect(), AddRectFilled(), PathRect(): enable rounding bottom-left corner only (when rounding > 0.0f, we default to all corners). Was 0x04.
     ImDrawFlags_RoundCornersBottomRight     = 1 << 7, // AddRect(), AddRectFilled(), PathRect(): enable rounding bottom-right corner only (when rounding > 0.0f, we default to all corners). Wax 0x08.
     ImDrawFlags_RoundCornersNone            = 1 << 8, // AddRect(), AddRectFilled(), PathRect(): disable rounding on all corners (when rounding > 0.0f). This is NOT zero, NOT an implicit flag!
+    ImDrawFlags_CullItems                   = 1 << 9, // AddLines(), AddRectsFilled(), AddCirclesFilled(): skip items fully outside of the current clip rectangle, even if the draw list doesn't have ImDrawListFlags_CullToClipRect.
     ImDrawFlags_RoundCornersTop             = ImDrawFlags_RoundCornersTopLeft | ImDrawFlags_RoundCornersTopRight,
     ImDrawFlags_RoundCornersBottom          = ImDrawFlags_RoundCornersBottomLeft | ImDrawFlags_RoundCornersBottomRight,
     ImDrawFlags_RoundCornersLeft            = ImDrawFlags_RoundCornersBottomLeft | ImDrawFlags_RoundCornersTopLeft,
@@ -3031,6 +3402,9 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_QuadInstances           = 1 << 4,  // Can emit glyphs, AddRectFilled() and AddImage() as ImDrawQuad instances. Set when 'ImGuiBackendFlags_RendererHasQuadInstances' is enabled. Clear it temporarily if you need to post-process vertices (e.g. ShadeVertsXXX functions).
+    ImDrawListFlags_ShapeInstances          = 1 << 5,  // Can emit AddRect(), rounded AddRectFilled(), AddCircle() and AddCircleFilled() as ImDrawQuadKind_Shape instances. Set when 'ImGuiBackendFlags_RendererHasShapeInstances' is enabled. Same remark as above.
+    ImDrawListFlags_CullToClipRect          = 1 << 6,  // Skip primitives whose bounding box is fully outside of the current clip rectangle, before generating any vertex. Set when 'io.ConfigDrawListCulling' is enabled. Don't use it if you modify ClipRect of commands after adding primitives.
 };
 
 // Draw command list
@@ -3041,13 +3415,14 @@ enum ImDrawListFlags_
 // You can interleave normal ImGui:: calls and adding primitives to the current draw list.
 // In single viewport mode, top-left is == GetMainViewport()->Pos (generally 0,0), bottom-right is == GetMainViewport()->Pos+Size (generally io.DisplaySize).
 // You are totally free to apply whatever transformation matrix you want to the data (depending on the use of the transformation you may want to apply it to ClipRect as well!)
-// Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects.
+// Important: Primitives are coarsely culled against the current clip rectangle when ImDrawListFlags_CullToClipRect is set (see io.ConfigDrawListCulling), but higher-level culling (e.g. ImGuiListClipper) is still preferable for large amount of objects.
 struct ImDrawList
 {
     // This is what you have to render
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImDrawQuad>    QuadBuffer;         // Quad instance buffer. Each command with QuadInstances != 0 consume ImDrawCmd::ElemCount of those.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -3055,20 +3430,24 @@ struct ImDrawList
     ImDrawListSharedData*   _Data;              // Pointer to shared draw data (you can use ImGui::GetDrawListSharedData() to get the one from current ImGui context)
     ImDrawVert*             _VtxWritePtr;       // [Internal] point within VtxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImDrawIdx*              _IdxWritePtr;       // [Internal] point within IdxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
-    ImVector<ImVec2>        _Path;              // [Internal] current path building
+    ImSmallVector<ImVec2, 64> _Path;            // [Internal] current path building (inline storage covers rounded rectangles and small circles)
     ImDrawCmdHeader         _CmdHeader;         // [Internal] template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
-    ImVector<ImVec4>        _ClipRectStack;     // [Internal]
-    ImVector<ImTextureID>   _TextureIdStack;    // [Internal]
+    ImSmallVector<ImVec4, 8> _ClipRectStack;    // [Internal]
+    ImSmallVector<ImTextureID, 4> _TextureIdStack; // [Internal]
     ImVector<ImU8>          _CallbacksDataBuf;  // [Internal]
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    int                     _CulledCount;       // [Internal] number of primitives skipped by ImDrawListFlags_CullToClipRect since the beginning of the frame
+    ImDrawVert*             _VtxArenaData;      // [Internal] when == VtxBuffer.Data, storage belongs to ImDrawUploadArena and must not be freed
+    ImDrawIdx*              _IdxArenaData;      // [Internal] when == IdxBuffer.Data, storage belongs to ImDrawUploadArena and must not be freed
+    bool                    _UseUploadArena;    // [Internal] set by the context on the draw lists it rebuilds every frame (windows, viewports). Other draw lists never use ImDrawUploadArena storage.
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
     ImDrawList(ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
 
     ~ImDrawList() { _ClearFreeMemory(); }
-    IMGUI_API void  PushClipRect(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
+    IMGUI_API void  PushClipRect(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function and used for CPU-side coarse culling of primitives. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
     IMGUI_API void  PushClipRectFullScreen();
     IMGUI_API void  PopClipRect();
     IMGUI_API void  PushTextureID(ImTextureID texture_id);
@@ -3099,16 +3478,27 @@ struct ImDrawList
     IMGUI_API void  AddEllipseFilled(const ImVec2& center, const ImVec2& radius, ImU32 col, float rot = 0.0f, int num_segments = 0);
     IMGUI_API void  AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL);
     IMGUI_API void  AddText(ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL);
+    IMGUI_API void  AddShapedText(const ImFontShapedText* shaped_text, const ImVec2& pos, ImU32 col);                     // Append text previously shaped with ImFont::ShapeText(). Cheaper than AddText() for static labels.
     IMGUI_API void  AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0); // Cubic Bezier (4 control points)
     IMGUI_API void  AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments = 0);               // Quadratic Bezier (3 control points)
 
     // General polygon
     // - Only simple polygons are supported by filling functions (no self-intersections, no holes).
-    // - Concave polygon fill is more expensive than convex one: it has O(N^2) complexity. Provided as a convenience fo user but not used by main library.
+    // - Concave polygon fill is more expensive than convex one: it has O(N^2) complexity, O(N log N) above IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS points. Provided as a convenience fo user but not used by main library.
     IMGUI_API void  AddPolyline(const ImVec2* points, int num_points, ImU32 col, ImDrawFlags flags, float thickness);
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col);
     IMGUI_API void  AddConcavePolyFilled(const ImVec2* points, int num_points, ImU32 col);
 
+    // Bulk primitives
+    // - Submit many primitives of the same kind at once (e.g. plotting large datasets): memory is reserved once per batch and geometry is generated in a tight loop.
+    //   Output is the same as calling AddLine()/AddRectFilled() for each item. Circles are visually equivalent to calling AddCircleFilled() for each item: they all
+    //   use the tessellation of the largest one, and their anti-aliasing fringe may differ by ~0.001 pixels.
+    // - 'sizes', 'radii' and 'cols' are optional per-item arrays: pass NULL to use 'size', 'radius' and 'col' for all items.
+    // - Items fully outside of the current clip rectangle are skipped with ImDrawListFlags_CullToClipRect (see io.ConfigDrawListCulling) or ImDrawFlags_CullItems.
+    IMGUI_API void  AddLines(const ImVec2* points, int lines_count, ImU32 col, float thickness = 1.0f, const ImU32* cols = NULL, ImDrawFlags flags = 0);                             // Line n goes from points[n * 2] to points[n * 2 + 1]
+    IMGUI_API void  AddRectsFilled(const ImVec2* p_min, int rects_count, const ImVec2& size, ImU32 col, const ImVec2* sizes = NULL, const ImU32* cols = NULL, ImDrawFlags flags = 0);  // Rectangle n goes from p_min[n] to p_min[n] + sizes[n]
+    IMGUI_API void  AddCirclesFilled(const ImVec2* centers, int circles_count, float radius, ImU32 col, const float* radii = NULL, const ImU32* cols = NULL, ImDrawFlags flags = 0);
+
     // Image primitives
     // - Read FAQ to understand what ImTextureID is.
     // - "p_min" and "p_max" represent the upper-left and lower-right corners of the rectangle.
@@ -3169,6 +3559,8 @@ struct ImDrawList
     inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
+    IMGUI_API bool  PrimQuadInstance(const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col); // Append an ImDrawQuad instance. Return false (and write nothing) if ImDrawListFlags_QuadInstances is not set or the quad is not representable, in which case use PrimReserve() + PrimRectUV().
+    IMGUI_API bool  PrimShapeInstance(const ImVec2& p_min, const ImVec2& p_max, float rounding, ImDrawFlags flags, float thickness, ImU32 col);      // Append an ImDrawQuadKind_Shape instance for a rectangle path (as passed to PathRect()), filled if thickness == 0.0f. Return false (and write nothing) if ImDrawListFlags_ShapeInstances is not set or the shape is not representable.
 
     // Obsolete names
     //inline  void  AddEllipse(const ImVec2& center, float radius_x, float radius_y, ImU32 col, float rot = 0.0f, int num_segments = 0, float thickness = 1.0f) { AddEllipse(center, ImVec2(radius_x, radius_y), col, rot, num_segments, thickness); } // OBSOLETED in 1.90.5 (Mar 2024)
@@ -3180,11 +3572,15 @@ struct ImDrawList
     // [Internal helpers]
     IMGUI_API void  _ResetForNewFrame();
     IMGUI_API void  _ClearFreeMemory();
+    IMGUI_API void  _TrimFreeMemory();
+    IMGUI_API void  _MoveUploadArenaToHeap();
     IMGUI_API void  _PopUnusedDrawCmd();
     IMGUI_API void  _TryMergeDrawCmds();
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _OnChangedQuadInstances();
+    IMGUI_API ImDrawQuad* _PrimReserveQuads(int quad_count, unsigned int quad_kind = ImDrawQuadKind_Textured);
     IMGUI_API void  _SetTextureID(ImTextureID texture_id);
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
@@ -3200,6 +3596,7 @@ struct ImDrawData
     int                 CmdListsCount;      // Number of ImDrawList* to render (should always be == CmdLists.size)
     int                 TotalIdxCount;      // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int                 TotalVtxCount;      // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int                 TotalQuadCount;     // For convenience, sum of all ImDrawList's QuadBuffer.Size
     ImVector<ImDrawList*> CmdLists;         // Array of ImDrawList* to render. The ImDrawLists are owned by ImGuiContext and only pointed to from here.
     ImVec2              DisplayPos;         // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2              DisplaySize;        // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
@@ -3210,10 +3607,35 @@ struct ImDrawData
     ImDrawData()    { Clear(); }
     IMGUI_API void  Clear();
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
-    IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
+    IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Also expands ImDrawQuadKind_Textured instances (asserts on ImDrawQuadKind_Shape ones). Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
+// GPU-visible memory where draw lists directly write their vertices and indices, removing the copy usually done by renderer backends.
+// - Owned by the renderer backend, which sets 'io.BackendFlags |= ImGuiBackendFlags_RendererHasUploadArena' and 'platform_io.Renderer_UploadArena'.
+// - Data[] is persistently mapped and typically split in one region per frame in flight. Before calling ImGui::NewFrame(),
+//   the backend sets FrameBegin/FrameEnd to the region which is not in use by the GPU. NewFrame() resets FrameUsed to FrameBegin.
+// - ImDrawList::_ResetForNewFrame() and PrimReserve() allocate VtxBuffer[]/IdxBuffer[] storage in the region. When it is full, storage
+//   falls back to regular heap memory: the backend needs to use GetOffset() on each ImDrawList and copy buffers which are not in the arena.
+// - Only draw lists owned by the context and rebuilt every frame (windows, viewports background/foreground) use the arena, since a region
+//   is overwritten when it is recycled. Draw lists you create yourself (even with GetDrawListSharedData()) always use heap memory.
+// - Windows which skip refresh (SetNextWindowRefreshPolicy()) copy their buffers out of the arena when they are rendered again without being
+//   rebuilt. This requires at least 2 regions, so the region used by the previous frame is still intact.
+// - Dear ImGui reads back some vertices (e.g. ShadeVertsXXX functions), so prefer host-cached memory over write-combined memory.
+// - Don't resize VtxBuffer/IdxBuffer of ImGui-owned draw lists by yourself: use PrimReserve()/PrimUnreserve().
+struct ImDrawUploadArena
+{
+    void*               Data;               // Persistently mapped memory, aligned on at least sizeof(ImDrawVert)
+    size_t              Size;               // Size of Data[] in bytes
+    size_t              FrameBegin;         // Region available to the current frame (byte offsets in Data[]), set by backend
+    size_t              FrameEnd;
+    size_t              FrameUsed;          // Allocation cursor, FrameBegin <= FrameUsed <= FrameEnd
+
+    ImDrawUploadArena() { memset(this, 0, sizeof(*this)); }
+    // Byte offset of a buffer in Data[] (e.g. draw_list->VtxBuffer.Data), or -1 if it is not stored in the current region and needs to be copied.
+    ImS64           GetOffset(const void* p) const { const char* c = (const char*)p; const char* d = (const char*)Data; return (p != NULL && c >= d + FrameBegin && c < d + FrameEnd) ? (ImS64)(c - d) : -1; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontAtlasFlags, ImFontAtlas, ImFontGlyphRangesBuilder, ImFont)
 //-----------------------------------------------------------------------------
@@ -3258,6 +3680,33 @@ struct ImFontGlyph
     float           U0, V0, U1, V1;     // Texture coordinates
 };
 
+// A single pre-shaped glyph quad, relative to the origin of its ImFontShapedText.
+struct ImFontShapedGlyph
+{
+    ImVec2          P0, P1;             // Quad corners
+    ImVec2          UV0, UV1;           // Texture coordinates
+    ImU32           ColMask;            // OR-ed into the color at draw time (~IM_COL32_A_MASK for colored glyphs which ignore tinting, 0 otherwise)
+};
+
+// Retained text: decoded, measured and laid out once by ImFont::ShapeText(), then appended any number of times
+// to any ImDrawList with ImDrawList::AddShapedText(), which only has to translate quads and apply color.
+// - Becomes stale when the atlas is rebuilt: check IsValid() and shape again if needed.
+// - Shaped text is not clipped on CPU (other than a whole-block reject against the current clip rectangle).
+struct ImFontShapedText
+{
+    ImVector<ImFontShapedGlyph> Glyphs;
+    ImVec2          Size;               // Same as ImFont::CalcTextSizeA() output for the source text
+    ImVec2          BoundsMin;          // Bounding box of all quads (for coarse clipping)
+    ImVec2          BoundsMax;
+    ImFont*         Font;
+    float           FontSize;
+    int             AtlasBuildGeneration;
+
+    ImFontShapedText()                  { Clear(); }
+    void            Clear()             { Glyphs.resize(0); Size = BoundsMin = BoundsMax = ImVec2(0.0f, 0.0f); Font = NULL; FontSize = 0.0f; AtlasBuildGeneration = -1; }
+    IMGUI_API bool  IsValid() const;
+};
+
 // Helper to build glyph ranges from text/string data. Feed your application strings/characters to it then call BuildRanges().
 // This is essentially a tightly packed of vector of 64k booleans = 8KB storage.
 struct ImFontGlyphRangesBuilder
@@ -3391,6 +3840,7 @@ struct ImFontAtlas
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
     bool                        TexReady;           // Set when texture was built matching current font input
+    int                         BuildGeneration;    // Incremented every time the atlas is built, so caches depending on glyph metrics can be invalidated
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format.
     unsigned char*              TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight
     unsigned int*               TexPixelsRGBA32;    // 4 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * 4
@@ -3460,6 +3910,7 @@ struct ImFont
     IMGUI_API const char*       CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width);
     IMGUI_API void              RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c);
     IMGUI_API void              RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width = 0.0f, bool cpu_fine_clip = false);
+    IMGUI_API void              ShapeText(ImFontShapedText* out_shaped_text, float size, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f);
 
     // [Internal] Don't use!
     IMGUI_API void              BuildLookupTable();
@@ -3551,6 +4002,9 @@ struct ImGuiPlatformIO
 
     // Written by some backends during ImGui_ImplXXXX_RenderDrawData() call to point backend_specific ImGui_ImplXXXX_RenderState* structure.
     void*       Renderer_RenderState;
+
+    // Optional: GPU-visible memory where draw lists store their vertices and indices. Used when io.BackendFlags has ImGuiBackendFlags_RendererHasUploadArena.
+    ImDrawUploadArena* Renderer_UploadArena;
 };
 
 // (Optional) Support for IME (Input Method Editor) via the platform_io.Platform_SetImeDataFn() function.
@@ -550,6 +550,10 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::Checkbox("io.ConfigScrollbarScrollByPage", &io.ConfigScrollbarScrollByPage);
             ImGui::SameLine(); HelpMarker("Enable scrolling page by page when clicking outside the scrollbar grab.\nWhen disabled, always scroll to clicked location.\nWhen enabled, Shift+Click scrolls to clicked location.");
 
+            ImGui::SeparatorText("Rendering");
+            ImGui::Checkbox("io.ConfigDrawListCulling", &io.ConfigDrawListCulling);
+            ImGui::SameLine(); HelpMarker("Skip primitives fully outside of their clip rectangle before generating any vertex.\nDon't enable if you modify ClipRect of draw commands after they are submitted.");
+
             ImGui::SeparatorText("Widgets");
             ImGui::Checkbox("io.ConfigInputTextCursorBlink", &io.ConfigInputTextCursorBlink);
             ImGui::SameLine(); HelpMarker("Enable blinking cursor (optional as some users consider it to be distracting).");
@@ -1182,6 +1186,58 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
                 ImGui::Indent(ImGui::GetTreeNodeToLabelSpacing());
             ImGui::TreePop();
         }
+
+        IMGUI_DEMO_MARKER("Widgets/Tree Nodes/Virtualized tree, with clipper and multi-select");
+        if (ImGui::TreeNode("Virtualized tree, with clipper and multi-select"))
+        {
+            HelpMarker(
+                "Using BeginTreeView()/TreeViewNode() with ImGuiListClipper: only visible rows are submitted, "
+                "the list of visible rows is updated when nodes are opened or closed.\n\n"
+                "Keyboard: Left on a closed node jumps to its parent.");
+
+            // Procedural hierarchy of 111,110 nodes: a complete tree with 10 children per node, 5 levels deep.
+            // Node n has children 10*(n+1) to 10*(n+1)+9, the root (-1) has children 0 to 9.
+            const int NODES_COUNT = 10 + 100 + 1000 + 10000 + 100000;
+            static ImGuiTreeView tree;
+            tree.AdapterGetChildCount = [](ImGuiTreeView*, int node_idx) { return (10 * (node_idx + 1) < NODES_COUNT) ? 10 : 0; };
+            tree.AdapterGetChild = [](ImGuiTreeView*, int node_idx, int child_n) { return 10 * (node_idx + 1) + child_n; };
+
+            // Selection is stored by node, using rows as selection user data.
+            static ImGuiSelectionBasicStorage selection;
+            selection.UserData = (void*)&tree;
+            selection.AdapterIndexToStorageId = [](ImGuiSelectionBasicStorage* self, int row_n) { return ((ImGuiTreeView*)self->UserData)->GetRowStorageId(row_n); };
+
+            ImGui::Text("%d nodes, %d visible rows, %d selected", NODES_COUNT, tree.Rows.Size, selection.Size);
+            if (ImGui::BeginChild("##Tree", ImVec2(-FLT_MIN, ImGui::GetFontSize() * 20), ImGuiChildFlags_FrameStyle | ImGuiChildFlags_ResizeY))
+            {
+                if (ImGui::BeginTreeView("##TreeView", &tree))
+                {
+                    ImGuiMultiSelectFlags ms_flags = ImGuiMultiSelectFlags_ClearOnEscape | ImGuiMultiSelectFlags_BoxSelect1d;
+                    ImGuiMultiSelectIO* ms_io = ImGui::BeginMultiSelect(ms_flags, selection.Size, tree.Rows.Size);
+                    selection.ApplyRequests(ms_io);
+
+                    ImGuiListClipper clipper;
+                    clipper.Begin(tree.Rows.Size);
+                    if (ms_io->RangeSrcItem != -1)
+                        clipper.IncludeItemByIndex((int)ms_io->RangeSrcItem); // Ensure RangeSrc item is not clipped.
+                    while (clipper.Step())
+                        for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                        {
+                            ImGuiTreeNodeFlags node_flags = ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
+                            if (selection.Contains(tree.GetRowStorageId(row_n)))
+                                node_flags |= ImGuiTreeNodeFlags_Selected;
+                            ImGui::SetNextItemSelectionUserData(row_n);
+                            ImGui::TreeViewNode(row_n, node_flags, "Node %d", tree.Rows[row_n].NodeIdx);
+                        }
+
+                    ms_io = ImGui::EndMultiSelect();
+                    selection.ApplyRequests(ms_io);
+                    ImGui::EndTreeView();
+                }
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 
@@ -3292,6 +3348,50 @@ static void ShowDemoWindowMultiSelect(ImGuiDemoWindowData* demo_data)
             ImGui::TreePop();
         }
 
+        // Demonstrate storing selection as ranges of indices, for very large lists
+        IMGUI_DEMO_MARKER("Widgets/Selection State/Multi-Select (range storage, 1M items)");
+        if (ImGui::TreeNode("Multi-Select (range storage, 1M items)"))
+        {
+            // Selecting all or Shift+Clicking across the whole list stores a single range.
+            static ImGuiSelectionRangeStorage selection;
+
+            ImGui::Text("Added features:");
+            ImGui::BulletText("Using ImGuiSelectionRangeStorage.");
+
+            const int ITEMS_COUNT = 1000000;
+            ImGui::Text("Selection: %d/%d in %d range(s)", selection.Size, ITEMS_COUNT, selection.GetRangesCount());
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Invert"))
+                selection.InvertAll(ITEMS_COUNT);
+            if (ImGui::BeginChild("##Basket", ImVec2(-FLT_MIN, ImGui::GetFontSize() * 20), ImGuiChildFlags_FrameStyle | ImGuiChildFlags_ResizeY))
+            {
+                ImGuiMultiSelectFlags flags = ImGuiMultiSelectFlags_ClearOnEscape | ImGuiMultiSelectFlags_BoxSelect1d;
+                ImGuiMultiSelectIO* ms_io = ImGui::BeginMultiSelect(flags, selection.Size, ITEMS_COUNT);
+                selection.ApplyRequests(ms_io);
+
+                ImGuiListClipper clipper;
+                clipper.Begin(ITEMS_COUNT);
+                if (ms_io->RangeSrcItem != -1)
+                    clipper.IncludeItemByIndex((int)ms_io->RangeSrcItem); // Ensure RangeSrc item is not clipped.
+                while (clipper.Step())
+                {
+                    for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                    {
+                        char label[64];
+                        sprintf(label, "Object %07d: %s", n, ExampleNames[n % IM_ARRAYSIZE(ExampleNames)]);
+                        bool item_is_selected = selection.Contains(n);
+                        ImGui::SetNextItemSelectionUserData(n);
+                        ImGui::Selectable(label, item_is_selected);
+                    }
+                }
+
+                ms_io = ImGui::EndMultiSelect();
+                selection.ApplyRequests(ms_io);
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
+
         // Demonstrate dynamic item list + deletion support using the BeginMultiSelect/EndMultiSelect API.
         // In order to support Deletion without any glitches you need to:
         // - (1) If items are submitted in their own scrolling area, submit contents size SetNextWindowContentSize() ahead of time to prevent one-frame readjustment of scrolling.
@@ -5940,6 +6040,129 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Virtualized columns");
+    if (ImGui::TreeNode("Virtualized columns"))
+    {
+        HelpMarker(
+            "With ImGuiTableFlags_VirtualizeColumns, the table only lays out columns in sight, "
+            "so its cost doesn't grow with the number of columns (up to 32K).\n\n"
+            "Combined with TableGetVisibleColumnsRange() to only submit visible columns, and ImGuiListClipper to only submit visible rows, "
+            "this allows displaying very large grids.\n\n"
+            "Columns are fixed width and cannot be reordered nor hidden. "
+            "Use TableSetupVirtualColumns() to give a width to columns which are not declared with TableSetupColumn().");
+        static int columns_count = 10000;
+        static int rows_count = 100000;
+        static float column_width = TEXT_BASE_WIDTH * 8;
+        PushStyleCompact();
+        ImGui::SetNextItemWidth(TEXT_BASE_WIDTH * 12);
+        ImGui::DragInt("Columns", &columns_count, 10.0f, 1, 32766);
+        ImGui::SetNextItemWidth(TEXT_BASE_WIDTH * 12);
+        ImGui::DragInt("Rows", &rows_count, 100.0f, 1, 1000000);
+        ImGui::SetNextItemWidth(TEXT_BASE_WIDTH * 12);
+        ImGui::DragFloat("Columns width", &column_width, 0.5f, 1.0f, 500.0f, "%.0f");
+        PopStyleCompact();
+
+        ImGuiTableFlags flags = ImGuiTableFlags_VirtualizeColumns | ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable;
+        if (ImGui::BeginTable("table_virtualized_columns", columns_count, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15)))
+        {
+            ImGui::TableSetupScrollFreeze(1, 1);
+            ImGui::TableSetupColumn("Row", ImGuiTableColumnFlags_None, TEXT_BASE_WIDTH * 8);
+            ImGui::TableSetupVirtualColumns(column_width);
+
+            // Headers: TableHeadersRow() would only submit visible columns, but columns other than the first one have no name.
+            int columns_start, columns_end;
+            ImGui::TableGetVisibleColumnsRange(&columns_start, &columns_end);
+            ImGui::TableNextRow(ImGuiTableRowFlags_Headers);
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TableHeader("Row");
+            for (int column = columns_start; column < columns_end; column++)
+            {
+                char label[16];
+                snprintf(label, IM_ARRAYSIZE(label), "Col %d", column);
+                ImGui::TableSetColumnIndex(column);
+                ImGui::TableHeader(label);
+            }
+
+            ImGuiListClipper clipper;
+            clipper.Begin(rows_count);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Text("%d", row);
+                    for (int column = columns_start; column < columns_end; column++)
+                    {
+                        ImGui::TableSetColumnIndex(column);
+                        ImGui::Text("%d,%d", column, row);
+                    }
+                }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Simple cells");
+    if (ImGui::TreeNode("Simple cells"))
+    {
+        HelpMarker(
+            "TableSimpleCells() submits a range of rows where each cell is one line of plain text provided by a callback. "
+            "Rows are clipped internally, and cells skip the per-item processing of TableNextColumn() + Text().\n\n"
+            "Compare the frame time with the regular path on a 100K x 12 grid.");
+        struct Funcs
+        {
+            static const char* GetCellText(void*, int row, int column, char* buf, int buf_size)
+            {
+                if (column == 0)
+                    snprintf(buf, buf_size, "%d", row);
+                else
+                    snprintf(buf, buf_size, "%d.%02d", (row * 7 + column * 13) % 1000, (row + column) % 100);
+                return buf;
+            }
+        };
+        static bool use_simple_cells = true;
+        ImGui::Checkbox("Use TableSimpleCells()", &use_simple_cells);
+        ImGui::SameLine();
+        ImGui::Text("%.3f ms/frame", 1000.0f / ImGui::GetIO().Framerate);
+
+        const int columns_count = 12;
+        const int rows_count = 100000;
+        ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable;
+        if (ImGui::BeginTable("table_simple_cells", columns_count, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15)))
+        {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            for (int column = 0; column < columns_count; column++)
+                ImGui::TableSetupColumn(column == 0 ? "Row" : "Value");
+            ImGui::TableHeadersRow();
+            if (use_simple_cells)
+            {
+                ImGui::TableSimpleCells(0, rows_count, Funcs::GetCellText, NULL);
+            }
+            else
+            {
+                char buf[32];
+                ImGuiListClipper clipper;
+                clipper.Begin(rows_count);
+                while (clipper.Step())
+                    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                    {
+                        ImGui::TableNextRow();
+                        for (int column = 0; column < columns_count; column++)
+                        {
+                            ImGui::TableSetColumnIndex(column);
+                            ImGui::TextUnformatted(Funcs::GetCellText(NULL, row, column, buf, IM_ARRAYSIZE(buf)));
+                        }
+                    }
+            }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     if (open_action != -1)
         ImGui::SetNextItemOpen(open_action != 0);
     IMGUI_DEMO_MARKER("Tables/Columns flags");
@@ -7772,6 +7995,7 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigDrawListCulling)                                   ImGui::Text("io.ConfigDrawListCulling");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
@@ -9049,7 +9273,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to TextWrapped(), clipped with variable heights\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -9085,6 +9310,21 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Lines of different heights: the clipper needs a persistent ImGuiListClipperHeights to store them.
+            // Heights of lines which have never been visible are estimated, they get measured as lines get scrolled into view.
+            static ImGuiListClipperHeights heights;
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            ImGuiListClipper clipper;
+            clipper.BeginWithHeights(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                    ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog%s", i,
+                        (i % 7 == 0) ? ", then runs around the field a few times, digs a hole, and finally goes back to sleep under the old oak tree." : "");
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
@@ -8,6 +8,7 @@ Index of this file:
 // [SECTION] STB libraries implementation
 // [SECTION] Style functions
 // [SECTION] ImDrawList
+// [SECTION] ImDrawList bulk primitives
 // [SECTION] ImTriangulator, ImDrawList concave polygon fill
 // [SECTION] ImDrawListSplitter
 // [SECTION] ImDrawData
@@ -394,6 +395,97 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+// Upload arena helpers (see ImDrawUploadArena)
+// - 'arena_data' remembers which storage of 'buf' was allocated from the arena, so we never IM_FREE() it.
+// - Storage is only taken from the arena in _ResetForNewFrame(), for draw lists with _UseUploadArena set. Buffers of split channels, which ImDrawListSplitter::SetCurrentChannel()
+//   swaps into the draw list, never match 'arena_data' and always grow on the heap.
+template<typename T>
+static T* ImDrawUploadArenaAlloc(ImDrawUploadArena* arena, int count)
+{
+    const size_t offset = (arena->FrameUsed + sizeof(T) - 1) / sizeof(T) * sizeof(T); // Offsets are multiple of sizeof(T) so backends can express them in vertex/index units
+    const size_t size = (size_t)count * sizeof(T);
+    if (offset > arena->FrameEnd || arena->FrameEnd - offset < size)
+        return NULL;
+    arena->FrameUsed = offset + size;
+    return (T*)(void*)((char*)arena->Data + offset);
+}
+
+template<typename T>
+static void ImDrawListArenaDetach(ImVector<T>& buf, T*& arena_data)
+{
+    if (arena_data != NULL && buf.Data == arena_data)
+    {
+        buf.Data = NULL;
+        buf.Size = buf.Capacity = 0;
+    }
+    arena_data = NULL;
+}
+
+// Copy arena storage to the heap, keeping contents.
+template<typename T>
+static void ImDrawListArenaMoveToHeap(ImVector<T>& buf, T*& arena_data)
+{
+    if (arena_data != NULL && buf.Data == arena_data)
+    {
+        T* new_data = (T*)IM_ALLOC((size_t)buf.Capacity * sizeof(T));
+        if (buf.Size > 0)
+            memcpy(new_data, buf.Data, (size_t)buf.Size * sizeof(T));
+        buf.Data = new_data;
+    }
+    arena_data = NULL;
+}
+
+// Drop last frame storage, then reserve last frame size + 25% from the arena so most draw lists never need to grow.
+template<typename T>
+static void ImDrawListArenaReset(ImDrawUploadArena* arena, ImVector<T>& buf, T*& arena_data)
+{
+    const int prev_size = buf.Size;
+    ImDrawListArenaDetach(buf, arena_data);
+    buf.resize(0);
+    if (arena == NULL || prev_size == 0)
+        return;
+    const int capacity = prev_size + prev_size / 4;
+    if (T* data = ImDrawUploadArenaAlloc<T>(arena, capacity))
+    {
+        buf.clear();
+        buf.Data = arena_data = data;
+        buf.Capacity = capacity;
+    }
+}
+
+// Replacement for buf.reserve() which is aware of arena storage: grow in place when 'buf' is the last arena allocation,
+// otherwise relocate within the arena, otherwise relocate to the heap.
+template<typename T>
+static void ImDrawListArenaReserve(ImDrawUploadArena* arena, ImVector<T>& buf, T*& arena_data, int new_capacity)
+{
+    IM_ASSERT(new_capacity > buf.Capacity);
+    if (arena_data == NULL || buf.Data != arena_data)
+    {
+        buf.reserve(new_capacity);
+        return;
+    }
+    T* new_data = NULL;
+    if (arena != NULL)
+    {
+        const size_t old_end = (size_t)((char*)(buf.Data + buf.Capacity) - (char*)arena->Data);
+        const size_t grow_size = (size_t)(new_capacity - buf.Capacity) * sizeof(T);
+        if (old_end == arena->FrameUsed && arena->FrameEnd - old_end >= grow_size)
+        {
+            arena->FrameUsed += grow_size;
+            buf.Capacity = new_capacity;
+            return;
+        }
+        new_data = ImDrawUploadArenaAlloc<T>(arena, new_capacity);
+    }
+    if (new_data == NULL)
+        new_data = (T*)IM_ALLOC((size_t)new_capacity * sizeof(T));
+    if (buf.Size > 0)
+        memcpy(new_data, buf.Data, (size_t)buf.Size * sizeof(T));
+    arena_data = (arena != NULL && arena->GetOffset(new_data) >= 0) ? new_data : NULL;
+    buf.Data = new_data;
+    buf.Capacity = new_capacity;
+}
+
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 // In the majority of cases, you would want to call PushClipRect() and PushTextureID() after this.
 void ImDrawList::_ResetForNewFrame()
@@ -402,12 +494,16 @@ void ImDrawList::_ResetForNewFrame()
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, ClipRect) == 0);
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, TextureId) == sizeof(ImVec4));
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, VtxOffset) == sizeof(ImVec4) + sizeof(ImTextureID));
+    IM_STATIC_ASSERT(offsetof(ImDrawCmd, QuadInstances) == sizeof(ImVec4) + sizeof(ImTextureID) + sizeof(unsigned int));
+    IM_STATIC_ASSERT(sizeof(ImDrawQuad) == 24);
     if (_Splitter._Count > 1)
         _Splitter.Merge(this);
 
     CmdBuffer.resize(0);
-    IdxBuffer.resize(0);
-    VtxBuffer.resize(0);
+    ImDrawUploadArena* upload_arena = _UseUploadArena ? _Data->UploadArena : NULL;
+    ImDrawListArenaReset(upload_arena, IdxBuffer, _IdxArenaData);
+    ImDrawListArenaReset(upload_arena, VtxBuffer, _VtxArenaData);
+    QuadBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -420,13 +516,17 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+    _CulledCount = 0;
 }
 
 void ImDrawList::_ClearFreeMemory()
 {
     CmdBuffer.clear();
+    ImDrawListArenaDetach(IdxBuffer, _IdxArenaData);
+    ImDrawListArenaDetach(VtxBuffer, _VtxArenaData);
     IdxBuffer.clear();
     VtxBuffer.clear();
+    QuadBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -438,12 +538,46 @@ void ImDrawList::_ClearFreeMemory()
     _Splitter.ClearFreeMemory();
 }
 
+// Move VtxBuffer[]/IdxBuffer[] out of ImDrawUploadArena storage, for a draw list rendered again without being rebuilt
+// (its arena region will be overwritten when the backend recycles it). Used for windows skipping refresh.
+void ImDrawList::_MoveUploadArenaToHeap()
+{
+    ImDrawListArenaMoveToHeap(IdxBuffer, _IdxArenaData);
+    ImDrawListArenaMoveToHeap(VtxBuffer, _VtxArenaData);
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+}
+
+// Shrink buffers which are much larger than their last use (e.g. after a one-off peak), keeping their contents.
+// Storage provided by ImDrawUploadArena is left untouched. Used by ImGui::GcTrimToMemoryBudget().
+void ImDrawList::_TrimFreeMemory()
+{
+    ImVectorTrimCapacity(CmdBuffer);
+    if (IdxBuffer.Data != _IdxArenaData)
+        ImVectorTrimCapacity(IdxBuffer);
+    if (VtxBuffer.Data != _VtxArenaData)
+        ImVectorTrimCapacity(VtxBuffer);
+    ImVectorTrimCapacity(QuadBuffer);
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+    ImVectorTrimCapacity(_ClipRectStack);
+    ImVectorTrimCapacity(_TextureIdStack);
+    ImVectorTrimCapacity(_CallbacksDataBuf);
+    ImVectorTrimCapacity(_Path);
+    for (ImDrawChannel& channel : _Splitter._Channels)
+    {
+        ImVectorTrimCapacity(channel._CmdBuffer);
+        ImVectorTrimCapacity(channel._IdxBuffer);
+    }
+}
+
 ImDrawList* ImDrawList::CloneOutput() const
 {
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    dst->QuadBuffer = QuadBuffer;
     dst->Flags = Flags;
     return dst;
 }
@@ -454,7 +588,8 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.ClipRect = _CmdHeader.ClipRect;    // Same as calling ImDrawCmd_HeaderCopy()
     draw_cmd.TextureId = _CmdHeader.TextureId;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
-    draw_cmd.IdxOffset = IdxBuffer.Size;
+    draw_cmd.QuadInstances = _CmdHeader.QuadInstances;
+    draw_cmd.IdxOffset = _CmdHeader.QuadInstances ? QuadBuffer.Size : IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
     CmdBuffer.push_back(draw_cmd);
@@ -507,12 +642,23 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* userdata, size_t use
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
 
-// Compare ClipRect, TextureId and VtxOffset with a single memcmp()
-#define ImDrawCmd_HeaderSize                            (offsetof(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
-#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
-#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
+// Compare ClipRect, TextureId, VtxOffset and QuadInstances with a single memcmp()
+// (IdxOffset of commands with different QuadInstances values index different buffers, so they must only be compared after a successful header compare)
+#define ImDrawCmd_HeaderSize                            (offsetof(ImDrawCmd, QuadInstances) + sizeof(unsigned int))
+#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset, QuadInstances
+#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset, QuadInstances
 #define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset)
 
+// Write an ImDrawQuad instance. Caller is responsible for 0 <= (x2 - x1), (y2 - y1) < 4096 and UV within 0.0f..1.0f.
+static inline void ImDrawQuadWrite(ImDrawQuad* quad, float x1, float y1, float x2, float y2, float u1, float v1, float u2, float v2, ImU32 col)
+{
+    quad->Pos.x = x1; quad->Pos.y = y1;
+    quad->Size[0] = (ImU16)((x2 - x1) * 16.0f + 0.5f); quad->Size[1] = (ImU16)((y2 - y1) * 16.0f + 0.5f);
+    quad->UV[0] = (ImU16)(u1 * 65535.0f + 0.5f); quad->UV[1] = (ImU16)(v1 * 65535.0f + 0.5f);
+    quad->UV[2] = (ImU16)(u2 * 65535.0f + 0.5f); quad->UV[3] = (ImU16)(v2 * 65535.0f + 0.5f);
+    quad->Col = col;
+}
+
 // Try to merge two last draw commands
 void ImDrawList::_TryMergeDrawCmds()
 {
@@ -588,6 +734,26 @@ void ImDrawList::_OnChangedVtxOffset()
     curr_cmd->VtxOffset = _CmdHeader.VtxOffset;
 }
 
+void ImDrawList::_OnChangedQuadInstances()
+{
+    // If current command is used with different settings we need to add a new command
+    IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (curr_cmd->ElemCount != 0)
+    {
+        AddDrawCmd();
+        return;
+    }
+    IM_ASSERT(curr_cmd->UserCallback == NULL);
+
+    // Switch current command to the other buffer, then try to merge with previous command if it matches
+    curr_cmd->QuadInstances = _CmdHeader.QuadInstances;
+    curr_cmd->IdxOffset = _CmdHeader.QuadInstances ? QuadBuffer.Size : IdxBuffer.Size;
+    ImDrawCmd* prev_cmd = curr_cmd - 1;
+    if (CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+        CmdBuffer.pop_back();
+}
+
 int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 {
     // Automatic segment count
@@ -658,8 +824,15 @@ void ImDrawList::_SetTextureID(ImTextureID texture_id)
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
-    // Large mesh support (when enabled)
+    // Leave quad instances mode (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
+    if (_CmdHeader.QuadInstances)
+    {
+        _CmdHeader.QuadInstances = 0;
+        _OnChangedQuadInstances();
+    }
+
+    // Large mesh support (when enabled)
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
     {
         // FIXME: In theory we should be testing that vtx_count <64k here.
@@ -672,13 +845,18 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     draw_cmd->ElemCount += idx_count;
 
-    int vtx_buffer_old_size = VtxBuffer.Size;
-    VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
-    _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
+    // Storage may be located in ImDrawUploadArena: don't use ImVector<>::resize() which would free it.
+    int vtx_buffer_new_size = VtxBuffer.Size + vtx_count;
+    if (vtx_buffer_new_size > VtxBuffer.Capacity)
+        ImDrawListArenaReserve(_Data->UploadArena, VtxBuffer, _VtxArenaData, VtxBuffer._grow_capacity(vtx_buffer_new_size));
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    VtxBuffer.Size = vtx_buffer_new_size;
 
-    int idx_buffer_old_size = IdxBuffer.Size;
-    IdxBuffer.resize(idx_buffer_old_size + idx_count);
-    _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
+    int idx_buffer_new_size = IdxBuffer.Size + idx_count;
+    if (idx_buffer_new_size > IdxBuffer.Capacity)
+        ImDrawListArenaReserve(_Data->UploadArena, IdxBuffer, _IdxArenaData, IdxBuffer._grow_capacity(idx_buffer_new_size));
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+    IdxBuffer.Size = idx_buffer_new_size;
 }
 
 // Release the number of reserved vertices/indices from the end of the last reservation made with PrimReserve().
@@ -692,6 +870,40 @@ void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
     IdxBuffer.shrink(IdxBuffer.Size - idx_count);
 }
 
+// Reserve space for a number of ImDrawQuad instances, switching current command to quad instances mode of the given kind (ImDrawQuadKind_XXX) if needed.
+// Same rules as PrimReserve(): you must finish filling your reserved data before reserving again. Shrink QuadBuffer and ElemCount to give back unused instances.
+ImDrawQuad* ImDrawList::_PrimReserveQuads(int quad_count, unsigned int quad_kind)
+{
+    IM_ASSERT_PARANOID(quad_count >= 0 && (Flags & (quad_kind == ImDrawQuadKind_Shape ? ImDrawListFlags_ShapeInstances : ImDrawListFlags_QuadInstances)));
+    if (_CmdHeader.QuadInstances != quad_kind)
+    {
+        _CmdHeader.QuadInstances = quad_kind;
+        _OnChangedQuadInstances();
+    }
+
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    draw_cmd->ElemCount += quad_count;
+
+    int quad_buffer_old_size = QuadBuffer.Size;
+    QuadBuffer.resize(quad_buffer_old_size + quad_count);
+    return QuadBuffer.Data + quad_buffer_old_size;
+}
+
+// Axis aligned textured rectangle as a single ImDrawQuad instance (instead of 4 vertices + 6 indices).
+bool ImDrawList::PrimQuadInstance(const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col)
+{
+    if (!(Flags & ImDrawListFlags_QuadInstances))
+        return false;
+    const float w = p_max.x - p_min.x;
+    const float h = p_max.y - p_min.y;
+    if (!(w >= 0.0f && h >= 0.0f && w < 4095.0f && h < 4095.0f))
+        return false;
+    if (!(uv_min.x >= 0.0f && uv_min.x <= 1.0f && uv_min.y >= 0.0f && uv_min.y <= 1.0f && uv_max.x >= 0.0f && uv_max.x <= 1.0f && uv_max.y >= 0.0f && uv_max.y <= 1.0f))
+        return false; // e.g. wrapping texture coordinates
+    ImDrawQuadWrite(_PrimReserveQuads(1), p_min.x, p_min.y, p_max.x, p_max.y, uv_min.x, uv_min.y, uv_max.x, uv_max.y, col);
+    return true;
+}
+
 // Fully unrolled with inline call to keep our debug builds decently fast.
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
@@ -737,6 +949,35 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     _IdxWritePtr += 6;
 }
 
+// Coarse CPU culling: primitives with a bounding box fully outside of the current clip rectangle would be entirely discarded by the renderer scissor.
+// Bounding boxes passed to ImDrawListCullRect() must include anti-aliasing fringes and line thickness.
+static inline bool ImDrawListIsRectClipped(const ImVec4& clip_rect, float x1, float y1, float x2, float y2)
+{
+    return x2 < clip_rect.x || y2 < clip_rect.y || x1 > clip_rect.z || y1 > clip_rect.w;
+}
+
+static inline bool ImDrawListCullRect(ImDrawList* draw_list, float x1, float y1, float x2, float y2)
+{
+    if (!(draw_list->Flags & ImDrawListFlags_CullToClipRect) || !ImDrawListIsRectClipped(draw_list->_CmdHeader.ClipRect, x1, y1, x2, y2))
+        return false;
+    draw_list->_CulledCount++;
+    return true;
+}
+
+// Same as ImDrawListCullRect() for the bounding box of a point cloud, expanded by 'pad'.
+static bool ImDrawListCullPoints(ImDrawList* draw_list, const ImVec2* points, int points_count, float pad)
+{
+    if (!(draw_list->Flags & ImDrawListFlags_CullToClipRect))
+        return false;
+    float x1 = points[0].x, y1 = points[0].y, x2 = x1, y2 = y1;
+    for (int i = 1; i < points_count; i++)
+    {
+        x1 = ImMin(x1, points[i].x); y1 = ImMin(y1, points[i].y);
+        x2 = ImMax(x2, points[i].x); y2 = ImMax(y2, points[i].y);
+    }
+    return ImDrawListCullRect(draw_list, x1 - pad, y1 - pad, x2 + pad, y2 + pad);
+}
+
 // On AddPolyline() and AddConvexPolyFilled() we intentionally avoid using ImVec2 and superfluous function calls to optimize debug/non-inlined builds.
 // - Those macros expects l-values and need to be used as their own statement.
 // - Those macros are intentionally not surrounded by the 'do {} while (0)' idiom because even that translates to runtime with debug compilers.
@@ -744,12 +985,170 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Minimal 4-wide float helpers used by the vectorized loops below and by ShadeVertsXXX functions (SSE on x86/x64, NEON on AArch64).
+// - ImSimdRsqrt() matches ImRsqrt() lane-wise: RSQRTPS vs RSQRTSS on SSE, exact 1/sqrt on NEON.
+// - ImSimdMin(a, b) is 'a < b ? a : b' and ImSimdMax(a, b) is 'a > b ? a : b', so ImSimdClamp() returns the same bits as ImClamp(), including signed zeros.
+// - ImSimdDeinterleave() splits two registers of ImVec2 pairs into x and y lanes, ImSimdInterleave() does the opposite.
+// - ImSimdLoadPairs()/ImSimdStorePairs() gather/scatter two ImVec2 from strided structures (e.g. ImDrawVert::pos of two vertices).
+#if defined(IMGUI_ENABLE_SSE)
+#define IMGUI_ENABLE_SIMD_DRAW
+typedef __m128 ImSimdF4;
+static inline ImSimdF4 ImSimdLoad(const float* p)                           { return _mm_loadu_ps(p); }
+static inline void     ImSimdStore(float* p, ImSimdF4 v)                    { _mm_storeu_ps(p, v); }
+static inline ImSimdF4 ImSimdSet1(float f)                                  { return _mm_set1_ps(f); }
+static inline ImSimdF4 ImSimdAdd(ImSimdF4 a, ImSimdF4 b)                    { return _mm_add_ps(a, b); }
+static inline ImSimdF4 ImSimdSub(ImSimdF4 a, ImSimdF4 b)                    { return _mm_sub_ps(a, b); }
+static inline ImSimdF4 ImSimdMul(ImSimdF4 a, ImSimdF4 b)                    { return _mm_mul_ps(a, b); }
+static inline ImSimdF4 ImSimdDiv(ImSimdF4 a, ImSimdF4 b)                    { return _mm_div_ps(a, b); }
+static inline ImSimdF4 ImSimdMin(ImSimdF4 a, ImSimdF4 b)                    { return _mm_min_ps(a, b); }
+static inline ImSimdF4 ImSimdMax(ImSimdF4 a, ImSimdF4 b)                    { return _mm_max_ps(a, b); }
+static inline ImSimdF4 ImSimdRsqrt(ImSimdF4 a)                              { return _mm_rsqrt_ps(a); }
+static inline ImSimdF4 ImSimdSelectGreater(ImSimdF4 a, ImSimdF4 b, ImSimdF4 if_true, ImSimdF4 if_false) { ImSimdF4 m = _mm_cmpgt_ps(a, b); return _mm_or_ps(_mm_and_ps(m, if_true), _mm_andnot_ps(m, if_false)); }
+static inline void     ImSimdDeinterleave(ImSimdF4 a, ImSimdF4 b, ImSimdF4* x, ImSimdF4* y) { *x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)); *y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)); }
+static inline void     ImSimdInterleave(ImSimdF4 x, ImSimdF4 y, ImSimdF4* a, ImSimdF4* b)   { *a = _mm_unpacklo_ps(x, y); *b = _mm_unpackhi_ps(x, y); }
+static inline ImSimdF4 ImSimdLowHalves(ImSimdF4 a, ImSimdF4 b)              { return _mm_movelh_ps(a, b); }
+static inline ImSimdF4 ImSimdHighHalves(ImSimdF4 a, ImSimdF4 b)             { return _mm_movehl_ps(b, a); }
+static inline ImSimdF4 ImSimdLoadPairs(const float* p0, const float* p1)    { return _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(const void*)p0), (const __m64*)(const void*)p1); }
+static inline void     ImSimdStorePairs(float* p0, float* p1, ImSimdF4 v)   { _mm_storel_pi((__m64*)(void*)p0, v); _mm_storeh_pi((__m64*)(void*)p1, v); }
+#elif defined(IMGUI_ENABLE_NEON)
+#define IMGUI_ENABLE_SIMD_DRAW
+typedef float32x4_t ImSimdF4;
+static inline ImSimdF4 ImSimdLoad(const float* p)                           { return vld1q_f32(p); }
+static inline void     ImSimdStore(float* p, ImSimdF4 v)                    { vst1q_f32(p, v); }
+static inline ImSimdF4 ImSimdSet1(float f)                                  { return vdupq_n_f32(f); }
+static inline ImSimdF4 ImSimdAdd(ImSimdF4 a, ImSimdF4 b)                    { return vaddq_f32(a, b); }
+static inline ImSimdF4 ImSimdSub(ImSimdF4 a, ImSimdF4 b)                    { return vsubq_f32(a, b); }
+static inline ImSimdF4 ImSimdMul(ImSimdF4 a, ImSimdF4 b)                    { return vmulq_f32(a, b); }
+static inline ImSimdF4 ImSimdDiv(ImSimdF4 a, ImSimdF4 b)                    { return vdivq_f32(a, b); }
+static inline ImSimdF4 ImSimdMin(ImSimdF4 a, ImSimdF4 b)                    { return vbslq_f32(vcltq_f32(a, b), a, b); } // Not vminq_f32(): same signed zeros and NaN behavior as _mm_min_ps()
+static inline ImSimdF4 ImSimdMax(ImSimdF4 a, ImSimdF4 b)                    { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+static inline ImSimdF4 ImSimdRsqrt(ImSimdF4 a)                              { return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(a)); }
+static inline ImSimdF4 ImSimdSelectGreater(ImSimdF4 a, ImSimdF4 b, ImSimdF4 if_true, ImSimdF4 if_false) { return vbslq_f32(vcgtq_f32(a, b), if_true, if_false); }
+static inline void     ImSimdDeinterleave(ImSimdF4 a, ImSimdF4 b, ImSimdF4* x, ImSimdF4* y) { *x = vuzp1q_f32(a, b); *y = vuzp2q_f32(a, b); }
+static inline void     ImSimdInterleave(ImSimdF4 x, ImSimdF4 y, ImSimdF4* a, ImSimdF4* b)   { *a = vzip1q_f32(x, y); *b = vzip2q_f32(x, y); }
+static inline ImSimdF4 ImSimdLowHalves(ImSimdF4 a, ImSimdF4 b)              { return vcombine_f32(vget_low_f32(a), vget_low_f32(b)); }
+static inline ImSimdF4 ImSimdHighHalves(ImSimdF4 a, ImSimdF4 b)             { return vcombine_f32(vget_high_f32(a), vget_high_f32(b)); }
+static inline ImSimdF4 ImSimdLoadPairs(const float* p0, const float* p1)    { return vcombine_f32(vld1_f32(p0), vld1_f32(p1)); }
+static inline void     ImSimdStorePairs(float* p0, float* p1, ImSimdF4 v)   { vst1_f32(p0, vget_low_f32(v)); vst1_f32(p1, vget_high_f32(v)); }
+#endif
+#ifdef IMGUI_ENABLE_SIMD_DRAW
+static inline ImSimdF4 ImSimdClamp(ImSimdF4 v, ImSimdF4 mn, ImSimdF4 mx)    { return ImSimdMin(mx, ImSimdMax(mn, v)); }
+#endif
+
+// Normals of segments [i, i+1] (wrapping to point 0 after the last point), for i in [0, segments_count).
+// Same as IM_NORMALIZE2F_OVER_ZERO() on each segment, followed by a 90 degrees rotation.
+static void ImPolylineCalcNormals(const ImVec2* points, int points_count, int segments_count, ImVec2* out_normals)
+{
+    int i1 = 0;
+#ifdef IMGUI_ENABLE_SIMD_DRAW
+    const ImSimdF4 zero = ImSimdSet1(0.0f);
+    const ImSimdF4 one = ImSimdSet1(1.0f);
+    for (; i1 + 4 < points_count && i1 + 4 <= segments_count; i1 += 4)
+    {
+        ImSimdF4 x1, y1, x2, y2;
+        ImSimdDeinterleave(ImSimdLoad(&points[i1].x), ImSimdLoad(&points[i1 + 2].x), &x1, &y1);
+        ImSimdDeinterleave(ImSimdLoad(&points[i1 + 1].x), ImSimdLoad(&points[i1 + 3].x), &x2, &y2);
+        ImSimdF4 dx = ImSimdSub(x2, x1);
+        ImSimdF4 dy = ImSimdSub(y2, y1);
+        ImSimdF4 d2 = ImSimdAdd(ImSimdMul(dx, dx), ImSimdMul(dy, dy));
+        ImSimdF4 inv_len = ImSimdSelectGreater(d2, zero, ImSimdRsqrt(d2), one);
+        ImSimdF4 n0, n1;
+        ImSimdInterleave(ImSimdMul(dy, inv_len), ImSimdSub(zero, ImSimdMul(dx, inv_len)), &n0, &n1);
+        ImSimdStore(&out_normals[i1].x, n0);
+        ImSimdStore(&out_normals[i1 + 2].x, n1);
+    }
+#endif
+    for (; i1 < segments_count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+}
+
+// Miter direction at each point, from the normals of the segments on each side of it: out_miters[i] = IM_FIXNORMAL2F(average(normals[i-1], normals[i])).
+// The first point uses normals[points_count-1] as its previous normal when 'closed', and the unmodified normals[0] otherwise.
+static void ImPolylineCalcMiters(const ImVec2* normals, int points_count, bool closed, ImVec2* out_miters)
+{
+    int i1 = 1;
+#ifdef IMGUI_ENABLE_SIMD_DRAW
+    const ImSimdF4 half = ImSimdSet1(0.5f);
+    const ImSimdF4 one = ImSimdSet1(1.0f);
+    const ImSimdF4 min_len2 = ImSimdSet1(0.000001f);
+    const ImSimdF4 max_invlen2 = ImSimdSet1(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i1 + 4 <= points_count; i1 += 4)
+    {
+        ImSimdF4 x0, y0, x1, y1;
+        ImSimdDeinterleave(ImSimdLoad(&normals[i1 - 1].x), ImSimdLoad(&normals[i1 + 1].x), &x0, &y0);
+        ImSimdDeinterleave(ImSimdLoad(&normals[i1].x), ImSimdLoad(&normals[i1 + 2].x), &x1, &y1);
+        ImSimdF4 dm_x = ImSimdMul(ImSimdAdd(x0, x1), half);
+        ImSimdF4 dm_y = ImSimdMul(ImSimdAdd(y0, y1), half);
+        ImSimdF4 d2 = ImSimdAdd(ImSimdMul(dm_x, dm_x), ImSimdMul(dm_y, dm_y));
+        ImSimdF4 inv_len2 = ImSimdSelectGreater(d2, min_len2, ImSimdMin(ImSimdDiv(one, d2), max_invlen2), one);
+        ImSimdF4 m0, m1;
+        ImSimdInterleave(ImSimdMul(dm_x, inv_len2), ImSimdMul(dm_y, inv_len2), &m0, &m1);
+        ImSimdStore(&out_miters[i1].x, m0);
+        ImSimdStore(&out_miters[i1 + 2].x, m1);
+    }
+#endif
+    for (int i0 = i1 - 1; i1 < points_count + (closed ? 1 : 0); i0 = i1++)
+    {
+        const int i = (i1 == points_count) ? 0 : i1;
+        float dm_x = (normals[i0].x + normals[i].x) * 0.5f;
+        float dm_y = (normals[i0].y + normals[i].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_miters[i].x = dm_x;
+        out_miters[i].y = dm_y;
+    }
+    if (!closed)
+        out_miters[0] = normals[0];
+}
+
+// Fringe/edge vertices positions: out_points[i * OFFSETS_COUNT + n] = points[i] + miters[i] * offsets[n].
+template<int OFFSETS_COUNT>
+static void ImPolylineCalcFringes(const ImVec2* points, const ImVec2* miters, int points_count, const float* offsets, ImVec2* out_points)
+{
+    int i = 0;
+#ifdef IMGUI_ENABLE_SIMD_DRAW
+    ImSimdF4 offsets_v[OFFSETS_COUNT];
+    for (int n = 0; n < OFFSETS_COUNT; n++)
+        offsets_v[n] = ImSimdSet1(offsets[n]);
+    for (; i + 4 <= points_count; i += 4)
+        for (int half = 0; half < 4; half += 2) // Two points per register
+        {
+            const ImSimdF4 p = ImSimdLoad(&points[i + half].x);
+            const ImSimdF4 m = ImSimdLoad(&miters[i + half].x);
+            ImSimdF4 r[OFFSETS_COUNT];
+            for (int n = 0; n < OFFSETS_COUNT; n++)
+                r[n] = ImSimdAdd(p, ImSimdMul(m, offsets_v[n]));
+            float* out = &out_points[(i + half) * OFFSETS_COUNT].x;
+            for (int n = 0; n < OFFSETS_COUNT; n += 2)
+            {
+                ImSimdStore(out + n * 2, ImSimdLowHalves(r[n], r[n + 1]));
+                ImSimdStore(out + n * 2 + OFFSETS_COUNT * 2, ImSimdHighHalves(r[n], r[n + 1]));
+            }
+        }
+#endif
+    for (; i < points_count; i++)
+        for (int n = 0; n < OFFSETS_COUNT; n++)
+        {
+            out_points[i * OFFSETS_COUNT + n].x = points[i].x + miters[i].x * offsets[n];
+            out_points[i * OFFSETS_COUNT + n].y = points[i].y + miters[i].y * offsets[n];
+        }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
 {
     if (points_count < 2 || (col & IM_COL32_A_MASK) == 0)
         return;
+    // Miters extend up to 10x further than the line half-width (see IM_FIXNORMAL2F_MAX_INVLEN2)
+    if (ImDrawListCullPoints(this, points, points_count, (ImMax(thickness, 1.0f) * 0.5f + _FringeScale + 1.0f) * (points_count > 2 ? 10.0f : 1.0f)))
+        return;
 
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
@@ -780,23 +1179,17 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        // The first <points_count> items are normals at each line point, then <points_count> averaged normals, then after that there are either 2 or 4 temp points for each line point
+        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 4 : 6));
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
+        ImVec2* temp_miters = temp_normals + points_count;
+        ImVec2* temp_points = temp_miters + points_count;
 
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        // Calculate normals (tangents) for each line segment, then averaged normals at each line point
+        ImPolylineCalcNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        ImPolylineCalcMiters(temp_normals, points_count, closed, temp_miters);
 
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
@@ -811,38 +1204,18 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
+            // Add temporary vertexes for the outer edges
+            // (If line is not closed, the first point uses its segment normal as there are no normals to blend)
+            const float edge_offsets[2] = { half_draw_size, -half_draw_size };
+            ImPolylineCalcFringes<2>(points, temp_miters, points_count, edge_offsets, temp_points);
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the final segment of a closed line wrapping back to the first point
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -902,49 +1275,18 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
+            // Add temporary vertices for the outer edges and the solid core edges
+            // (If line is not closed, the first point uses its segment normal as there are no normals to blend)
+            const float edge_offsets[4] = { half_inner_thickness + AA_SIZE, half_inner_thickness, -half_inner_thickness, -(half_inner_thickness + AA_SIZE) };
+            ImPolylineCalcFringes<4>(points, temp_miters, points_count, edge_offsets, temp_points);
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the final segment of a closed line wrapping back to the first point
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -1008,6 +1350,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 {
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCullPoints(this, points, points_count, _FringeScale * 10.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
@@ -1029,30 +1373,17 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        // Compute normals, then averaged normals
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImVec2* temp_miters = temp_normals + points_count;
+        ImPolylineCalcNormals(points, points_count, points_count, temp_normals);
+        ImPolylineCalcMiters(temp_normals, points_count, true, temp_miters);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+            float dm_x = temp_miters[i1].x * (AA_SIZE * 0.5f);
+            float dm_y = temp_miters[i1].y * (AA_SIZE * 0.5f);
 
             // Add vertices
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
@@ -1297,7 +1628,8 @@ ImVec2 ImBezierQuadraticCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p
 }
 
 // Closely mimics ImBezierCubicClosestPointCasteljau() in imgui.cpp
-static void PathBezierCubicCurveToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4, float tess_tol, int level)
+template<typename T_PATH>
+static void PathBezierCubicCurveToCasteljau(T_PATH* path, float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4, float tess_tol, int level)
 {
     float dx = x4 - x1;
     float dy = y4 - y1;
@@ -1322,7 +1654,8 @@ static void PathBezierCubicCurveToCasteljau(ImVector<ImVec2>* path, float x1, fl
     }
 }
 
-static void PathBezierQuadraticCurveToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float tess_tol, int level)
+template<typename T_PATH>
+static void PathBezierQuadraticCurveToCasteljau(T_PATH* path, float x1, float y1, float x2, float y2, float x3, float y3, float tess_tol, int level)
 {
     float dx = x3 - x1, dy = y3 - y1;
     float det = (x2 - x3) * dy - (y2 - y3) * dx;
@@ -1396,15 +1729,62 @@ static inline ImDrawFlags FixRectCornerFlags(ImDrawFlags flags)
     return flags;
 }
 
-void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+// Clamp rounding to fit the rectangle, return 0.0f if corners are not rounded. Shared by PathRect() and the shape instances paths so they match.
+static inline float FixRectRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags* p_flags)
 {
     if (rounding >= 0.5f)
     {
-        flags = FixRectCornerFlags(flags);
+        ImDrawFlags flags = *p_flags = FixRectCornerFlags(*p_flags);
         rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
         rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
     }
-    if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
+    if (rounding < 0.5f || (*p_flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
+        return 0.0f;
+    return rounding;
+}
+
+// Rectangle path (same coordinates as PathRect()) as a single ImDrawQuadKind_Shape instance, evaluated per-pixel by the renderer (instead of a tessellated polygon).
+// Filled if thickness == 0.0f, otherwise a border of 'thickness' centered on the path. Rounding is clamped to half the rectangle size, so a square with rounding == half its size is a circle.
+bool ImDrawList::PrimShapeInstance(const ImVec2& p_min, const ImVec2& p_max, float rounding, ImDrawFlags flags, float thickness, ImU32 col)
+{
+    if (!(Flags & ImDrawListFlags_ShapeInstances))
+        return false;
+    const float w = p_max.x - p_min.x;
+    const float h = p_max.y - p_min.y;
+    const int pad16 = (int)((thickness * 0.5f + 1.0f) * 16.0f + 0.5f); // Inset in 1/16th of pixels: room for half the border + anti-aliasing fringe on each side.
+    const float pad = pad16 / 16.0f;
+    if (!(w >= 0.0f && h >= 0.0f && thickness >= 0.0f && w + pad * 2.0f < 4095.0f && h + pad * 2.0f < 4095.0f))
+        return false;
+
+    IM_STATIC_ASSERT(ImDrawFlags_RoundCornersTopLeft == (1 << 4) && ImDrawFlags_RoundCornersTopRight == (1 << 5) && ImDrawFlags_RoundCornersBottomLeft == (1 << 6) && ImDrawFlags_RoundCornersBottomRight == (1 << 7));
+    unsigned int shape_flags = (Flags & (thickness > 0.0f ? ImDrawListFlags_AntiAliasedLines : ImDrawListFlags_AntiAliasedFill)) ? 0x10 : 0x00;
+    if (rounding >= 0.5f)
+    {
+        flags = FixRectCornerFlags(flags);
+        rounding = ImMin(rounding, ImMin(w, h) * 0.5f);
+        shape_flags |= (flags & ImDrawFlags_RoundCornersMask_) >> 4;
+    }
+    else
+    {
+        rounding = 0.0f;
+    }
+
+    ImDrawQuad* quad = _PrimReserveQuads(1, ImDrawQuadKind_Shape);
+    quad->Pos = ImVec2(p_min.x - pad, p_min.y - pad);
+    quad->Size[0] = (ImU16)((w + pad * 2.0f) * 16.0f + 0.5f);
+    quad->Size[1] = (ImU16)((h + pad * 2.0f) * 16.0f + 0.5f);
+    quad->UV[0] = (ImU16)(rounding * 16.0f + 0.5f);
+    quad->UV[1] = (thickness > 0.0f) ? (ImU16)ImMax((int)(thickness * 16.0f + 0.5f), 1) : (ImU16)0;
+    quad->UV[2] = (ImU16)shape_flags;
+    quad->UV[3] = (ImU16)pad16;
+    quad->Col = col;
+    return true;
+}
+
+void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+{
+    rounding = FixRectRounding(a, b, rounding, &flags);
+    if (rounding == 0.0f)
     {
         PathLineTo(a);
         PathLineTo(ImVec2(b.x, a.y));
@@ -1428,6 +1808,9 @@ void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float th
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    const float pad = ImMax(thickness, 1.0f) * 0.5f + _FringeScale + 1.0f;
+    if (ImDrawListCullRect(this, ImMin(p1.x, p2.x) - pad, ImMin(p1.y, p2.y) - pad, ImMax(p1.x, p2.x) + pad, ImMax(p1.y, p2.y) + pad))
+        return;
     PathLineTo(p1 + ImVec2(0.5f, 0.5f));
     PathLineTo(p2 + ImVec2(0.5f, 0.5f));
     PathStroke(col, 0, thickness);
@@ -1439,10 +1822,19 @@ void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, fl
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
-    if (Flags & ImDrawListFlags_AntiAliasedLines)
-        PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, flags);
-    else
-        PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.49f, 0.49f), rounding, flags); // Better looking lower-right corner and rounded non-AA shapes.
+    const float pad = thickness * 0.5f + _FringeScale + 1.0f;
+    if (ImDrawListCullRect(this, p_min.x - pad, p_min.y - pad, p_max.x + pad, p_max.y + pad))
+        return;
+    const ImVec2 a = p_min + ImVec2(0.50f, 0.50f);
+    const ImVec2 b = (Flags & ImDrawListFlags_AntiAliasedLines) ? p_max - ImVec2(0.50f, 0.50f) : p_max - ImVec2(0.49f, 0.49f); // Better looking lower-right corner and rounded non-AA shapes.
+    if ((Flags & ImDrawListFlags_ShapeInstances) && thickness > 0.0f)
+    {
+        ImDrawFlags shape_flags = flags;
+        const float shape_rounding = FixRectRounding(a, b, rounding, &shape_flags);
+        if (PrimShapeInstance(a, b, shape_rounding, shape_flags, thickness, col))
+            return;
+    }
+    PathRect(a, b, rounding, flags);
     PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
@@ -1450,13 +1842,24 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCullRect(this, p_min.x - _FringeScale, p_min.y - _FringeScale, p_max.x + _FringeScale, p_max.y + _FringeScale))
+        return;
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
+        if ((Flags & ImDrawListFlags_QuadInstances) && PrimQuadInstance(p_min, p_max, _Data->TexUvWhitePixel, _Data->TexUvWhitePixel, col))
+            return;
         PrimReserve(6, 4);
         PrimRect(p_min, p_max, col);
     }
     else
     {
+        if (Flags & ImDrawListFlags_ShapeInstances)
+        {
+            ImDrawFlags shape_flags = flags;
+            const float shape_rounding = FixRectRounding(p_min, p_max, rounding, &shape_flags);
+            if (PrimShapeInstance(p_min, p_max, shape_rounding, shape_flags, 0.0f, col))
+                return;
+        }
         PathRect(p_min, p_max, rounding, flags);
         PathFillConvex(col);
     }
@@ -1467,6 +1870,8 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_ma
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCullRect(this, p_min.x, p_min.y, p_max.x, p_max.y))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     PrimReserve(6, 4);
@@ -1528,6 +1933,17 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    const float extent = radius + thickness * 0.5f + _FringeScale + 1.0f;
+    if (ImDrawListCullRect(this, center.x - extent, center.y - extent, center.x + extent, center.y + extent))
+        return;
+
+    // Shape instance (explicit segment counts lower than the automatic count are honored as polygons)
+    if ((Flags & ImDrawListFlags_ShapeInstances) && thickness > 0.0f && (num_segments <= 0 || num_segments >= _CalcCircleAutoSegmentCount(radius)))
+    {
+        const float path_radius = radius - 0.5f;
+        if (PrimShapeInstance(center - ImVec2(path_radius, path_radius), center + ImVec2(path_radius, path_radius), path_radius, ImDrawFlags_RoundCornersAll, thickness, col))
+            return;
+    }
 
     if (num_segments <= 0)
     {
@@ -1552,6 +1968,14 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    const float extent = radius + _FringeScale;
+    if (ImDrawListCullRect(this, center.x - extent, center.y - extent, center.x + extent, center.y + extent))
+        return;
+
+    // Shape instance (explicit segment counts lower than the automatic count are honored as polygons)
+    if ((Flags & ImDrawListFlags_ShapeInstances) && (num_segments <= 0 || num_segments >= _CalcCircleAutoSegmentCount(radius)))
+        if (PrimShapeInstance(center - ImVec2(radius, radius), center + ImVec2(radius, radius), radius, ImDrawFlags_RoundCornersAll, 0.0f, col))
+            return;
 
     if (num_segments <= 0)
     {
@@ -1674,6 +2098,14 @@ void ImDrawList::AddText(ImFont* font, float font_size, const ImVec2& pos, ImU32
         clip_rect.z = ImMin(clip_rect.z, cpu_fine_clip_rect->z);
         clip_rect.w = ImMin(clip_rect.w, cpu_fine_clip_rect->w);
     }
+
+    // Text extends to the right and bottom of 'pos' (glyphs may slightly overhang on the left), so we can only reject text starting past the clip rectangle.
+    // ImFont::RenderText() skips lines above the clip rectangle on its own.
+    if ((Flags & ImDrawListFlags_CullToClipRect) && (pos.x - font_size > clip_rect.z || pos.y > clip_rect.w))
+    {
+        _CulledCount++;
+        return;
+    }
     font->RenderText(this, font_size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip_rect != NULL);
 }
 
@@ -1682,17 +2114,78 @@ void ImDrawList::AddText(const ImVec2& pos, ImU32 col, const char* text_begin, c
     AddText(NULL, 0.0f, pos, col, text_begin, text_end);
 }
 
+// Append text previously shaped with ImFont::ShapeText(): no decoding, measuring or glyph lookup, only translating quads.
+void ImDrawList::AddShapedText(const ImFontShapedText* shaped_text, const ImVec2& pos, ImU32 col)
+{
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+    const int glyphs_count = shaped_text->Glyphs.Size;
+    if (glyphs_count == 0)
+        return;
+    IM_ASSERT(shaped_text->IsValid() && "Shaped text is stale. Atlas was rebuilt since ImFont::ShapeText() was called!");
+    IM_ASSERT(shaped_text->Font->ContainerAtlas->TexID == _CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+
+    // Align to be pixel perfect (same as ImFont::RenderText())
+    const float x = IM_TRUNC(pos.x);
+    const float y = IM_TRUNC(pos.y);
+
+    // Whole-block coarse clipping
+    const ImVec4& clip_rect = _CmdHeader.ClipRect;
+    if (x + shaped_text->BoundsMin.x > clip_rect.z || y + shaped_text->BoundsMin.y > clip_rect.w || x + shaped_text->BoundsMax.x < clip_rect.x || y + shaped_text->BoundsMax.y < clip_rect.y)
+    {
+        _CulledCount++;
+        return;
+    }
+
+    // Quad instances mode (glyph sizes are stored in 1/16th of pixels, see ImDrawQuad)
+    if ((Flags & ImDrawListFlags_QuadInstances) && shaped_text->FontSize < 2048.0f)
+    {
+        ImDrawQuad* quad_write = _PrimReserveQuads(glyphs_count);
+        for (const ImFontShapedGlyph& glyph : shaped_text->Glyphs)
+            ImDrawQuadWrite(quad_write++, x + glyph.P0.x, y + glyph.P0.y, x + glyph.P1.x, y + glyph.P1.y, glyph.UV0.x, glyph.UV0.y, glyph.UV1.x, glyph.UV1.y, col | glyph.ColMask);
+        return;
+    }
+
+    PrimReserve(glyphs_count * 6, glyphs_count * 4);
+    ImDrawVert* vtx_write = _VtxWritePtr;
+    ImDrawIdx* idx_write = _IdxWritePtr;
+    unsigned int vtx_index = _VtxCurrentIdx;
+    for (const ImFontShapedGlyph& glyph : shaped_text->Glyphs)
+    {
+        const float x1 = x + glyph.P0.x, y1 = y + glyph.P0.y;
+        const float x2 = x + glyph.P1.x, y2 = y + glyph.P1.y;
+        const ImU32 glyph_col = col | glyph.ColMask;
+        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = glyph.UV0.x; vtx_write[0].uv.y = glyph.UV0.y;
+        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = glyph.UV1.x; vtx_write[1].uv.y = glyph.UV0.y;
+        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = glyph.UV1.x; vtx_write[2].uv.y = glyph.UV1.y;
+        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = glyph.UV0.x; vtx_write[3].uv.y = glyph.UV1.y;
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+        vtx_write += 4;
+        vtx_index += 4;
+        idx_write += 6;
+    }
+    _VtxWritePtr = vtx_write;
+    _IdxWritePtr = idx_write;
+    _VtxCurrentIdx = vtx_index;
+}
+
 void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCullRect(this, p_min.x, p_min.y, p_max.x, p_max.y))
+        return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
         PushTextureID(user_texture_id);
 
-    PrimReserve(6, 4);
-    PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+    if (!(Flags & ImDrawListFlags_QuadInstances) || !PrimQuadInstance(p_min, p_max, uv_min, uv_max, col))
+    {
+        PrimReserve(6, 4);
+        PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+    }
 
     if (push_texture_id)
         PopTextureID();
@@ -1702,6 +2195,9 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, con
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    const ImVec2 points[4] = { p1, p2, p3, p4 };
+    if (ImDrawListCullPoints(this, points, 4, 0.0f))
+        return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
@@ -1714,74 +2210,959 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, con
         PopTextureID();
 }
 
-void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col, float rounding, ImDrawFlags flags)
+void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col, float rounding, ImDrawFlags flags)
+{
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+    if (ImDrawListCullRect(this, p_min.x - _FringeScale, p_min.y - _FringeScale, p_max.x + _FringeScale, p_max.y + _FringeScale))
+        return;
+
+    flags = FixRectCornerFlags(flags);
+    if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
+    {
+        AddImage(user_texture_id, p_min, p_max, uv_min, uv_max, col);
+        return;
+    }
+
+    const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
+    if (push_texture_id)
+        PushTextureID(user_texture_id);
+
+    int vert_start_idx = VtxBuffer.Size;
+    PathRect(p_min, p_max, rounding, flags);
+    PathFillConvex(col);
+    int vert_end_idx = VtxBuffer.Size;
+    ImGui::ShadeVertsLinearUV(this, vert_start_idx, vert_end_idx, p_min, p_max, uv_min, uv_max, true);
+
+    if (push_texture_id)
+        PopTextureID();
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawList bulk primitives
+//-----------------------------------------------------------------------------
+// Submit thousands of items with the same kind of geometry (e.g. scatter plots) without the per-call overhead of AddXXX() functions.
+// - Vertices and indices are reserved once per batch. Batches are small enough to fit in 16-bit indices, then culled
+//   or transparent items are given back with PrimUnreserve().
+// - Per-item geometry is derived from a template computed once per call (circle points and miters, index pattern).
+//-----------------------------------------------------------------------------
+// - AddLines()
+// - AddRectsFilled()
+// - AddCirclesFilled()
+//-----------------------------------------------------------------------------
+
+// Number of items per PrimReserve() call. Fill the room left in the current 16-bit vertex range before PrimReserve() starts a new one.
+static inline int ImDrawListBulkCalcBatchCount(const ImDrawList* draw_list, int vtx_per_item, int items_remaining)
+{
+    int batch_count = 0;
+    if (sizeof(ImDrawIdx) == 2 && (draw_list->Flags & ImDrawListFlags_AllowVtxOffset))
+        batch_count = ((1 << 16) - 1 - (int)draw_list->_VtxCurrentIdx) / vtx_per_item;
+    if (batch_count <= 0)
+        batch_count = ((1 << 16) - 1) / vtx_per_item;
+    return ImMin(batch_count, items_remaining);
+}
+
+// Same output as calling AddLine() for each line. Index and vertex layouts match AddPolyline() with 2 points.
+// (anti-aliased lines use the segment normal at the first point and its IM_FIXNORMAL2F() miter at the second point, as ImPolylineCalcMiters() does)
+void ImDrawList::AddLines(const ImVec2* points, const int lines_count, ImU32 col, float thickness, const ImU32* cols, ImDrawFlags flags)
+{
+    if (lines_count <= 0 || (cols == NULL && (col & IM_COL32_A_MASK) == 0))
+        return;
+
+    const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
+    const bool thick_line = (thickness > _FringeScale);
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const float AA_SIZE = _FringeScale;
+    if (anti_aliased)
+        thickness = ImMax(thickness, 1.0f);
+    const int integer_thickness = (int)thickness;
+    const float fractional_thickness = thickness - integer_thickness;
+    const bool use_texture = anti_aliased && (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+    IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
+
+    // Vertices per point: [PATH 1] 2 (textured), [PATH 2] 3 (thin) or 4 (thick), [PATH 4] 2 (not anti-aliased)
+    const int vtx_per_point = !anti_aliased ? 2 : use_texture ? 2 : thick_line ? 4 : 3;
+    const int vtx_per_line = vtx_per_point * 2;
+    const int idx_per_line = (!anti_aliased || use_texture) ? 6 : thick_line ? 18 : 12;
+
+    // Index pattern (relative to first vertex of a line), from AddPolyline() with idx1 = 0 and idx2 = vtx_per_point
+    static const unsigned char idx_pattern_2[6] = { 0, 1, 2, 0, 2, 3 };                                         // [PATH 4] (vertices are p1+n, p2+n, p2-n, p1-n)
+    static const unsigned char idx_pattern_tex[6] = { 2, 0, 1, 3, 1, 2 };                                       // [PATH 1]
+    static const unsigned char idx_pattern_thin[12] = { 3, 0, 2, 2, 5, 3, 4, 1, 0, 0, 3, 4 };                   // [PATH 2] non-thick
+    static const unsigned char idx_pattern_thick[18] = { 5, 1, 2, 2, 6, 5, 5, 1, 0, 0, 4, 5, 6, 2, 3, 3, 7, 6 }; // [PATH 2] thick
+    const unsigned char* idx_pattern = !anti_aliased ? idx_pattern_2 : use_texture ? idx_pattern_tex : thick_line ? idx_pattern_thick : idx_pattern_thin;
+
+    // Signed offsets along line normal for each vertex of a point (same as 'edge_offsets[]' in AddPolyline())
+    float offsets[4] = {};
+    if (!anti_aliased)                  { offsets[0] = thickness * 0.5f; offsets[1] = -thickness * 0.5f; }
+    else if (use_texture)               { offsets[0] = (thickness * 0.5f) + 1; offsets[1] = -offsets[0]; }
+    else if (!thick_line)               { offsets[0] = 0.0f; offsets[1] = AA_SIZE; offsets[2] = -AA_SIZE; }
+    else                                { const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f; offsets[0] = half_inner_thickness + AA_SIZE; offsets[1] = half_inner_thickness; offsets[2] = -half_inner_thickness; offsets[3] = -(half_inner_thickness + AA_SIZE); }
+    const bool has_trans_fringe = anti_aliased && !use_texture; // Outer vertices of [PATH 2] use a transparent color
+    const bool vtx_opaque[4] = { !has_trans_fringe || !thick_line, !has_trans_fringe || thick_line, !has_trans_fringe || thick_line, !has_trans_fringe };
+    ImVec2 uvs[4] = { opaque_uv, opaque_uv, opaque_uv, opaque_uv };
+    if (use_texture)
+    {
+        const ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
+        uvs[0] = ImVec2(tex_uvs.x, tex_uvs.y);
+        uvs[1] = ImVec2(tex_uvs.z, tex_uvs.w);
+    }
+    const float cull_pad = ImMax(thickness, 1.0f) * 0.5f + AA_SIZE + 1.0f; // Same as AddLine()
+    const bool cull = (flags & ImDrawFlags_CullItems) || (Flags & ImDrawListFlags_CullToClipRect);
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+
+    for (int batch_start = 0, batch_count = 0; batch_start < lines_count; batch_start += batch_count)
+    {
+        batch_count = ImDrawListBulkCalcBatchCount(this, vtx_per_line, lines_count - batch_start);
+        PrimReserve(batch_count * idx_per_line, batch_count * vtx_per_line);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int vtx_idx = _VtxCurrentIdx;
+        for (int line_n = batch_start; line_n < batch_start + batch_count; line_n++)
+        {
+            const ImU32 line_col = cols ? cols[line_n] : col;
+            if ((line_col & IM_COL32_A_MASK) == 0)
+                continue;
+            const ImVec2 p1_src = points[line_n * 2 + 0];
+            const ImVec2 p2_src = points[line_n * 2 + 1];
+            if (cull && ImDrawListIsRectClipped(clip_rect, ImMin(p1_src.x, p2_src.x) - cull_pad, ImMin(p1_src.y, p2_src.y) - cull_pad, ImMax(p1_src.x, p2_src.x) + cull_pad, ImMax(p1_src.y, p2_src.y) + cull_pad))
+            {
+                _CulledCount++;
+                continue;
+            }
+            const ImVec2 p1(p1_src.x + 0.5f, p1_src.y + 0.5f);
+            const ImVec2 p2(p2_src.x + 0.5f, p2_src.y + 0.5f);
+
+            float nx = p2.x - p1.x;
+            float ny = p2.y - p1.y;
+            IM_NORMALIZE2F_OVER_ZERO(nx, ny);
+            const float tmp = nx; nx = ny; ny = -tmp; // Normal, as ImPolylineCalcNormals()
+            const ImU32 line_col_trans = line_col & ~IM_COL32_A_MASK;
+
+            if (!anti_aliased)
+            {
+                vtx_write[0].pos.x = p1.x + nx * offsets[0]; vtx_write[0].pos.y = p1.y + ny * offsets[0]; vtx_write[0].uv = opaque_uv; vtx_write[0].col = line_col;
+                vtx_write[1].pos.x = p2.x + nx * offsets[0]; vtx_write[1].pos.y = p2.y + ny * offsets[0]; vtx_write[1].uv = opaque_uv; vtx_write[1].col = line_col;
+                vtx_write[2].pos.x = p2.x + nx * offsets[1]; vtx_write[2].pos.y = p2.y + ny * offsets[1]; vtx_write[2].uv = opaque_uv; vtx_write[2].col = line_col;
+                vtx_write[3].pos.x = p1.x + nx * offsets[1]; vtx_write[3].pos.y = p1.y + ny * offsets[1]; vtx_write[3].uv = opaque_uv; vtx_write[3].col = line_col;
+            }
+            else
+            {
+                float mx = nx, my = ny;
+                IM_FIXNORMAL2F(mx, my);
+                for (int point_n = 0; point_n < 2; point_n++)
+                {
+                    const ImVec2& p = point_n ? p2 : p1;
+                    const float dir_x = point_n ? mx : nx;
+                    const float dir_y = point_n ? my : ny;
+                    ImDrawVert* v = vtx_write + point_n * vtx_per_point;
+                    for (int n = 0; n < vtx_per_point; n++)
+                    {
+                        v[n].pos.x = p.x + dir_x * offsets[n];
+                        v[n].pos.y = p.y + dir_y * offsets[n];
+                        v[n].uv = uvs[n];
+                        v[n].col = vtx_opaque[n] ? line_col : line_col_trans;
+                    }
+                }
+            }
+            vtx_write += vtx_per_line;
+
+            for (int n = 0; n < idx_per_line; n++)
+                idx_write[n] = (ImDrawIdx)(vtx_idx + idx_pattern[n]);
+            idx_write += idx_per_line;
+            vtx_idx += vtx_per_line;
+        }
+        const int skipped_count = batch_count - (int)(vtx_write - _VtxWritePtr) / vtx_per_line;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = vtx_idx;
+        PrimUnreserve(skipped_count * idx_per_line, skipped_count * vtx_per_line);
+    }
+}
+
+// Same output as calling AddRectFilled() with no rounding for each rectangle.
+void ImDrawList::AddRectsFilled(const ImVec2* p_min, const int rects_count, const ImVec2& size, ImU32 col, const ImVec2* sizes, const ImU32* cols, ImDrawFlags flags)
+{
+    if (rects_count <= 0 || (cols == NULL && (col & IM_COL32_A_MASK) == 0))
+        return;
+
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const bool cull = (flags & ImDrawFlags_CullItems) || (Flags & ImDrawListFlags_CullToClipRect);
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+
+    // Textured quad instances. A rectangle too large to be represented ends the current run of instances and is output
+    // as vertices, so submission order is preserved.
+    if (Flags & ImDrawListFlags_QuadInstances)
+    {
+        for (int rect_n = 0; rect_n < rects_count; )
+        {
+            const int reserve_count = rects_count - rect_n;
+            ImDrawQuad* quad_write_start = _PrimReserveQuads(reserve_count);
+            ImDrawQuad* quad_write = quad_write_start;
+            int fallback_n = -1;
+            for (; rect_n < rects_count && fallback_n == -1; rect_n++)
+            {
+                const ImU32 rect_col = cols ? cols[rect_n] : col;
+                const ImVec2 rect_size = sizes ? sizes[rect_n] : size;
+                const float x1 = p_min[rect_n].x, y1 = p_min[rect_n].y, x2 = x1 + rect_size.x, y2 = y1 + rect_size.y;
+                if ((rect_col & IM_COL32_A_MASK) == 0)
+                    continue;
+                if (cull && ImDrawListIsRectClipped(clip_rect, x1, y1, x2, y2))
+                {
+                    _CulledCount++;
+                    continue;
+                }
+                if (!(rect_size.x >= 0.0f && rect_size.y >= 0.0f && rect_size.x < 4095.0f && rect_size.y < 4095.0f))
+                    fallback_n = rect_n;
+                else
+                    ImDrawQuadWrite(quad_write++, x1, y1, x2, y2, uv.x, uv.y, uv.x, uv.y, rect_col);
+            }
+            const int unused_count = reserve_count - (int)(quad_write - quad_write_start);
+            CmdBuffer.Data[CmdBuffer.Size - 1].ElemCount -= unused_count;
+            QuadBuffer.shrink(QuadBuffer.Size - unused_count);
+            if (fallback_n != -1)
+            {
+                const ImVec2 rect_min = p_min[fallback_n];
+                const ImVec2 rect_size = sizes ? sizes[fallback_n] : size;
+                PrimReserve(6, 4);
+                PrimRect(rect_min, ImVec2(rect_min.x + rect_size.x, rect_min.y + rect_size.y), cols ? cols[fallback_n] : col);
+            }
+        }
+        return;
+    }
+
+    for (int batch_start = 0, batch_count = 0; batch_start < rects_count; batch_start += batch_count)
+    {
+        batch_count = ImDrawListBulkCalcBatchCount(this, 4, rects_count - batch_start);
+        PrimReserve(batch_count * 6, batch_count * 4);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int vtx_idx = _VtxCurrentIdx;
+        for (int rect_n = batch_start; rect_n < batch_start + batch_count; rect_n++)
+        {
+            const ImU32 rect_col = cols ? cols[rect_n] : col;
+            const ImVec2 rect_size = sizes ? sizes[rect_n] : size;
+            const float x1 = p_min[rect_n].x, y1 = p_min[rect_n].y, x2 = x1 + rect_size.x, y2 = y1 + rect_size.y;
+            if ((rect_col & IM_COL32_A_MASK) == 0)
+                continue;
+            if (cull && ImDrawListIsRectClipped(clip_rect, x1, y1, x2, y2))
+            {
+                _CulledCount++;
+                continue;
+            }
+            idx_write[0] = (ImDrawIdx)vtx_idx; idx_write[1] = (ImDrawIdx)(vtx_idx + 1); idx_write[2] = (ImDrawIdx)(vtx_idx + 2);
+            idx_write[3] = (ImDrawIdx)vtx_idx; idx_write[4] = (ImDrawIdx)(vtx_idx + 2); idx_write[5] = (ImDrawIdx)(vtx_idx + 3);
+            vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].uv = uv; vtx_write[0].col = rect_col;
+            vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].uv = uv; vtx_write[1].col = rect_col;
+            vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].uv = uv; vtx_write[2].col = rect_col;
+            vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].uv = uv; vtx_write[3].col = rect_col;
+            vtx_write += 4;
+            idx_write += 6;
+            vtx_idx += 4;
+        }
+        const int skipped_count = batch_count - (int)(vtx_write - _VtxWritePtr) / 4;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = vtx_idx;
+        PrimUnreserve(skipped_count * 6, skipped_count * 4);
+    }
+}
+
+// Visually equivalent to calling AddCircleFilled() with automatic segment count for each circle:
+// - All circles use the tessellation of the largest one.
+// - Anti-aliasing fringes are offset along the normals of a unit circle computed once, instead of per circle. Fringe vertices may differ by ~0.001 pixels.
+void ImDrawList::AddCirclesFilled(const ImVec2* centers, const int circles_count, float radius, ImU32 col, const float* radii, const ImU32* cols, ImDrawFlags flags)
+{
+    if (circles_count <= 0 || (cols == NULL && (col & IM_COL32_A_MASK) == 0))
+        return;
+
+    float max_radius = radius;
+    if (radii != NULL)
+    {
+        max_radius = 0.0f;
+        for (int circle_n = 0; circle_n < circles_count; circle_n++)
+            max_radius = ImMax(max_radius, radii[circle_n]);
+    }
+    if (max_radius < 0.5f)
+        return;
+
+    const bool cull = (flags & ImDrawFlags_CullItems) || (Flags & ImDrawListFlags_CullToClipRect);
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    const float AA_SIZE = _FringeScale;
+    const float cull_pad = AA_SIZE; // Same as AddCircleFilled()
+
+    // Shape instances (same encoding as PrimShapeInstance() with rounding == radius, all corners and thickness == 0.0f).
+    // A circle too large to be represented ends the current run of instances and is output with AddCircleFilled(), so submission order is preserved.
+    if (Flags & ImDrawListFlags_ShapeInstances)
+    {
+        const ImU16 shape_flags = (ImU16)((anti_aliased ? 0x10 : 0x00) | (ImDrawFlags_RoundCornersAll >> 4));
+        for (int circle_n = 0; circle_n < circles_count; )
+        {
+            const int reserve_count = circles_count - circle_n;
+            ImDrawQuad* quad_write_start = _PrimReserveQuads(reserve_count, ImDrawQuadKind_Shape);
+            ImDrawQuad* quad_write = quad_write_start;
+            int fallback_n = -1;
+            for (; circle_n < circles_count && fallback_n == -1; circle_n++)
+            {
+                const ImU32 circle_col = cols ? cols[circle_n] : col;
+                const float r = radii ? radii[circle_n] : radius;
+                const ImVec2 c = centers[circle_n];
+                if ((circle_col & IM_COL32_A_MASK) == 0 || r < 0.5f)
+                    continue;
+                if (cull && ImDrawListIsRectClipped(clip_rect, c.x - r - cull_pad, c.y - r - cull_pad, c.x + r + cull_pad, c.y + r + cull_pad))
+                {
+                    _CulledCount++;
+                    continue;
+                }
+                if (!(r * 2.0f + 2.0f < 4095.0f))
+                {
+                    fallback_n = circle_n;
+                    continue;
+                }
+                const ImU16 size16 = (ImU16)((r * 2.0f + 2.0f) * 16.0f + 0.5f);
+                quad_write->Pos = ImVec2(c.x - r - 1.0f, c.y - r - 1.0f);
+                quad_write->Size[0] = quad_write->Size[1] = size16;
+                quad_write->UV[0] = (ImU16)(r * 16.0f + 0.5f);
+                quad_write->UV[1] = 0;
+                quad_write->UV[2] = shape_flags;
+                quad_write->UV[3] = 16;
+                quad_write->Col = circle_col;
+                quad_write++;
+            }
+            const int unused_count = reserve_count - (int)(quad_write - quad_write_start);
+            CmdBuffer.Data[CmdBuffer.Size - 1].ElemCount -= unused_count;
+            QuadBuffer.shrink(QuadBuffer.Size - unused_count);
+            if (fallback_n != -1)
+                AddCircleFilled(centers[fallback_n], radii ? radii[fallback_n] : radius, cols ? cols[fallback_n] : col);
+        }
+        return;
+    }
+
+    // Unit circle template: same samples as AddCircleFilled() -> _PathArcToFastEx(), then miters for the anti-aliased fringe as in AddConvexPolyFilled()
+    const int a_step = ImClamp(IM_DRAWLIST_ARCFAST_SAMPLE_MAX / _CalcCircleAutoSegmentCount(max_radius), 1, IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4);
+    const int path_size = _Path.Size;
+    _PathArcToFastEx(ImVec2(0.0f, 0.0f), 1.0f, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, a_step);
+    const int points_count = _Path.Size - path_size - 1;
+    IM_ASSERT(points_count >= 3 && points_count <= IM_DRAWLIST_ARCFAST_SAMPLE_MAX);
+    _Data->TempBuffer.reserve_discard(points_count * 3);
+    ImVec2* temp_points = _Data->TempBuffer.Data;
+    ImVec2* temp_normals = temp_points + points_count;
+    ImVec2* temp_miters = temp_normals + points_count;
+    memcpy(temp_points, _Path.Data + path_size, points_count * sizeof(ImVec2));
+    _Path.Size = path_size;
+    if (anti_aliased)
+    {
+        ImPolylineCalcNormals(temp_points, points_count, points_count, temp_normals);
+        ImPolylineCalcMiters(temp_normals, points_count, true, temp_miters);
+        for (int i = 0; i < points_count; i++)
+            temp_miters[i] *= AA_SIZE * 0.5f;
+    }
+
+    // Index pattern (relative to first vertex of a circle), same as AddConvexPolyFilled()
+    unsigned char idx_pattern[(IM_DRAWLIST_ARCFAST_SAMPLE_MAX - 2) * 3 + IM_DRAWLIST_ARCFAST_SAMPLE_MAX * 6];
+    IM_STATIC_ASSERT(IM_DRAWLIST_ARCFAST_SAMPLE_MAX * 2 <= 256);
+    const int vtx_per_circle = anti_aliased ? points_count * 2 : points_count;
+    const int idx_per_circle = anti_aliased ? (points_count - 2) * 3 + points_count * 6 : (points_count - 2) * 3;
+    const int vtx_stride = anti_aliased ? 2 : 1;
+    int idx_n = 0;
+    for (int i = 2; i < points_count; i++)
+    {
+        idx_pattern[idx_n++] = 0;
+        idx_pattern[idx_n++] = (unsigned char)((i - 1) * vtx_stride);
+        idx_pattern[idx_n++] = (unsigned char)(i * vtx_stride);
+    }
+    if (anti_aliased)
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            idx_pattern[idx_n++] = (unsigned char)(i1 << 1); idx_pattern[idx_n++] = (unsigned char)(i0 << 1); idx_pattern[idx_n++] = (unsigned char)((i0 << 1) + 1);
+            idx_pattern[idx_n++] = (unsigned char)((i0 << 1) + 1); idx_pattern[idx_n++] = (unsigned char)((i1 << 1) + 1); idx_pattern[idx_n++] = (unsigned char)(i1 << 1);
+        }
+    IM_ASSERT(idx_n == idx_per_circle);
+
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    for (int batch_start = 0, batch_count = 0; batch_start < circles_count; batch_start += batch_count)
+    {
+        batch_count = ImDrawListBulkCalcBatchCount(this, vtx_per_circle, circles_count - batch_start);
+        PrimReserve(batch_count * idx_per_circle, batch_count * vtx_per_circle);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int vtx_idx = _VtxCurrentIdx;
+        for (int circle_n = batch_start; circle_n < batch_start + batch_count; circle_n++)
+        {
+            const ImU32 circle_col = cols ? cols[circle_n] : col;
+            const float r = radii ? radii[circle_n] : radius;
+            const ImVec2 c = centers[circle_n];
+            if ((circle_col & IM_COL32_A_MASK) == 0 || r < 0.5f)
+                continue;
+            if (cull && ImDrawListIsRectClipped(clip_rect, c.x - r - cull_pad, c.y - r - cull_pad, c.x + r + cull_pad, c.y + r + cull_pad))
+            {
+                _CulledCount++;
+                continue;
+            }
+
+            if (anti_aliased)
+            {
+                const ImU32 circle_col_trans = circle_col & ~IM_COL32_A_MASK;
+                for (int i = 0; i < points_count; i++)
+                {
+                    const float x = c.x + temp_points[i].x * r;
+                    const float y = c.y + temp_points[i].y * r;
+                    vtx_write[0].pos.x = x - temp_miters[i].x; vtx_write[0].pos.y = y - temp_miters[i].y; vtx_write[0].uv = uv; vtx_write[0].col = circle_col;       // Inner
+                    vtx_write[1].pos.x = x + temp_miters[i].x; vtx_write[1].pos.y = y + temp_miters[i].y; vtx_write[1].uv = uv; vtx_write[1].col = circle_col_trans; // Outer
+                    vtx_write += 2;
+                }
+            }
+            else
+            {
+                for (int i = 0; i < points_count; i++)
+                {
+                    vtx_write[0].pos.x = c.x + temp_points[i].x * r; vtx_write[0].pos.y = c.y + temp_points[i].y * r; vtx_write[0].uv = uv; vtx_write[0].col = circle_col;
+                    vtx_write++;
+                }
+            }
+            for (int n = 0; n < idx_per_circle; n++)
+                idx_write[n] = (ImDrawIdx)(vtx_idx + idx_pattern[n]);
+            idx_write += idx_per_circle;
+            vtx_idx += vtx_per_circle;
+        }
+        const int skipped_count = batch_count - (int)(vtx_write - _VtxWritePtr) / vtx_per_circle;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = vtx_idx;
+        PrimUnreserve(skipped_count * idx_per_circle, skipped_count * vtx_per_circle);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImTriangulator, ImDrawList concave polygon fill
+//-----------------------------------------------------------------------------
+// Triangulate concave polygons. Based on "Triangulation by Ear Clipping" paper, O(N^2) complexity.
+// Reference: https://www.geometrictools.com/Documentation/TriangulationByEarClipping.pdf
+// Polygons with IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS points or more are decomposed into monotone pieces instead, O(N log N) complexity.
+// Provided as a convenience for user but not used by main library.
+//-----------------------------------------------------------------------------
+// - ImTriangulatorMonotone [Internal]
+// - ImTriangulator [Internal]
+// - AddConcavePolyFilled()
+//-----------------------------------------------------------------------------
+
+enum ImTriangulatorNodeType
+{
+    ImTriangulatorNodeType_Convex,
+    ImTriangulatorNodeType_Ear,
+    ImTriangulatorNodeType_Reflex
+};
+
+struct ImTriangulatorNode
+{
+    ImTriangulatorNodeType  Type;
+    int                     Index;
+    ImVec2                  Pos;
+    ImTriangulatorNode*     Next;
+    ImTriangulatorNode*     Prev;
+
+    void    Unlink()        { Next->Prev = Prev; Prev->Next = Next; }
+};
+
+struct ImTriangulatorNodeSpan
+{
+    ImTriangulatorNode**    Data = NULL;
+    int                     Size = 0;
+
+    void    push_back(ImTriangulatorNode* node) { Data[Size++] = node; }
+    void    find_erase_unsorted(int idx)        { for (int i = Size - 1; i >= 0; i--) if (Data[i]->Index == idx) { Data[i] = Data[Size - 1]; Size--; return; } }
+};
+
+//-----------------------------------------------------------------------------
+// Monotone decomposition, used by ImTriangulator for polygons with many points. O(N log N) complexity.
+// Reference: "Computational Geometry: Algorithms and Applications", de Berg et al., chapter 3.
+// - Sweep points from top to bottom (ties broken by x then index), classify them as start/split/end/merge/regular vertices
+//   and add diagonals removing split and merge vertices. Edges crossing the sweep line are kept in a treap (balanced binary tree).
+// - Walk the faces created by those diagonals, each of them is y-monotone and triangulated in linear time.
+// All storage comes from the scratch buffer. Degenerate geometry (self-intersections, duplicate or collinear points) may
+// fail to produce N-2 triangles: Build() then returns false and the caller falls back to ear clipping.
+//-----------------------------------------------------------------------------
+
+enum ImTriangulatorVertexType
+{
+    ImTriangulatorVertexType_Regular,
+    ImTriangulatorVertexType_Start,
+    ImTriangulatorVertexType_End,
+    ImTriangulatorVertexType_Split,
+    ImTriangulatorVertexType_Merge
+};
+
+struct ImTriangulatorMonotone
+{
+    static int EstimateScratchBufferSize(int points_count)  { return sizeof(int) * (points_count * 29 + 1); }
+
+    bool    Build(const ImVec2* points, int points_count, void* scratch_buffer);   // Write (points_count - 2) triangles to _Triangles, return false on degenerate geometry
+
+    // Internal functions
+    int     Next(int i) const                   { return _Flip ? (i == 0 ? _PointsCount - 1 : i - 1) : (i + 1 == _PointsCount ? 0 : i + 1); }
+    int     Prev(int i) const                   { return _Flip ? (i + 1 == _PointsCount ? 0 : i + 1) : (i == 0 ? _PointsCount - 1 : i - 1); }
+    double  Orient(int a, int b, int c) const   { const ImVec2& pa = _Points[a]; const ImVec2& pb = _Points[b]; const ImVec2& pc = _Points[c]; return ((double)pb.x - pa.x) * ((double)pa.y - pc.y) - ((double)pa.y - pb.y) * ((double)pc.x - pa.x); } // > 0.0: counter-clockwise with y pointing up. Using doubles so sign is exact for nearly collinear points.
+    bool    IsEdgeLeftOf(int e, int v) const    { return Orient(e, Next(e), v) > 0.0; }  // Edge 'e' goes from point 'e' down to point Next(e)
+    static unsigned int EdgePriority(int e)     { return (unsigned int)e * 2654435761u; }
+    void    EdgeRotateUp(int e);
+    void    EdgeInsert(int e);
+    void    EdgeRemove(int e);
+    int     EdgeFindLeftOf(int v) const;
+    bool    AddDiagonal(int a, int b);
+    bool    Sweep();
+    bool    TriangulateFaces();
+    bool    TriangulateMonotoneFace(const int* face, int face_count);
+
+    // Internal members
+    const ImVec2*   _Points = NULL;
+    int             _PointsCount = 0;
+    bool            _Flip = false;              // Walk points backward so that polygon is counter-clockwise with y pointing up (interior on the left of edges)
+    int*            _Rank = NULL;               // [points_count] Position in sweep order
+    int*            _Order = NULL;              // [points_count] Points sorted in sweep order
+    int*            _Type = NULL;               // [points_count] ImTriangulatorVertexType
+    int*            _EdgeLeft = NULL;           // [points_count] Treap of edges crossing the sweep line, ordered left to right. Edge N goes from point N to Next(N).
+    int*            _EdgeRight = NULL;          // [points_count]
+    int*            _EdgeParent = NULL;         // [points_count]
+    int*            _EdgeHelper = NULL;         // [points_count] -1 when edge is not in tree
+    int             _EdgeRoot = -1;
+    int*            _Diagonals = NULL;          // [points_count * 2]
+    int             _DiagonalsCount = 0;
+    int*            _HalfEdgeOrig = NULL;       // [points_count * 3] Polygon edges followed by two half-edges per diagonal
+    int*            _HalfEdgeDest = NULL;       // [points_count * 3]
+    int*            _HalfEdgeNext = NULL;       // [points_count * 3]
+    int*            _VertexHalfEdgesOffset = NULL;  // [points_count + 1]
+    int*            _VertexHalfEdges = NULL;    // [points_count * 3]
+    int*            _Face = NULL;               // [points_count]
+    int*            _FaceSorted = NULL;         // [points_count]
+    int*            _FaceSide = NULL;           // [points_count]
+    int*            _Stack = NULL;              // [points_count]
+    unsigned int*   _Triangles = NULL;          // [points_count * 3]
+    int             _TrianglesCount = 0;
+};
+
+struct ImTriangulatorSortKey
+{
+    float   Y, X;
+    int     Index;
+};
+
+static int IMGUI_CDECL TriangulatorSortKeyComparer(const void* lhs, const void* rhs)
+{
+    const ImTriangulatorSortKey* a = (const ImTriangulatorSortKey*)lhs;
+    const ImTriangulatorSortKey* b = (const ImTriangulatorSortKey*)rhs;
+    if (a->Y != b->Y) return (a->Y < b->Y) ? -1 : +1;
+    if (a->X != b->X) return (a->X < b->X) ? -1 : +1;
+    return a->Index - b->Index;
+}
+
+bool ImTriangulatorMonotone::Build(const ImVec2* points, int points_count, void* scratch_buffer)
+{
+    IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
+    const int n = points_count;
+    _Points = points;
+    _PointsCount = n;
+    int* p = (int*)scratch_buffer;
+    _Rank = p;              p += n;
+    _Order = p;             p += n;
+    _Type = p;              p += n;
+    _EdgeLeft = p;          p += n;
+    _EdgeRight = p;         p += n;
+    _EdgeParent = p;        p += n;
+    _EdgeHelper = p;        p += n;
+    _Diagonals = p;         p += n * 2;
+    _HalfEdgeOrig = p;      p += n * 3;
+    _HalfEdgeDest = p;      p += n * 3;
+    _HalfEdgeNext = p;      p += n * 3;
+    _VertexHalfEdgesOffset = p; p += n + 1;
+    _VertexHalfEdges = p;   p += n * 3;
+    _Face = p;              p += n;
+    _FaceSorted = p;        p += n;
+    _FaceSide = p;          p += n;
+    _Stack = p;             p += n;
+    _Triangles = (unsigned int*)p; p += n * 3;
+    IM_ASSERT((char*)p - (char*)scratch_buffer == EstimateScratchBufferSize(n));
+    _EdgeRoot = -1;
+    _DiagonalsCount = 0;
+    _TrianglesCount = 0;
+
+    // Orientation (we want counter-clockwise with y pointing up, which is clockwise with y pointing down)
+    float area = 0.0f;
+    for (int i0 = n - 1, i1 = 0; i1 < n; i0 = i1++)
+        area += (points[i0].x * points[i1].y) - (points[i1].x * points[i0].y);
+    _Flip = (area > 0.0f);
+
+    // Sort points in sweep order (sort keys temporarily use the half-edges storage, 9 ints per point)
+    ImTriangulatorSortKey* keys = (ImTriangulatorSortKey*)(void*)_HalfEdgeOrig;
+    for (int i = 0; i < n; i++)
+    {
+        keys[i].Y = points[i].y;
+        keys[i].X = points[i].x;
+        keys[i].Index = i;
+    }
+    ImQsort(keys, (size_t)n, sizeof(ImTriangulatorSortKey), TriangulatorSortKeyComparer);
+    for (int i = 0; i < n; i++)
+    {
+        _Order[i] = keys[i].Index;
+        _Rank[keys[i].Index] = i;
+    }
+
+    if (!Sweep())
+        return false;
+    return TriangulateFaces() && _TrianglesCount == n - 2;
+}
+
+void ImTriangulatorMonotone::EdgeRotateUp(int e)
+{
+    const int parent = _EdgeParent[e];
+    const int grand_parent = _EdgeParent[parent];
+    if (_EdgeLeft[parent] == e)
+    {
+        _EdgeLeft[parent] = _EdgeRight[e];
+        if (_EdgeRight[e] != -1)
+            _EdgeParent[_EdgeRight[e]] = parent;
+        _EdgeRight[e] = parent;
+    }
+    else
+    {
+        _EdgeRight[parent] = _EdgeLeft[e];
+        if (_EdgeLeft[e] != -1)
+            _EdgeParent[_EdgeLeft[e]] = parent;
+        _EdgeLeft[e] = parent;
+    }
+    _EdgeParent[parent] = e;
+    _EdgeParent[e] = grand_parent;
+    if (grand_parent == -1)
+        _EdgeRoot = e;
+    else if (_EdgeLeft[grand_parent] == parent)
+        _EdgeLeft[grand_parent] = e;
+    else
+        _EdgeRight[grand_parent] = e;
+}
+
+// Insert edge starting at current sweep point 'e'
+void ImTriangulatorMonotone::EdgeInsert(int e)
+{
+    int parent = -1;
+    bool to_right = false;
+    for (int node = _EdgeRoot; node != -1; node = to_right ? _EdgeRight[node] : _EdgeLeft[node])
+    {
+        parent = node;
+        to_right = IsEdgeLeftOf(node, e);
+    }
+    _EdgeLeft[e] = _EdgeRight[e] = -1;
+    _EdgeParent[e] = parent;
+    if (parent == -1)
+        _EdgeRoot = e;
+    else if (to_right)
+        _EdgeRight[parent] = e;
+    else
+        _EdgeLeft[parent] = e;
+    while (_EdgeParent[e] != -1 && EdgePriority(e) > EdgePriority(_EdgeParent[e]))
+        EdgeRotateUp(e);
+}
+
+void ImTriangulatorMonotone::EdgeRemove(int e)
+{
+    while (_EdgeLeft[e] != -1 || _EdgeRight[e] != -1)
+    {
+        const int l = _EdgeLeft[e], r = _EdgeRight[e];
+        EdgeRotateUp((l == -1) ? r : (r == -1) ? l : (EdgePriority(l) > EdgePriority(r)) ? l : r);
+    }
+    const int parent = _EdgeParent[e];
+    if (parent == -1)
+        _EdgeRoot = -1;
+    else if (_EdgeLeft[parent] == e)
+        _EdgeLeft[parent] = -1;
+    else
+        _EdgeRight[parent] = -1;
+    _EdgeHelper[e] = -1;
+}
+
+// Return closest edge on the left of point 'v', or -1
+int ImTriangulatorMonotone::EdgeFindLeftOf(int v) const
+{
+    int best = -1;
+    for (int node = _EdgeRoot; node != -1; )
+    {
+        if (IsEdgeLeftOf(node, v))
+        {
+            best = node;
+            node = _EdgeRight[node];
+        }
+        else
+        {
+            node = _EdgeLeft[node];
+        }
+    }
+    return best;
+}
+
+bool ImTriangulatorMonotone::AddDiagonal(int a, int b)
 {
-    if ((col & IM_COL32_A_MASK) == 0)
-        return;
+    // A simple polygon never has more than N-3 non-crossing diagonals
+    if (a == b || _DiagonalsCount >= _PointsCount - 3)
+        return false;
+    _Diagonals[_DiagonalsCount * 2 + 0] = a;
+    _Diagonals[_DiagonalsCount * 2 + 1] = b;
+    _DiagonalsCount++;
+    return true;
+}
 
-    flags = FixRectCornerFlags(flags);
-    if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
+// Add diagonals to split polygon into y-monotone pieces
+bool ImTriangulatorMonotone::Sweep()
+{
+    for (int i = 0; i < _PointsCount; i++)
     {
-        AddImage(user_texture_id, p_min, p_max, uv_min, uv_max, col);
-        return;
+        const int prev = Prev(i), next = Next(i);
+        const bool prev_below = _Rank[prev] > _Rank[i];
+        const bool next_below = _Rank[next] > _Rank[i];
+        const bool convex = Orient(prev, i, next) >= 0.0;
+        if (prev_below && next_below)
+            _Type[i] = convex ? ImTriangulatorVertexType_Start : ImTriangulatorVertexType_Split;
+        else if (!prev_below && !next_below)
+            _Type[i] = convex ? ImTriangulatorVertexType_End : ImTriangulatorVertexType_Merge;
+        else
+            _Type[i] = ImTriangulatorVertexType_Regular;
+        _EdgeHelper[i] = -1;
     }
 
-    const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
-    if (push_texture_id)
-        PushTextureID(user_texture_id);
-
-    int vert_start_idx = VtxBuffer.Size;
-    PathRect(p_min, p_max, rounding, flags);
-    PathFillConvex(col);
-    int vert_end_idx = VtxBuffer.Size;
-    ImGui::ShadeVertsLinearUV(this, vert_start_idx, vert_end_idx, p_min, p_max, uv_min, uv_max, true);
-
-    if (push_texture_id)
-        PopTextureID();
+    for (int order_n = 0; order_n < _PointsCount; order_n++)
+    {
+        const int v = _Order[order_n];
+        const int prev_edge = Prev(v);
+        switch (_Type[v])
+        {
+        case ImTriangulatorVertexType_Start:
+            EdgeInsert(v);
+            _EdgeHelper[v] = v;
+            break;
+        case ImTriangulatorVertexType_End:
+        case ImTriangulatorVertexType_Merge:
+        {
+            if (_EdgeHelper[prev_edge] == -1)
+                return false;
+            if (_Type[_EdgeHelper[prev_edge]] == ImTriangulatorVertexType_Merge && !AddDiagonal(v, _EdgeHelper[prev_edge]))
+                return false;
+            EdgeRemove(prev_edge);
+            if (_Type[v] == ImTriangulatorVertexType_End)
+                break;
+            const int left_edge = EdgeFindLeftOf(v);
+            if (left_edge == -1)
+                return false;
+            if (_Type[_EdgeHelper[left_edge]] == ImTriangulatorVertexType_Merge && !AddDiagonal(v, _EdgeHelper[left_edge]))
+                return false;
+            _EdgeHelper[left_edge] = v;
+            break;
+        }
+        case ImTriangulatorVertexType_Split:
+        {
+            const int left_edge = EdgeFindLeftOf(v);
+            if (left_edge == -1 || !AddDiagonal(v, _EdgeHelper[left_edge]))
+                return false;
+            _EdgeHelper[left_edge] = v;
+            EdgeInsert(v);
+            _EdgeHelper[v] = v;
+            break;
+        }
+        case ImTriangulatorVertexType_Regular:
+            if (_Rank[prev_edge] < _Rank[v])
+            {
+                // Polygon interior is on the right of point: previous edge ends here, next edge starts here
+                if (_EdgeHelper[prev_edge] == -1)
+                    return false;
+                if (_Type[_EdgeHelper[prev_edge]] == ImTriangulatorVertexType_Merge && !AddDiagonal(v, _EdgeHelper[prev_edge]))
+                    return false;
+                EdgeRemove(prev_edge);
+                EdgeInsert(v);
+                _EdgeHelper[v] = v;
+            }
+            else
+            {
+                const int left_edge = EdgeFindLeftOf(v);
+                if (left_edge == -1)
+                    return false;
+                if (_Type[_EdgeHelper[left_edge]] == ImTriangulatorVertexType_Merge && !AddDiagonal(v, _EdgeHelper[left_edge]))
+                    return false;
+                _EdgeHelper[left_edge] = v;
+            }
+            break;
+        }
+    }
+    return true;
 }
 
-//-----------------------------------------------------------------------------
-// [SECTION] ImTriangulator, ImDrawList concave polygon fill
-//-----------------------------------------------------------------------------
-// Triangulate concave polygons. Based on "Triangulation by Ear Clipping" paper, O(N^2) complexity.
-// Reference: https://www.geometrictools.com/Documentation/TriangulationByEarClipping.pdf
-// Provided as a convenience for user but not used by main library.
-//-----------------------------------------------------------------------------
-// - ImTriangulator [Internal]
-// - AddConcavePolyFilled()
-//-----------------------------------------------------------------------------
-
-enum ImTriangulatorNodeType
+// Walk faces delimited by polygon edges and diagonals, then triangulate each of them
+bool ImTriangulatorMonotone::TriangulateFaces()
 {
-    ImTriangulatorNodeType_Convex,
-    ImTriangulatorNodeType_Ear,
-    ImTriangulatorNodeType_Reflex
-};
+    const int n = _PointsCount;
+    const int half_edges_count = n + _DiagonalsCount * 2;
+    for (int i = 0; i < n; i++)
+    {
+        _HalfEdgeOrig[i] = i;
+        _HalfEdgeDest[i] = Next(i);
+    }
+    for (int d = 0; d < _DiagonalsCount; d++)
+    {
+        _HalfEdgeOrig[n + d * 2 + 0] = _HalfEdgeDest[n + d * 2 + 1] = _Diagonals[d * 2 + 0];
+        _HalfEdgeOrig[n + d * 2 + 1] = _HalfEdgeDest[n + d * 2 + 0] = _Diagonals[d * 2 + 1];
+    }
 
-struct ImTriangulatorNode
-{
-    ImTriangulatorNodeType  Type;
-    int                     Index;
-    ImVec2                  Pos;
-    ImTriangulatorNode*     Next;
-    ImTriangulatorNode*     Prev;
+    // Group outgoing half-edges by origin point
+    memset(_VertexHalfEdgesOffset, 0, sizeof(int) * (n + 1));
+    for (int h = 0; h < half_edges_count; h++)
+        _VertexHalfEdgesOffset[_HalfEdgeOrig[h] + 1]++;
+    for (int i = 0; i < n; i++)
+        _VertexHalfEdgesOffset[i + 1] += _VertexHalfEdgesOffset[i];
+    for (int h = 0; h < half_edges_count; h++)
+        _VertexHalfEdges[_VertexHalfEdgesOffset[_HalfEdgeOrig[h]]++] = h;
+    for (int i = n; i > 0; i--)
+        _VertexHalfEdgesOffset[i] = _VertexHalfEdgesOffset[i - 1];
+    _VertexHalfEdgesOffset[0] = 0;
+
+    // Link each half-edge to the next one around its face: at destination point, pick outgoing half-edge with smallest clockwise turn from the way back.
+    // Points only have a handful of diagonals, so a linear search is enough. Angles are compared with exact cross products as they may differ by less than float precision.
+    for (int h = 0; h < half_edges_count; h++)
+    {
+        const ImVec2& orig = _Points[_HalfEdgeOrig[h]];
+        const ImVec2& dest = _Points[_HalfEdgeDest[h]];
+        const double back_x = (double)orig.x - dest.x, back_y = (double)dest.y - orig.y; // y pointing up
+        int best = -1, best_half = 0;
+        double best_x = 0.0, best_y = 0.0;
+        for (int n2 = _VertexHalfEdgesOffset[_HalfEdgeDest[h]]; n2 < _VertexHalfEdgesOffset[_HalfEdgeDest[h] + 1]; n2++)
+        {
+            const int h2 = _VertexHalfEdges[n2];
+            const ImVec2& dest2 = _Points[_HalfEdgeDest[h2]];
+            const double dir_x = (double)dest2.x - dest.x, dir_y = (double)dest.y - dest2.y;
+            const double cross = back_x * dir_y - back_y * dir_x;
+            const int half = (cross < 0.0 || (cross == 0.0 && back_x * dir_x + back_y * dir_y < 0.0)) ? 0 : 1; // 0: turn in ]0,180], 1: turn in ]180,360]
+            if (best == -1 || half < best_half || (half == best_half && best_x * dir_y - best_y * dir_x > 0.0))
+            {
+                best = h2;
+                best_half = half;
+                best_x = dir_x;
+                best_y = dir_y;
+            }
+        }
+        _HalfEdgeNext[h] = best;
+    }
 
-    void    Unlink()        { Next->Prev = Prev; Prev->Next = Next; }
-};
+    // Extract faces (each half-edge belongs to exactly one face, as both sides of each diagonal are interior)
+    for (int h = 0; h < half_edges_count; h++)
+    {
+        if (_HalfEdgeOrig[h] == -1)
+            continue;
+        int face_count = 0;
+        for (int h2 = h; _HalfEdgeOrig[h2] != -1; h2 = _HalfEdgeNext[h2])
+        {
+            if (face_count == n)
+                return false;
+            _Face[face_count++] = _HalfEdgeOrig[h2];
+            _HalfEdgeOrig[h2] = -1;
+        }
+        if (!TriangulateMonotoneFace(_Face, face_count))
+            return false;
+    }
+    return true;
+}
 
-struct ImTriangulatorNodeSpan
+// Triangulate a y-monotone counter-clockwise face, O(N)
+bool ImTriangulatorMonotone::TriangulateMonotoneFace(const int* face, int face_count)
 {
-    ImTriangulatorNode**    Data = NULL;
-    int                     Size = 0;
+    if (face_count < 3 || _TrianglesCount + face_count - 2 > _PointsCount - 2)
+        return false;
 
-    void    push_back(ImTriangulatorNode* node) { Data[Size++] = node; }
-    void    find_erase_unsorted(int idx)        { for (int i = Size - 1; i >= 0; i--) if (Data[i]->Index == idx) { Data[i] = Data[Size - 1]; Size--; return; } }
-};
+    // Merge left chain (walking forward from top point) and right chain (walking backward from top point) into sweep order
+    int top = 0, bottom = 0;
+    for (int i = 1; i < face_count; i++)
+    {
+        if (_Rank[face[i]] < _Rank[face[top]])
+            top = i;
+        if (_Rank[face[i]] > _Rank[face[bottom]])
+            bottom = i;
+    }
+    int left = (top + 1 == face_count) ? 0 : top + 1;
+    int right = (top == 0) ? face_count - 1 : top - 1;
+    int left_last = face[top], right_last = face[top];
+    _FaceSorted[0] = face[top];
+    _FaceSide[0] = 0;
+    for (int i = 1; i < face_count; i++)
+    {
+        // Bottom point is the last point of left chain. Reject faces that are not y-monotone.
+        if (right == bottom || _Rank[face[left]] < _Rank[face[right]])
+        {
+            if (_Rank[face[left]] < _Rank[left_last])
+                return false;
+            _FaceSorted[i] = left_last = face[left];
+            _FaceSide[i] = 0;
+            left = (left + 1 == face_count) ? 0 : left + 1;
+        }
+        else
+        {
+            if (_Rank[face[right]] < _Rank[right_last])
+                return false;
+            _FaceSorted[i] = right_last = face[right];
+            _FaceSide[i] = 1;
+            right = (right == 0) ? face_count - 1 : right - 1;
+        }
+    }
+
+    // Stack based triangulation
+    unsigned int* out = _Triangles + _TrianglesCount * 3;
+    int stack_size = 0;
+    _Stack[stack_size++] = 0;
+    _Stack[stack_size++] = 1;
+    for (int j = 2; j < face_count - 1; j++)
+    {
+        const int u = _FaceSorted[j];
+        if (_FaceSide[j] != _FaceSide[_Stack[stack_size - 1]])
+        {
+            // Opposite chain: fan from 'u' to every stacked point
+            for (int s = 0; s < stack_size - 1; s++)
+            {
+                out[0] = u; out[1] = _FaceSorted[_Stack[s]]; out[2] = _FaceSorted[_Stack[s + 1]];
+                out += 3;
+            }
+            _Stack[0] = j - 1;
+            _Stack[1] = j;
+            stack_size = 2;
+        }
+        else
+        {
+            // Same chain: pop while triangles are inside the face
+            int last = _Stack[--stack_size];
+            while (stack_size > 0)
+            {
+                const int next = _Stack[stack_size - 1];
+                const double orient = Orient(_FaceSorted[next], _FaceSorted[last], u);
+                if (_FaceSide[j] == 0 ? (orient <= 0.0) : (orient >= 0.0))
+                    break;
+                out[0] = u; out[1] = _FaceSorted[last]; out[2] = _FaceSorted[next];
+                out += 3;
+                last = next;
+                stack_size--;
+            }
+            _Stack[stack_size++] = last;
+            _Stack[stack_size++] = j;
+        }
+    }
+    const int u = _FaceSorted[face_count - 1];
+    for (int s = 0; s < stack_size - 1; s++)
+    {
+        out[0] = u; out[1] = _FaceSorted[_Stack[s]]; out[2] = _FaceSorted[_Stack[s + 1]];
+        out += 3;
+    }
+    const int triangles_count = (int)(out - _Triangles) / 3 - _TrianglesCount;
+    if (triangles_count != face_count - 2)
+        return false;
+    _TrianglesCount += triangles_count;
+    return true;
+}
 
 struct ImTriangulator
 {
     static int EstimateTriangleCount(int points_count)      { return (points_count < 3) ? 0 : points_count - 2; }
-    static int EstimateScratchBufferSize(int points_count)  { return sizeof(ImTriangulatorNode) * points_count + sizeof(ImTriangulatorNode*) * points_count * 2; }
+    static int EstimateScratchBufferSize(int points_count)  { int sz = sizeof(ImTriangulatorNode) * points_count + sizeof(ImTriangulatorNode*) * points_count * 2; return (points_count >= IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS) ? ImMax(sz, ImTriangulatorMonotone::EstimateScratchBufferSize(points_count)) : sz; }
 
     void    Init(const ImVec2* points, int points_count, void* scratch_buffer);
     void    GetNextTriangle(unsigned int out_triangle[3]);     // Return relative indexes for next triangle
@@ -1799,6 +3180,7 @@ struct ImTriangulator
     ImTriangulatorNode*     _Nodes = NULL;
     ImTriangulatorNodeSpan  _Ears;
     ImTriangulatorNodeSpan  _Reflexes;
+    const unsigned int*     _MonotoneTriangles = NULL;  // Precomputed triangles, when using monotone decomposition
 };
 
 // Distribute storage for nodes, ears and reflexes.
@@ -1808,6 +3190,17 @@ void ImTriangulator::Init(const ImVec2* points, int points_count, void* scratch_
 {
     IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
     _TrianglesLeft = EstimateTriangleCount(points_count);
+    _MonotoneTriangles = NULL;
+    if (points_count >= IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS)
+    {
+        // On failure (degenerate geometry) scratch buffer is reused for ear clipping
+        ImTriangulatorMonotone monotone;
+        if (monotone.Build(points, points_count, scratch_buffer))
+        {
+            _MonotoneTriangles = monotone._Triangles;
+            return;
+        }
+    }
     _Nodes         = (ImTriangulatorNode*)scratch_buffer;                          // points_count x Node
     _Ears.Data     = (ImTriangulatorNode**)(_Nodes + points_count);                // points_count x Node*
     _Reflexes.Data = (ImTriangulatorNode**)(_Nodes + points_count) + points_count; // points_count x Node*
@@ -1858,6 +3251,16 @@ void ImTriangulator::BuildEars()
 
 void ImTriangulator::GetNextTriangle(unsigned int out_triangle[3])
 {
+    if (_MonotoneTriangles != NULL)
+    {
+        out_triangle[0] = _MonotoneTriangles[0];
+        out_triangle[1] = _MonotoneTriangles[1];
+        out_triangle[2] = _MonotoneTriangles[2];
+        _MonotoneTriangles += 3;
+        _TrianglesLeft--;
+        return;
+    }
+
     if (_Ears.Size == 0)
     {
         FlipNodeList();
@@ -1965,6 +3368,8 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
 {
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListCullPoints(this, points, points_count, _FringeScale * 10.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     ImTriangulator triangulator;
@@ -1991,30 +3396,17 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        // Compute normals, then averaged normals
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImVec2* temp_miters = temp_normals + points_count;
+        ImPolylineCalcNormals(points, points_count, points_count, temp_normals);
+        ImPolylineCalcMiters(temp_normals, points_count, true, temp_miters);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+            float dm_x = temp_miters[i1].x * (AA_SIZE * 0.5f);
+            float dm_y = temp_miters[i1].y * (AA_SIZE * 0.5f);
 
             // Add vertices
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
@@ -2065,6 +3457,7 @@ void ImDrawListSplitter::ClearFreeMemory()
             memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
         _Channels[i]._CmdBuffer.clear();
         _Channels[i]._IdxBuffer.clear();
+        _Channels[i]._QuadBuffer.clear();
     }
     _Current = 0;
     _Count = 1;
@@ -2083,7 +3476,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     }
     _Count = channels_count;
 
-    // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
+    // Channels[] (36/48 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
     // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
     // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
     memset(&_Channels[0], 0, sizeof(ImDrawChannel));
@@ -2097,6 +3490,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
         {
             _Channels[i]._CmdBuffer.resize(0);
             _Channels[i]._IdxBuffer.resize(0);
+            _Channels[i]._QuadBuffer.resize(0);
         }
     }
 }
@@ -2109,52 +3503,96 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
+    int idx_offset = draw_list->IdxBuffer.Size;
+    int quad_offset = draw_list->QuadBuffer.Size;
+
+    // When channel 0 has no indices (or quads), adopt the storage of the first channel which has some instead of copying it.
+    // Our empty buffer goes to that channel, so capacities keep being reused on the next frame. Layout of the merged data is unchanged.
+    // Not done with ImDrawUploadArena storage, as indices are better copied into it than moved out of it.
+    if (idx_offset == 0 && (draw_list->_IdxArenaData == NULL || draw_list->IdxBuffer.Data != draw_list->_IdxArenaData))
+        for (int i = 1; i < _Count; i++)
+            if (_Channels[i]._IdxBuffer.Size > 0)
+            {
+                draw_list->IdxBuffer.swap(_Channels[i]._IdxBuffer);
+                break;
+            }
+    if (quad_offset == 0)
+        for (int i = 1; i < _Count; i++)
+            if (_Channels[i]._QuadBuffer.Size > 0)
+            {
+                draw_list->QuadBuffer.swap(_Channels[i]._QuadBuffer);
+                break;
+            }
 
     // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // (commands with QuadInstances != 0 use IdxOffset to index QuadBuffer[], which is concatenated the same way as IdxBuffer[])
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
+    int new_quad_buffer_count = 0;
     ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
         if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
             ch._CmdBuffer.pop_back();
 
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
+        ImDrawCmd* ch_cmd = ch._CmdBuffer.Data;
+        int ch_cmd_count = ch._CmdBuffer.Size;
+        if (ch_cmd_count > 0 && last_cmd != NULL)
         {
             // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
             // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
+            ImDrawCmd* next_cmd = ch_cmd;
             if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
             {
                 // Merge previous channel last draw command with current channel first draw command if matching.
                 last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
+                (next_cmd->QuadInstances ? quad_offset : idx_offset) += next_cmd->ElemCount;
+                next_cmd->ElemCount = 0;
             }
         }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
-        new_cmd_buffer_count += ch._CmdBuffer.Size;
+        if (ch_cmd_count > 0 && ch_cmd->ElemCount == 0 && ch_cmd->UserCallback == NULL) // Skip merged (or unused) first command instead of erasing it. Same test when copying below.
+        {
+            ch_cmd++;
+            ch_cmd_count--;
+        }
+        if (ch_cmd_count > 0)
+            last_cmd = &ch_cmd[ch_cmd_count - 1];
+        new_cmd_buffer_count += ch_cmd_count;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
+        new_quad_buffer_count += ch._QuadBuffer.Size;
+        for (int cmd_n = 0; cmd_n < ch_cmd_count; cmd_n++)
         {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
+            ImDrawCmd* cmd = &ch_cmd[cmd_n];
+            int& offset = cmd->QuadInstances ? quad_offset : idx_offset;
+            cmd->IdxOffset = offset;
+            offset += cmd->ElemCount;
         }
     }
     draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
-    draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+    const int new_idx_buffer_size = draw_list->IdxBuffer.Size + new_idx_buffer_count;
+    if (new_idx_buffer_size > draw_list->IdxBuffer.Capacity)
+        ImDrawListArenaReserve(draw_list->_Data->UploadArena, draw_list->IdxBuffer, draw_list->_IdxArenaData, draw_list->IdxBuffer._grow_capacity(new_idx_buffer_size));
+    draw_list->IdxBuffer.Size = new_idx_buffer_size;
+    draw_list->QuadBuffer.resize(draw_list->QuadBuffer.Size + new_quad_buffer_count);
 
     // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
     ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawQuad* quad_write = draw_list->QuadBuffer.Data + draw_list->QuadBuffer.Size - new_quad_buffer_count;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        const ImDrawCmd* ch_cmd = ch._CmdBuffer.Data;
+        int ch_cmd_count = ch._CmdBuffer.Size;
+        if (ch_cmd_count > 0 && ch_cmd->ElemCount == 0 && ch_cmd->UserCallback == NULL)
+        {
+            ch_cmd++;
+            ch_cmd_count--;
+        }
+        if (int sz = ch_cmd_count) { memcpy(cmd_write, ch_cmd, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        if (int sz = ch._QuadBuffer.Size) { memcpy(quad_write, ch._QuadBuffer.Data, sz * sizeof(ImDrawQuad)); quad_write += sz; }
     }
     draw_list->_IdxWritePtr = idx_write;
 
@@ -2165,7 +3603,10 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd->ElemCount == 0)
-        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
+    {
+        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset, QuadInstances
+        curr_cmd->IdxOffset = curr_cmd->QuadInstances ? draw_list->QuadBuffer.Size : draw_list->IdxBuffer.Size;
+    }
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
 
@@ -2178,12 +3619,14 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     if (_Current == idx)
         return;
 
-    // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
+    // Overwrite ImVector (12/16 bytes), six times. This is merely a silly optimization instead of doing .swap()
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&_Channels.Data[_Current]._QuadBuffer, &draw_list->QuadBuffer, sizeof(draw_list->QuadBuffer));
     _Current = idx;
     memcpy(&draw_list->CmdBuffer, &_Channels.Data[idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&draw_list->QuadBuffer, &_Channels.Data[idx]._QuadBuffer, sizeof(draw_list->QuadBuffer));
     draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
 
     // If current command is used with different settings we need to add a new command
@@ -2191,7 +3634,10 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     if (curr_cmd == NULL)
         draw_list->AddDrawCmd();
     else if (curr_cmd->ElemCount == 0)
-        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
+    {
+        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset, QuadInstances
+        curr_cmd->IdxOffset = curr_cmd->QuadInstances ? draw_list->QuadBuffer.Size : draw_list->IdxBuffer.Size;
+    }
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
 }
@@ -2203,7 +3649,7 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 void ImDrawData::Clear()
 {
     Valid = false;
-    CmdListsCount = TotalIdxCount = TotalVtxCount = 0;
+    CmdListsCount = TotalIdxCount = TotalVtxCount = TotalQuadCount = 0;
     CmdLists.resize(0); // The ImDrawList are NOT owned by ImDrawData but e.g. by ImGuiContext, so we don't clear them.
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
@@ -2254,6 +3700,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     draw_data->CmdListsCount++;
     draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
     draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+    draw_data->TotalQuadCount += draw_list->QuadBuffer.Size;
 }
 
 void ImDrawData::AddDrawList(ImDrawList* draw_list)
@@ -2267,17 +3714,76 @@ void ImDrawData::AddDrawList(ImDrawList* draw_list)
 void ImDrawData::DeIndexAllBuffers()
 {
     ImVector<ImDrawVert> new_vtx_buffer;
-    TotalVtxCount = TotalIdxCount = 0;
+    TotalVtxCount = TotalIdxCount = TotalQuadCount = 0;
     for (int i = 0; i < CmdListsCount; i++)
     {
         ImDrawList* cmd_list = CmdLists[i];
-        if (cmd_list->IdxBuffer.empty())
+        if (cmd_list->IdxBuffer.empty() && cmd_list->QuadBuffer.empty())
             continue;
-        new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
-        for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
+
+        // Rewrite commands in order, so their IdxOffset becomes an offset into the new vertex buffer.
+        // ImDrawQuadKind_Textured instances are expanded into 6 vertices (2 triangles), the same as PrimRectUV() would output.
+        int new_vtx_count = 0;
+        for (const ImDrawCmd& cmd : cmd_list->CmdBuffer)
+            if (cmd.UserCallback == NULL)
+                new_vtx_count += (cmd.QuadInstances == ImDrawQuadKind_Textured) ? (int)cmd.ElemCount * 6 : (cmd.QuadInstances == ImDrawQuadKind_None) ? (int)cmd.ElemCount : 0;
+        new_vtx_buffer.resize(new_vtx_count);
+        ImDrawVert* dst = new_vtx_buffer.Data;
+        for (ImDrawCmd& cmd : cmd_list->CmdBuffer)
+        {
+            const unsigned int idx_offset = cmd.IdxOffset;
+            cmd.IdxOffset = (unsigned int)(dst - new_vtx_buffer.Data);
+            if (cmd.UserCallback != NULL)
+                continue;
+            if (cmd.QuadInstances == ImDrawQuadKind_None)
+            {
+                const ImDrawVert* src = cmd_list->VtxBuffer.Data + cmd.VtxOffset;
+                const ImDrawIdx* idx = cmd_list->IdxBuffer.Data + idx_offset;
+                const ImDrawIdx* idx_end = idx + cmd.ElemCount;
+                for (; idx + 4 <= idx_end; idx += 4, dst += 4) // Unrolled gather
+                {
+                    dst[0] = src[idx[0]];
+                    dst[1] = src[idx[1]];
+                    dst[2] = src[idx[2]];
+                    dst[3] = src[idx[3]];
+                }
+                for (; idx < idx_end; idx++, dst++)
+                    *dst = src[*idx];
+            }
+            else if (cmd.QuadInstances == ImDrawQuadKind_Textured)
+            {
+                const ImDrawQuad* quad = cmd_list->QuadBuffer.Data + idx_offset;
+                const ImDrawQuad* quad_end = quad + cmd.ElemCount;
+                for (; quad < quad_end; quad++, dst += 6)
+                {
+                    const ImVec2 a = quad->Pos;
+                    const ImVec2 c(a.x + quad->Size[0] * (1.0f / 16.0f), a.y + quad->Size[1] * (1.0f / 16.0f));
+                    const ImVec2 uv_a(quad->UV[0] * (1.0f / 65535.0f), quad->UV[1] * (1.0f / 65535.0f));
+                    const ImVec2 uv_c(quad->UV[2] * (1.0f / 65535.0f), quad->UV[3] * (1.0f / 65535.0f));
+                    const ImU32 col = quad->Col;
+                    dst[0].pos = a;                dst[0].uv = uv_a;                   dst[0].col = col;
+                    dst[1].pos = ImVec2(c.x, a.y); dst[1].uv = ImVec2(uv_c.x, uv_a.y); dst[1].col = col;
+                    dst[2].pos = c;                dst[2].uv = uv_c;                   dst[2].col = col;
+                    dst[3] = dst[0];
+                    dst[4] = dst[2];
+                    dst[5].pos = ImVec2(a.x, c.y); dst[5].uv = ImVec2(uv_a.x, uv_c.y); dst[5].col = col;
+                }
+                cmd.ElemCount *= 6;
+            }
+            else
+            {
+                // Analytic shapes are evaluated per-pixel by the renderer and have no vertex equivalent.
+                IM_ASSERT(0 && "DeIndexAllBuffers() cannot convert ImDrawQuadKind_Shape instances: don't set ImGuiBackendFlags_RendererHasShapeInstances when rendering non-indexed.");
+                cmd.ElemCount = 0;
+            }
+            cmd.VtxOffset = 0;
+            cmd.QuadInstances = ImDrawQuadKind_None;
+        }
+        IM_ASSERT(dst == new_vtx_buffer.Data + new_vtx_buffer.Size);
         cmd_list->VtxBuffer.swap(new_vtx_buffer);
+        ImDrawListArenaDetach(new_vtx_buffer, cmd_list->_VtxArenaData); // Previous storage may belong to ImDrawUploadArena
         cmd_list->IdxBuffer.resize(0);
+        cmd_list->QuadBuffer.resize(0);
         TotalVtxCount += cmd_list->VtxBuffer.Size;
     }
 }
@@ -2309,7 +3815,33 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_r = ((int)(col1 >> IM_COL32_R_SHIFT) & 0xFF) - col0_r;
     const int col_delta_g = ((int)(col1 >> IM_COL32_G_SHIFT) & 0xFF) - col0_g;
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
-    for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
+    ImDrawVert* vert = vert_start;
+#ifdef IMGUI_ENABLE_SIMD_DRAW
+    // 4 vertices per iteration: positions are transposed in registers, colors are packed back one vertex at a time
+    if (vert_end - vert_start >= 4)
+    {
+        const ImSimdF4 p0_x = ImSimdSet1(gradient_p0.x), p0_y = ImSimdSet1(gradient_p0.y);
+        const ImSimdF4 extent_x = ImSimdSet1(gradient_extent.x), extent_y = ImSimdSet1(gradient_extent.y);
+        const ImSimdF4 inv_length2 = ImSimdSet1(gradient_inv_length2);
+        const ImSimdF4 zero = ImSimdSet1(0.0f), one = ImSimdSet1(1.0f);
+        const ImSimdF4 c0_r = ImSimdSet1((float)col0_r), c0_g = ImSimdSet1((float)col0_g), c0_b = ImSimdSet1((float)col0_b);
+        const ImSimdF4 delta_r = ImSimdSet1((float)col_delta_r), delta_g = ImSimdSet1((float)col_delta_g), delta_b = ImSimdSet1((float)col_delta_b);
+        for (; vert + 4 <= vert_end; vert += 4)
+        {
+            ImSimdF4 x, y;
+            ImSimdDeinterleave(ImSimdLoadPairs(&vert[0].pos.x, &vert[1].pos.x), ImSimdLoadPairs(&vert[2].pos.x, &vert[3].pos.x), &x, &y);
+            ImSimdF4 d = ImSimdAdd(ImSimdMul(ImSimdSub(x, p0_x), extent_x), ImSimdMul(ImSimdSub(y, p0_y), extent_y));
+            ImSimdF4 t = ImSimdClamp(ImSimdMul(d, inv_length2), zero, one);
+            float r[4], g[4], b[4];
+            ImSimdStore(r, ImSimdAdd(c0_r, ImSimdMul(delta_r, t)));
+            ImSimdStore(g, ImSimdAdd(c0_g, ImSimdMul(delta_g, t)));
+            ImSimdStore(b, ImSimdAdd(c0_b, ImSimdMul(delta_b, t)));
+            for (int n = 0; n < 4; n++)
+                vert[n].col = ((int)r[n] << IM_COL32_R_SHIFT) | ((int)g[n] << IM_COL32_G_SHIFT) | ((int)b[n] << IM_COL32_B_SHIFT) | (vert[n].col & IM_COL32_A_MASK);
+        }
+    }
+#endif
+    for (; vert < vert_end; vert++)
     {
         float d = ImDot(vert->pos - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
@@ -2331,16 +3863,34 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
 
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
+    const ImVec2 min = ImMin(uv_a, uv_b);
+    const ImVec2 max = ImMax(uv_a, uv_b);
+    ImDrawVert* vertex = vert_start;
+#ifdef IMGUI_ENABLE_SIMD_DRAW
+    // 4 vertices per iteration, operating directly on (x,y) pairs gathered from the strided ImDrawVert layout
+    if (vert_end - vert_start >= 4)
+    {
+        const float a4[4] = { a.x, a.y, a.x, a.y }, scale4[4] = { scale.x, scale.y, scale.x, scale.y }, uv_a4[4] = { uv_a.x, uv_a.y, uv_a.x, uv_a.y };
+        const float min4[4] = { min.x, min.y, min.x, min.y }, max4[4] = { max.x, max.y, max.x, max.y };
+        const ImSimdF4 a_v = ImSimdLoad(a4), scale_v = ImSimdLoad(scale4), uv_a_v = ImSimdLoad(uv_a4), min_v = ImSimdLoad(min4), max_v = ImSimdLoad(max4);
+        for (; vertex + 4 <= vert_end; vertex += 4)
+            for (int n = 0; n < 4; n += 2)
+            {
+                ImSimdF4 uv = ImSimdAdd(uv_a_v, ImSimdMul(ImSimdSub(ImSimdLoadPairs(&vertex[n].pos.x, &vertex[n + 1].pos.x), a_v), scale_v));
+                if (clamp)
+                    uv = ImSimdClamp(uv, min_v, max_v);
+                ImSimdStorePairs(&vertex[n].uv.x, &vertex[n + 1].uv.x, uv);
+            }
+    }
+#endif
     if (clamp)
     {
-        const ImVec2 min = ImMin(uv_a, uv_b);
-        const ImVec2 max = ImMax(uv_a, uv_b);
-        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        for (; vertex < vert_end; ++vertex)
             vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
     }
     else
     {
-        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        for (; vertex < vert_end; ++vertex)
             vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
     }
 }
@@ -2349,7 +3899,30 @@ void ImGui::ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, in
 {
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
-    for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+    ImDrawVert* vertex = vert_start;
+#ifdef IMGUI_ENABLE_SIMD_DRAW
+    // 4 vertices per iteration: positions are transposed in registers (x and y lanes), rotated, then transposed back
+    if (vert_end - vert_start >= 4)
+    {
+        const ImSimdF4 pivot_in_x = ImSimdSet1(pivot_in.x), pivot_in_y = ImSimdSet1(pivot_in.y);
+        const ImSimdF4 pivot_out_x = ImSimdSet1(pivot_out.x), pivot_out_y = ImSimdSet1(pivot_out.y);
+        const ImSimdF4 cos_v = ImSimdSet1(cos_a), sin_v = ImSimdSet1(sin_a);
+        for (; vertex + 4 <= vert_end; vertex += 4)
+        {
+            ImSimdF4 x, y;
+            ImSimdDeinterleave(ImSimdLoadPairs(&vertex[0].pos.x, &vertex[1].pos.x), ImSimdLoadPairs(&vertex[2].pos.x, &vertex[3].pos.x), &x, &y);
+            x = ImSimdSub(x, pivot_in_x);
+            y = ImSimdSub(y, pivot_in_y);
+            ImSimdF4 rx = ImSimdAdd(ImSimdSub(ImSimdMul(x, cos_v), ImSimdMul(y, sin_v)), pivot_out_x);
+            ImSimdF4 ry = ImSimdAdd(ImSimdAdd(ImSimdMul(x, sin_v), ImSimdMul(y, cos_v)), pivot_out_y);
+            ImSimdF4 p01, p23;
+            ImSimdInterleave(rx, ry, &p01, &p23);
+            ImSimdStorePairs(&vertex[0].pos.x, &vertex[1].pos.x, p01);
+            ImSimdStorePairs(&vertex[2].pos.x, &vertex[3].pos.x, p23);
+        }
+    }
+#endif
+    for (; vertex < vert_end; ++vertex)
         vertex->pos = ImRotate(vertex->pos- pivot_in, cos_a, sin_a) + pivot_out;
 }
 
@@ -3297,6 +4870,7 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
             font->BuildLookupTable();
 
     atlas->TexReady = true;
+    atlas->BuildGeneration++;
 }
 
 // Retrieve list of range (2 int per range, values are inclusive)
@@ -4109,10 +5683,16 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         return;
 
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
-    const int vtx_count_max = (int)(text_end - s) * 4;
-    const int idx_count_max = (int)(text_end - s) * 6;
+    // In quad instances mode, reserve one ImDrawQuad per character instead (glyph sizes are stored in 1/16th of pixels, see ImDrawQuad)
+    const bool use_quads = (draw_list->Flags & ImDrawListFlags_QuadInstances) && line_height < 2048.0f;
+    const int vtx_count_max = use_quads ? 0 : (int)(text_end - s) * 4;
+    const int idx_count_max = use_quads ? 0 : (int)(text_end - s) * 6;
     const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
-    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    const int quad_count_max = use_quads ? (int)(text_end - s) : 0;
+    ImDrawQuad* quad_write = use_quads ? draw_list->_PrimReserveQuads(quad_count_max) : NULL;
+    ImDrawQuad* quad_write_begin = quad_write;
+    if (!use_quads)
+        draw_list->PrimReserve(idx_count_max, vtx_count_max);
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
@@ -4215,6 +5795,11 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
+                if (use_quads)
+                {
+                    ImDrawQuadWrite(quad_write++, x1, y1, x2, y2, u1, v1, u2, v2, glyph_col);
+                }
+                else
                 {
                     vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
                     vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
@@ -4231,6 +5816,15 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         x += char_width;
     }
 
+    // Give back unused quad instances (clipped ones, blanks)
+    if (use_quads)
+    {
+        const int quad_count = (int)(quad_write - quad_write_begin);
+        draw_list->QuadBuffer.Size -= quad_count_max - quad_count;
+        draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= quad_count_max - quad_count;
+        return;
+    }
+
     // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
     draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
     draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
@@ -4240,6 +5834,97 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->_VtxCurrentIdx = vtx_index;
 }
 
+// Decode, measure and lay out text once into glyph quads relative to (0,0), for use with ImDrawList::AddShapedText().
+// Layout matches RenderText() with an unbounded clipping rectangle.
+void ImFont::ShapeText(ImFontShapedText* out_shaped_text, float size, const char* text_begin, const char* text_end, float wrap_width)
+{
+    if (!text_end)
+        text_end = text_begin + strlen(text_begin);
+
+    ImFontShapedText* out = out_shaped_text;
+    out->Clear();
+    out->Font = this;
+    out->FontSize = size;
+    out->AtlasBuildGeneration = ContainerAtlas->BuildGeneration;
+    out->Size = CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end, NULL);
+    out->Glyphs.reserve((int)(text_end - text_begin));
+
+    const float scale = size / FontSize;
+    const float line_height = FontSize * scale;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+    ImVec2 bounds_min(FLT_MAX, FLT_MAX), bounds_max(-FLT_MAX, -FLT_MAX);
+    float x = 0.0f;
+    float y = 0.0f;
+
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+                word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - x);
+
+            if (s >= word_wrap_eol)
+            {
+                x = 0.0f;
+                y += line_height;
+                word_wrap_eol = NULL;
+                s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                continue;
+            }
+        }
+
+        // Decode and advance source
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                x = 0.0f;
+                y += line_height;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
+        if (glyph == NULL)
+            continue;
+
+        if (glyph->Visible)
+        {
+            out->Glyphs.resize(out->Glyphs.Size + 1);
+            ImFontShapedGlyph& shaped_glyph = out->Glyphs.back();
+            shaped_glyph.P0 = ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale);
+            shaped_glyph.P1 = ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale);
+            shaped_glyph.UV0 = ImVec2(glyph->U0, glyph->V0);
+            shaped_glyph.UV1 = ImVec2(glyph->U1, glyph->V1);
+            shaped_glyph.ColMask = glyph->Colored ? ~IM_COL32_A_MASK : 0;
+            bounds_min = ImMin(bounds_min, shaped_glyph.P0);
+            bounds_max = ImMax(bounds_max, shaped_glyph.P1);
+        }
+        x += glyph->AdvanceX * scale;
+    }
+
+    if (out->Glyphs.Size > 0)
+    {
+        out->BoundsMin = bounds_min;
+        out->BoundsMax = bounds_max;
+    }
+}
+
+bool ImFontShapedText::IsValid() const
+{
+    return Font != NULL && Font->ContainerAtlas != NULL && Font->ContainerAtlas->BuildGeneration == AtlasBuildGeneration;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGui Internal Render Helpers
 //-----------------------------------------------------------------------------
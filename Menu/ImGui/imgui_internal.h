@@ -63,6 +63,12 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Enable NEON intrinsics if available (AArch64 only: we rely on vector division and square root)
+#if (defined __aarch64__ || defined _M_ARM64) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -336,6 +342,7 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // - Helper: ImSpan<>, ImSpanAllocator<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
+// - Helper: ImVector<> capacity
 // - Helper: ImGuiTextIndex
 // - Helper: ImGuiStorage
 //-----------------------------------------------------------------------------
@@ -343,6 +350,7 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImGuiID seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+IMGUI_API ImGuiID       ImHashLabel(const ImGuiLabel& label, ImGuiID seed = 0);     // == ImHashStr(label.Text, 0, seed)
 
 // Helpers: Sorting
 #ifndef ImQsort
@@ -714,6 +722,48 @@ struct ImChunkStream
     void    swap(ImChunkStream<T>& rhs) { rhs.Buf.swap(Buf); }
 };
 
+// Helper: ImVector<> capacity
+// - ImVectorTrimCapacity() shrinks storage down to Size when Capacity is more than twice larger (e.g. after a one-off peak), keeping contents. Return number of bytes released.
+//   Regular growth never leaves more than 50% slack, so a vector which is trimmed then grows back won't be trimmed again until its usage drops again.
+template<typename T> static inline size_t ImVectorGetCapacityInBytes(const ImVector<T>& v) { return (size_t)v.Capacity * sizeof(T); }
+template<typename T>
+static inline size_t ImVectorTrimCapacity(ImVector<T>& v)
+{
+    if (v.Capacity * sizeof(T) <= 64 || v.Capacity <= v.Size * 2)
+        return 0;
+    const size_t released = (size_t)(v.Capacity - v.Size) * sizeof(T);
+    T* new_data = NULL;
+    if (v.Size > 0)
+    {
+        new_data = (T*)IM_ALLOC((size_t)v.Size * sizeof(T));
+        memcpy(new_data, v.Data, (size_t)v.Size * sizeof(T));
+    }
+    IM_FREE(v.Data);
+    v.Data = new_data;
+    v.Capacity = v.Size;
+    return released;
+}
+
+// Helper: ImSmallVector<> capacity: only heap storage is accounted for, inline storage is part of the owner structure.
+// - ImVectorTrimCapacity() moves contents back to inline storage when they fit.
+template<typename T, int N> static inline size_t ImVectorGetCapacityInBytes(const ImSmallVector<T, N>& v) { return v.is_inline() ? 0 : (size_t)v.Capacity * sizeof(T); }
+template<typename T, int N>
+static inline size_t ImVectorTrimCapacity(ImSmallVector<T, N>& v)
+{
+    if (v.is_inline() || v.Capacity <= v.Size * 2)
+        return 0;
+    const size_t heap_size = (size_t)v.Capacity * sizeof(T);
+    T* new_data = v.LocalBuf;
+    if (v.Size > N)
+        new_data = (T*)IM_ALLOC((size_t)v.Size * sizeof(T));
+    if (v.Size > 0)
+        memcpy(new_data, v.Data, (size_t)v.Size * sizeof(T));
+    IM_FREE(v.Data);
+    v.Data = new_data;
+    v.Capacity = (v.Size > N) ? v.Size : N;
+    return heap_size - ((v.Size > N) ? (size_t)v.Size * sizeof(T) : 0);
+}
+
 // Helper: ImGuiTextIndex
 // Maintain a line index for a text buffer. This is a strong candidate to be moved into the public API.
 struct ImGuiTextIndex
@@ -759,6 +809,11 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Polygons with at least this many points are triangulated by AddConcavePolyFilled() using monotone decomposition, O(N log N), instead of ear clipping, O(N^2).
+#ifndef IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS
+#define IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS                 64
+#endif
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -771,6 +826,7 @@ struct IMGUI_API ImDrawListSharedData
     float           CircleSegmentMaxError;      // Number of circle segments to use per pixel of radius for AddCircle() etc
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
+    ImDrawUploadArena* UploadArena;             // Backend provided storage for VtxBuffer[]/IdxBuffer[] (ImGuiBackendFlags_RendererHasUploadArena), NULL when not available
 
     // [Internal] Temp write buffer
     ImVector<ImVec2> TempBuffer;
@@ -785,6 +841,64 @@ struct IMGUI_API ImDrawListSharedData
     void SetCircleTessellationMaxError(float max_error);
 };
 
+// Text measurement cache entry
+struct ImGuiTextMeasureCacheEntry
+{
+    ImGuiID         Key;                        // Hash of text contents + font + size + wrap width
+    int             TextOffset;                 // Copy of source text in ImGuiTextMeasureCache::TextBuf[], compared on lookup
+    int             TextLen;
+    int             LastFrameUsed;
+    ImVec2          Size;                       // Unrounded size as returned by ImFont::CalcTextSizeA()
+};
+
+// Per-context, size-bounded cache of ImFont::CalcTextSizeA() results, used by CalcTextSize().
+// - Entries are only admitted for text which has been seen on a previous frame, so strings changing every frame don't thrash the cache.
+// - Source text is copied and compared on lookup, so a hash collision can't return the size of another text. Text longer than TextLenMax isn't cached.
+// - Cleared when the font atlas is rebuilt (ImFontAtlas::BuildGeneration changes).
+// - Only sizes are cached, wrapped or not. Rendering wrapped text still finds line breaks with ImFont::CalcWordWrapPositionA() every frame.
+struct ImGuiTextMeasureCache
+{
+    ImVector<ImGuiTextMeasureCacheEntry> Entries;
+    ImGuiStorage    Map;                        // Key -> Index+1 into Entries[]
+    ImGuiStorage    SeenKeys;                   // Key -> First frame seen (admission filter)
+    ImVector<char>  TextBuf;                    // Source text of all entries
+    ImVector<char>  TextBufTemp;                // Compacted TextBuf[] built by the eviction pass, then swapped (kept to reuse its capacity)
+    int             Capacity;                   // Max number of entries. 0 to disable the cache.
+    int             TextLenMax;                 // Max length of cached text. Default to 1024.
+    int             AtlasBuildGeneration;       // ImFontAtlas::BuildGeneration at the time entries were stored
+
+    // Statistics (for Metrics window). Current frame accumulate into [0], previous frame is in [1].
+    int             StatHits[2];
+    int             StatMisses[2];
+    int             StatBytesSaved[2];          // Amount of text which didn't need to be measured again thanks to a hit
+    int             StatEvictions;
+
+    ImGuiTextMeasureCache()                     { Capacity = 1024; TextLenMax = 1024; AtlasBuildGeneration = -1; ClearStats(); }
+    void            ClearStats()                { memset(StatHits, 0, sizeof(StatHits)); memset(StatMisses, 0, sizeof(StatMisses)); memset(StatBytesSaved, 0, sizeof(StatBytesSaved)); StatEvictions = 0; }
+    void            Clear()                     { Entries.resize(0); Map.Clear(); SeenKeys.Clear(); TextBuf.resize(0); }
+    void            ClearFreeMemory()           { Entries.clear(); Map.Clear(); SeenKeys.Clear(); TextBuf.clear(); TextBufTemp.clear(); }
+};
+
+// Per-context cache of pre-shaped labels, used when rendering items submitted with ImGuiItemFlags_RetainedText.
+struct ImGuiShapedTextCacheEntry
+{
+    ImFontShapedText Shaped;
+    ImVector<char>  Text;                       // Copy of source text, compared on lookup so a hash collision can't return another label's glyphs
+    int             LastFrameUsed;
+};
+
+struct ImGuiShapedTextCache
+{
+    ImPool<ImGuiShapedTextCacheEntry> Pool;     // Key (hash of text contents + font + size) -> Entry
+    int             Capacity;                   // Max number of alive entries. 0 to disable the cache.
+    int             AtlasBuildGeneration;       // ImFontAtlas::BuildGeneration at the time entries were shaped
+    int             StatHits[2];                // Current frame accumulate into [0], previous frame is in [1].
+    int             StatMisses[2];
+    int             StatGlyphs[2];              // Glyphs emitted from shaped data
+
+    ImGuiShapedTextCache()                      { Capacity = 512; AtlasBuildGeneration = -1; memset(StatHits, 0, sizeof(StatHits)); memset(StatMisses, 0, sizeof(StatMisses)); memset(StatGlyphs, 0, sizeof(StatGlyphs)); }
+};
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>*  Layers[2];      // Pointers to global layers for: regular, tooltip. LayersP[0] is owned by DrawData.
@@ -1523,10 +1637,13 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    int                             MeasureItemIdx;     // Variable heights: item displayed by last step, to be measured by next step (-1 if none)
+    float                           MeasureItemPosY;    // Variable heights: cursor position before that item
+    int                             CursorItemIdx;      // Variable heights: item the cursor is at (after items displayed by last step, or last seek), to count rows skipped by a seek
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = CursorItemIdx = 0; MeasureItemIdx = -1; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -2041,6 +2158,10 @@ struct ImGuiContext
     bool                    WithinFrameScopeWithImplicitWindow; // Set by NewFrame(), cleared by EndFrame() when the implicit debug window has been pushed
     bool                    WithinEndChild;                     // Set within EndChild()
     bool                    GcCompactAll;                       // Request full GC
+    int                     GcTrimLevel;                        // Trimming step needed by the last GcTrimToMemoryBudget() check, 0 when within io.ConfigMemoryBudget
+    int                     GcTrimCount;                        // Number of checks where usage exceeded io.ConfigMemoryBudget
+    double                  GcMemoryCheckTime;                  // Time of the last GcTrimToMemoryBudget() check
+    ImGuiMemoryUsage        GcMemoryUsage;                      // Usage measured by GcTrimToMemoryBudget() (after trimming). Only updated when io.ConfigMemoryBudget != 0
     bool                    TestEngineHookItems;                // Will call test engine hooks: ImGuiTestEngineHook_ItemAdd(), ImGuiTestEngineHook_ItemInfo(), ImGuiTestEngineHook_Log()
     void*                   TestEngine;                         // Test engine user data
     char                    ContextName[16];                    // Storage for a context name (to facilitate debugging multi-context setups)
@@ -2262,6 +2383,9 @@ struct ImGuiContext
     ImVector<ImGuiMultiSelectTempData> MultiSelectTempData;
     ImPool<ImGuiMultiSelectState>   MultiSelectStorage;
 
+    // Tree views
+    ImGuiTreeView*                  CurrentTreeView;
+
     // Hover Delay system
     ImGuiID                 HoverItemDelayId;
     ImGuiID                 HoverItemDelayIdPreviousFrame;
@@ -2379,6 +2503,8 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture override via SetNextFrameWantCaptureMouse()/SetNextFrameWantCaptureKeyboard(). Default to -1.
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
+    ImGuiTextMeasureCache   TextMeasureCache;                   // Cache for CalcTextSize()
+    ImGuiShapedTextCache    ShapedTextCache;                    // Cache for labels rendered with ImGuiItemFlags_RetainedText
     ImVector<char>          TempBuffer;                         // Temporary text buffer
     char                    TempKeychordName[64];
 
@@ -2506,7 +2632,7 @@ struct IMGUI_API ImGuiWindow
     ImVec2                  SetWindowPosVal;                    // store window position when using a non-zero Pivot (position set needs to be processed when we know the window size)
     ImVec2                  SetWindowPosPivot;                  // store window pivot for positioning. ImVec2(0, 0) when positioning from top-left corner; ImVec2(0.5f, 0.5f) for centering; ImVec2(1, 1) for bottom right.
 
-    ImVector<ImGuiID>       IDStack;                            // ID stack. ID are hashes seeded with the value at the top of the stack. (In theory this should be in the TempData structure)
+    ImSmallVector<ImGuiID, 16> IDStack;                         // ID stack. ID are hashes seeded with the value at the top of the stack. (In theory this should be in the TempData structure)
     ImGuiWindowTempData     DC;                                 // Temporary per-window data, reset at the beginning of the frame. This used to be called ImGuiDrawContext, hence the "DC" variable name.
 
     // The best way to understand what those rectangles are is to use the 'Metrics->Tools->Show Windows Rectangles' viewer.
@@ -2556,6 +2682,7 @@ public:
     ImGuiID     GetID(const char* str, const char* str_end = NULL);
     ImGuiID     GetID(const void* ptr);
     ImGuiID     GetID(int n);
+    ImGuiID     GetID(const ImGuiLabel& label);
     ImGuiID     GetIDFromPos(const ImVec2& p_abs);
     ImGuiID     GetIDFromRectangle(const ImRect& r_abs);
 
@@ -2652,6 +2779,7 @@ struct IMGUI_API ImGuiTabBar
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
 #define IMGUI_TABLE_MAX_COLUMNS         512                 // May be further lifted
+#define IMGUI_TABLE_MAX_VIRTUALIZED_COLUMNS 32767           // With ImGuiTableFlags_VirtualizeColumns. Limited by ImGuiTableColumnIdx.
 
 // Our current column maximum is 64 but we may raise that in the future.
 typedef ImS16 ImGuiTableColumnIdx;
@@ -2820,6 +2948,9 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnSortSpecs   SortSpecsSingle;
     ImVector<ImGuiTableColumnSortSpecs> SortSpecsMulti;     // FIXME-OPT: Using a small-vector pattern would be good.
     ImGuiTableSortSpecs         SortSpecs;                  // Public facing sorts specs, this is what we return in TableGetSortSpecs()
+    ImGuiListClipperHeights     VirtualColumnsWidths;       // [VirtualizeColumns] WidthGiven of every column, with prefix sums to locate columns without visiting them all.
+    ImVector<ImGuiTableColumnIdx> VirtualActiveColumns;     // [VirtualizeColumns] Sorted list of columns laid out this frame (frozen/declared, in sight, interacted with, right-most). Other columns are left clipped.
+    float                       VirtualColumnsDefaultWidth; // [VirtualizeColumns] Value passed to TableSetupVirtualColumns().
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns using fixed width (<= ColumnsCount)
@@ -2843,6 +2974,8 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnIdx         FreezeRowsCount;            // Actual frozen row count (== FreezeRowsRequest, or == 0 when no scrolling offset)
     ImGuiTableColumnIdx         FreezeColumnsRequest;       // Requested frozen columns count
     ImGuiTableColumnIdx         FreezeColumnsCount;         // Actual frozen columns count (== FreezeColumnsRequest, or == 0 when no scrolling offset)
+    ImGuiTableColumnIdx         VirtualColumnsVisibleStart; // [VirtualizeColumns] Range of non-frozen columns in sight, see TableGetVisibleColumnsRange().
+    ImGuiTableColumnIdx         VirtualColumnsVisibleEnd;
     ImGuiTableColumnIdx         RowCellDataCurrent;         // Index of current RowCellData[] entry in current row
     ImGuiTableDrawChannelIdx    DummyDrawChannel;           // Redirect non-visible columns here.
     ImGuiTableDrawChannelIdx    Bg2DrawChannelCurrent;      // For Selectable() and other widgets drawing across columns after the freezing line. Index within DrawSplitter.Channels[]
@@ -2867,6 +3000,7 @@ struct IMGUI_API ImGuiTable
     bool                        HasScrollbarYPrev;          // Whether ANY instance of this table had a vertical scrollbar during the previous.
     bool                        MemoryCompacted;
     bool                        HostSkipItems;              // Backup of InnerWindow->SkipItem at the end of BeginTable(), because we will overwrite InnerWindow->SkipItem on a per-column basis
+    bool                        IsVirtualColumnsDirty;      // [VirtualizeColumns] Set to rebuild VirtualColumnsWidths[] from all columns.
 
     ImGuiTable()                { memset(this, 0, sizeof(*this)); LastFrameActive = -1; }
     ~ImGuiTable()               { IM_FREE(RawData); }
@@ -2883,6 +3017,8 @@ struct IMGUI_API ImGuiTableTempData
     float                       LastTimeActive;             // Last timestamp this structure was used
     float                       AngledHeadersExtraWidth;    // Used in EndTable()
     ImVector<ImGuiTableHeaderData> AngledHeadersRequests;   // Used in TableAngledHeadersRow()
+    ImVector<ImGuiTableColumnIdx> VirtualActiveColumnsPrev; // Used in TableUpdateVirtualColumns()
+    ImVector<float>             SimpleCellsRowsPosY;        // Used in TableSimpleCells()
 
     ImVec2                      UserOuterSize;              // outer_size.x passed to BeginTable()
     ImDrawListSplitter          DrawSplitter;
@@ -2993,6 +3129,12 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetForegroundDrawList(ImGuiViewport* viewport);                     // get foreground draw list for the given viewport. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API void          AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
 
+    // Fonts: Text measurement cache (used by CalcTextSize)
+    IMGUI_API const ImGuiTextMeasureCacheEntry* TextMeasureCacheLookup(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end);
+    IMGUI_API void          TextMeasureCacheNewFrame();
+    IMGUI_API ImFontShapedText* ShapedTextCacheGet(ImFont* font, float font_size, const char* text, const char* text_end);
+    IMGUI_API void          ShapedTextCacheNewFrame();
+
     // Init
     IMGUI_API void          Initialize();
     IMGUI_API void          Shutdown();    // Since 1.60 this is a _private_ function. You can call DestroyContext() to destroy the context created by CreateContext().
@@ -3296,6 +3438,7 @@ namespace ImGui
     IMGUI_API void          TableBeginApplyRequests(ImGuiTable* table);
     IMGUI_API void          TableSetupDrawChannels(ImGuiTable* table);
     IMGUI_API void          TableUpdateLayout(ImGuiTable* table);
+    IMGUI_API void          TableUpdateVirtualColumns(ImGuiTable* table);
     IMGUI_API void          TableUpdateBorders(ImGuiTable* table);
     IMGUI_API void          TableUpdateColumnsWeightFromWidth(ImGuiTable* table);
     IMGUI_API void          TableDrawBorders(ImGuiTable* table);
@@ -3383,10 +3526,13 @@ namespace ImGui
     // Widgets
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
     IMGUI_API bool          ButtonEx(const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
+    IMGUI_API bool          ButtonEx(ImGuiID id, const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0); // With precomputed ID, e.g. window->GetID(const ImGuiLabel&)
     IMGUI_API bool          ArrowButtonEx(const char* str_id, ImGuiDir dir, ImVec2 size_arg, ImGuiButtonFlags flags = 0);
     IMGUI_API bool          ImageButtonEx(ImGuiID id, ImTextureID texture_id, const ImVec2& image_size, const ImVec2& uv0, const ImVec2& uv1, const ImVec4& bg_col, const ImVec4& tint_col, ImGuiButtonFlags flags = 0);
     IMGUI_API void          SeparatorEx(ImGuiSeparatorFlags flags, float thickness = 1.0f);
     IMGUI_API void          SeparatorTextEx(ImGuiID id, const char* label, const char* label_end, float extra_width);
+    IMGUI_API bool          CheckboxEx(ImGuiID id, const char* label, bool* v);                                 // With precomputed ID
+    IMGUI_API bool          SelectableEx(ImGuiID id, const char* label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg); // With precomputed ID
     IMGUI_API bool          CheckboxFlags(const char* label, ImS64* flags, ImS64 flags_value);
     IMGUI_API bool          CheckboxFlags(const char* label, ImU64* flags, ImU64 flags_value);
 
@@ -3458,6 +3604,7 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcTrimToMemoryBudget();
 
     // Error handling, State Recovery
     IMGUI_API bool          ErrorLog(const char* msg);
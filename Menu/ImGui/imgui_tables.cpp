@@ -47,6 +47,7 @@ Index of this file:
 // - TableSetupScrollFreeze()                   user submit scroll freeze information (optional)
 //-----------------------------------------------------------------------------
 // - TableUpdateLayout() [Internal]             followup to BeginTable(): setup everything: widths, columns positions, clipping rectangles. Automatically called by the FIRST call to TableNextRow() or TableHeadersRow().
+//    | TableUpdateVirtualColumns()              - (if ImGuiTableFlags_VirtualizeColumns) select columns to lay out
 //    | TableSetupDrawChannels()                - setup ImDrawList channels
 //    | TableUpdateBorders()                    - detect hovering columns for resize, ahead of contents submission
 //    | TableBeginContextMenuPopup()
@@ -160,6 +161,8 @@ Index of this file:
 // - Note that auto-resizing columns don't play well with using the clipper.
 //   By default a table with _ScrollX but without _Resizable will have column auto-resize.
 //   So, if you want to use the clipper, make sure to either enable _Resizable, either setup columns width explicitly with _WidthFixed.
+// - For large grids of plain text, TableSimpleCells() submits a range of rows with its own clipper, and emits cells text without
+//   going through TableNextColumn() + Text() for each cell.
 //-----------------------------------------------------------------------------
 // About clipping/culling of Columns in Tables:
 // - Both TableSetColumnIndex() and TableNextColumn() return true when the column is visible or performing
@@ -179,6 +182,15 @@ Index of this file:
 // - We need to distinguish those cases because non-hidden columns that are clipped outside of scrolling bounds should still contribute their height to the row.
 //   However, in the majority of cases, the contribution to row height is the same for all columns, or the tallest cells are known by the programmer.
 //-----------------------------------------------------------------------------
+// About virtualization of Columns in Tables:
+// - By default the layout visits every column every frame, which is fine for tens or hundreds of columns but not for thousands.
+//   With ImGuiTableFlags_VirtualizeColumns, TableUpdateLayout() only visits leading (frozen and declared) columns, the right-most column,
+//   and non-frozen columns in sight. Positions of other columns are obtained from a sum tree of their widths (see ImGuiListClipperHeights).
+// - This requires _ScrollX and restricts columns to be fixed width, and not reorderable nor hideable, so that display order and enabled set are known
+//   without visiting columns. Columns are still resizable.
+// - Columns not visited are in the state of case [B] above, except that TableSetColumnIndex()/TableNextColumn() will also set SkipItems.
+//   Use TableGetVisibleColumnsRange() to only submit columns in sight, and ImGuiListClipper for rows.
+//-----------------------------------------------------------------------------
 // About clipping/culling of whole Tables:
 // - Scrolling tables with a known outer size can be clipped earlier as BeginTable() will return false.
 //-----------------------------------------------------------------------------
@@ -246,11 +258,13 @@ Index of this file:
 // - TableBeginInitMemory() [Internal]
 // - TableBeginApplyRequests() [Internal]
 // - TableSetupColumnFlags() [Internal]
+// - TableUpdateVirtualColumns() [Internal]
 // - TableUpdateLayout() [Internal]
 // - TableUpdateBorders() [Internal]
 // - EndTable()
 // - TableSetupColumn()
 // - TableSetupScrollFreeze()
+// - TableSetupVirtualColumns()
 //-----------------------------------------------------------------------------
 
 // Configuration
@@ -264,6 +278,10 @@ static const float TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER = 0.06f;   // Delay/tim
 // Helper
 inline ImGuiTableFlags TableFixFlags(ImGuiTableFlags flags, ImGuiWindow* outer_window)
 {
+    // Adjust flags: virtualized columns are fixed width, and cannot be reordered nor hidden (columns are only visited when in sight)
+    if (flags & ImGuiTableFlags_VirtualizeColumns)
+        flags = (flags & ~(ImGuiTableFlags_SizingMask_ | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable)) | ImGuiTableFlags_SizingFixedFit;
+
     // Adjust flags: set default sizing policy
     if ((flags & ImGuiTableFlags_SizingMask_) == 0)
         flags |= ((flags & ImGuiTableFlags_ScrollX) || (outer_window->Flags & ImGuiWindowFlags_AlwaysAutoResize)) ? ImGuiTableFlags_SizingFixedFit : ImGuiTableFlags_SizingStretchSame;
@@ -316,9 +334,11 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         return false;
 
     // Sanity checks
-    IM_ASSERT(columns_count > 0 && columns_count < IMGUI_TABLE_MAX_COLUMNS);
+    IM_ASSERT(columns_count > 0 && columns_count < ((flags & ImGuiTableFlags_VirtualizeColumns) ? IMGUI_TABLE_MAX_VIRTUALIZED_COLUMNS : IMGUI_TABLE_MAX_COLUMNS));
     if (flags & ImGuiTableFlags_ScrollX)
         IM_ASSERT(inner_width >= 0.0f);
+    if (flags & ImGuiTableFlags_VirtualizeColumns)
+        IM_ASSERT((flags & ImGuiTableFlags_ScrollX) && "ImGuiTableFlags_VirtualizeColumns requires ImGuiTableFlags_ScrollX!");
 
     // If an outer size is specified ahead we will be able to early out when not visible. Exact clipping criteria may evolve.
     // FIXME: coarse clipping because access to table data causes two issues:
@@ -356,7 +376,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
     table->DrawSplitter->Clear();
 
     // Fix flags
-    table->IsDefaultSizingPolicy = (flags & ImGuiTableFlags_SizingMask_) == 0;
+    table->IsDefaultSizingPolicy = (flags & (ImGuiTableFlags_SizingMask_ | ImGuiTableFlags_VirtualizeColumns)) == 0; // ImGuiTableFlags_VirtualizeColumns implies ImGuiTableFlags_SizingFixedFit
     flags = TableFixFlags(flags, outer_window);
 
     // Initialize
@@ -536,6 +556,8 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
 
     if ((previous_flags & ImGuiTableFlags_Reorderable) && (flags & ImGuiTableFlags_Reorderable) == 0)
         table->IsResetDisplayOrderRequest = true;
+    if ((previous_flags ^ flags) & ImGuiTableFlags_VirtualizeColumns)
+        table->IsVirtualColumnsDirty = true;
 
     // Mark as used to avoid GC
     if (table_idx >= g.TablesLastTimeActive.Size)
@@ -572,6 +594,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         table->ReorderColumn = table->ResizedColumn = table->LastResizedColumn = -1;
         table->AutoFitSingleColumn = -1;
         table->HoveredColumnBody = table->HoveredColumnBorder = -1;
+        table->IsVirtualColumnsDirty = true;
         for (int n = 0; n < columns_count; n++)
         {
             ImGuiTableColumn* column = &table->Columns[n];
@@ -610,6 +633,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         //IMGUI_DEBUG_PRINT("[table] %08X RefScaleUnit %.3f -> %.3f, scaling width by %.3f\n", table->ID, table->RefScaleUnit, new_ref_scale_unit, scale_factor);
         for (int n = 0; n < columns_count; n++)
             table->Columns[n].WidthRequest = table->Columns[n].WidthRequest * scale_factor;
+        table->IsVirtualColumnsDirty = true;
     }
     table->RefScale = new_ref_scale_unit;
 
@@ -782,6 +806,126 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
     }
 }
 
+// Columns visited by per-frame loops: all columns, or with ImGuiTableFlags_VirtualizeColumns, those selected by TableUpdateVirtualColumns().
+// As virtualized columns are always in default order, the returned value can be used both as a display order and as an index.
+static inline int TableGetLayoutColumnsCount(const ImGuiTable* table)      { return (table->Flags & ImGuiTableFlags_VirtualizeColumns) ? table->VirtualActiveColumns.Size : table->ColumnsCount; }
+static inline int TableGetLayoutColumn(const ImGuiTable* table, int n)     { return (table->Flags & ImGuiTableFlags_VirtualizeColumns) ? table->VirtualActiveColumns[n] : n; }
+
+// Width of a virtualized column which hasn't been laid out yet
+static float TableVirtualColumnsAdapterIndexToWidth(ImGuiListClipperHeights* widths, int column_n)
+{
+    const ImGuiTable* table = (const ImGuiTable*)widths->UserData;
+    float width = table->Columns[column_n].WidthRequest;
+    if (width < 0.0f)
+        width = (table->VirtualColumnsDefaultWidth > 0.0f) ? table->VirtualColumnsDefaultWidth : table->MinColumnWidth * 4.0f; // Same as initial auto-fit width in TableUpdateLayout()
+    return ImTrunc(ImMax(width, table->MinColumnWidth));
+}
+
+// Offset of a virtualized column's MinX from the MinX of the first column
+static float TableGetVirtualColumnOffset(const ImGuiTable* table, int column_n)
+{
+    const float column_spacing = table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
+    return (float)table->VirtualColumnsWidths.GetItemOffset(column_n) + column_spacing * column_n;
+}
+
+// Put a virtualized column in the same state as a column clipped by TableUpdateLayout(), without positioning it.
+static void TableSetVirtualColumnClipped(ImGuiTable* table, ImGuiTableColumn* column)
+{
+    column->ClipRect.Max.x = column->ClipRect.Min.x;
+    column->IsVisibleX = column->IsRequestOutput = false;
+    column->IsSkipItems = true;
+    column->ItemWidth = 1.0f;
+    column->NameOffset = -1;
+    column->NavLayerCurrent = ImGuiNavLayer_Main;
+    column->Flags &= ~(ImGuiTableColumnFlags_IsVisible | ImGuiTableColumnFlags_IsHovered);
+    ImBitArrayClearBit(table->VisibleMaskByIndex, table->Columns.index_from_ptr(column));
+}
+
+// Select columns visited by TableUpdateLayout() and other per-frame loops when using ImGuiTableFlags_VirtualizeColumns:
+// - leading columns: frozen columns, and declared columns (as TableSetupColumn() data needs to be applied).
+// - non-frozen columns in sight, using last known widths, plus one on each side so keyboard/gamepad navigation can reach them.
+// - the right-most column (for contents width), and columns being interacted with.
+// Other columns keep their state from the last time they were visited, their width in VirtualColumnsWidths, and are left clipped.
+void ImGui::TableUpdateVirtualColumns(ImGuiTable* table)
+{
+    IM_ASSERT(table->Flags & ImGuiTableFlags_VirtualizeColumns);
+    const int columns_count = table->ColumnsCount;
+    ImGuiListClipperHeights* widths = &table->VirtualColumnsWidths;
+    ImVector<ImGuiTableColumnIdx>& active_columns = table->VirtualActiveColumns;
+
+    // Rebuild everything on init, columns count change, settings load or DPI change.
+    // All columns are enabled and in default order, so links and enabled masks only need to be set here.
+    if (table->IsVirtualColumnsDirty || widths->Size != columns_count)
+    {
+        ImBitArraySetBitRange(table->EnabledMaskByIndex, 0, columns_count);
+        ImBitArraySetBitRange(table->EnabledMaskByDisplayOrder, 0, columns_count);
+        for (int column_n = 0; column_n < columns_count; column_n++)
+        {
+            ImGuiTableColumn* column = &table->Columns[column_n];
+            column->DisplayOrder = table->DisplayOrderToIndex[column_n] = (ImGuiTableColumnIdx)column_n;
+            column->PrevEnabledColumn = (ImGuiTableColumnIdx)(column_n - 1);
+            column->NextEnabledColumn = (ImGuiTableColumnIdx)((column_n + 1 < columns_count) ? column_n + 1 : -1);
+            column->IndexWithinEnabledSet = (ImGuiTableColumnIdx)column_n;
+            TableSetVirtualColumnClipped(table, column);
+        }
+        widths->Clear();
+        widths->UserData = table;
+        widths->AdapterIndexToHeight = TableVirtualColumnsAdapterIndexToWidth;
+        widths->Resize(columns_count);
+        widths->AdapterIndexToHeight = NULL;
+        active_columns.resize(0);
+        table->IsVirtualColumnsDirty = false;
+    }
+
+    // Find non-frozen columns in sight (positions are computed the same way in TableUpdateLayout())
+    const int freeze_count = table->FreezeColumnsRequest;
+    const float column_spacing = table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
+    const float clip_max_x = table->InnerClipRect.Max.x;
+    float clip_min_x = table->InnerClipRect.Min.x;
+    if (table->FreezeColumnsCount > 0)
+        clip_min_x = ImClamp(table->OuterRect.Min.x + table->OuterPaddingX - table->CellSpacingX1 + TableGetVirtualColumnOffset(table, table->FreezeColumnsCount) + TABLE_BORDER_SIZE, clip_min_x, clip_max_x);
+    const float base_x = table->WorkRect.Min.x + table->OuterPaddingX - table->CellSpacingX1;
+    int visible_start = widths->FindItemAtOffset(clip_min_x - base_x, column_spacing);
+    int visible_end = widths->FindItemAtOffset(clip_max_x - base_x, column_spacing) + 1;
+    visible_start = ImMax(visible_start - 1, freeze_count);
+    visible_end = ImMax(ImMin(visible_end + 1, columns_count), visible_start);
+    table->VirtualColumnsVisibleStart = (ImGuiTableColumnIdx)visible_start;
+    table->VirtualColumnsVisibleEnd = (ImGuiTableColumnIdx)visible_end;
+
+    // Build sorted list of active columns. Previous list is kept to clip columns which are not active anymore.
+    ImVector<ImGuiTableColumnIdx>& prev_active_columns = table->TempData->VirtualActiveColumnsPrev;
+    prev_active_columns.swap(active_columns);
+    active_columns.resize(0);
+    const int leading_count = ImMin(ImMax(freeze_count, (int)table->DeclColumnsCount), columns_count);
+    for (int column_n = 0; column_n < leading_count; column_n++)
+        active_columns.push_back((ImGuiTableColumnIdx)column_n);
+    for (int column_n = ImMax(visible_start, leading_count); column_n < visible_end; column_n++)
+        active_columns.push_back((ImGuiTableColumnIdx)column_n);
+    const int extra_columns[] = { table->ResizedColumn, table->LastResizedColumn, table->ContextPopupColumn, columns_count - 1 };
+    for (int column_n : extra_columns)
+    {
+        if (column_n < 0 || column_n >= columns_count)
+            continue;
+        int insert_n = active_columns.Size;
+        while (insert_n > 0 && active_columns[insert_n - 1] > column_n)
+            insert_n--;
+        if (insert_n == 0 || active_columns[insert_n - 1] != column_n)
+            active_columns.insert(active_columns.Data + insert_n, (ImGuiTableColumnIdx)column_n);
+    }
+
+    // Clip columns which are not active anymore, clear visibility of active ones (will be set by TableUpdateLayout())
+    for (int prev_n = 0, n = 0; prev_n < prev_active_columns.Size; prev_n++)
+    {
+        const int column_n = prev_active_columns[prev_n];
+        while (n < active_columns.Size && active_columns[n] < column_n)
+            n++;
+        if (n == active_columns.Size || active_columns[n] != column_n)
+            TableSetVirtualColumnClipped(table, &table->Columns[column_n]);
+    }
+    for (int column_n : active_columns)
+        ImBitArrayClearBit(table->VisibleMaskByIndex, column_n);
+}
+
 // Layout columns for the frame. This is in essence the followup to BeginTable() and this is our largest function.
 // Runs on the first call to TableNextRow(), to give a chance for TableSetupColumn() and other TableSetupXXXXX() functions to be called first.
 // FIXME-TABLE: Our width (and therefore our WorkRect) will be minimal in the first frame for _WidthAuto columns.
@@ -792,13 +936,23 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     IM_ASSERT(table->IsLayoutLocked == false);
 
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
+    const bool is_virtualized = (table->Flags & ImGuiTableFlags_VirtualizeColumns) != 0;
     table->IsDefaultDisplayOrder = true;
     table->ColumnsEnabledCount = 0;
-    ImBitArrayClearAllBits(table->EnabledMaskByIndex, table->ColumnsCount);
-    ImBitArrayClearAllBits(table->EnabledMaskByDisplayOrder, table->ColumnsCount);
+    if (!is_virtualized)
+    {
+        ImBitArrayClearAllBits(table->EnabledMaskByIndex, table->ColumnsCount);
+        ImBitArrayClearAllBits(table->EnabledMaskByDisplayOrder, table->ColumnsCount);
+    }
     table->LeftMostEnabledColumn = -1;
     table->MinColumnWidth = ImMax(1.0f, g.Style.FramePadding.x * 1.0f); // g.Style.ColumnsMinSpacing; // FIXME-TABLE
 
+    // [Part 0] With ImGuiTableFlags_VirtualizeColumns, select the subset of columns visited by the loops below.
+    // Otherwise all columns are visited. See TableGetLayoutColumn().
+    if (is_virtualized)
+        TableUpdateVirtualColumns(table);
+    const int layout_columns_count = TableGetLayoutColumnsCount(table);
+
     // [Part 1] Apply/lock Enabled and Order states. Calculate auto/ideal width for columns. Count fixed/stretch columns.
     // Process columns in their visible orders as we are building the Prev/Next indices.
     int count_fixed = 0;                // Number of columns that have fixed sizing policies
@@ -808,8 +962,9 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     bool has_resizable = false;
     float stretch_sum_width_auto = 0.0f;
     float fixed_max_width_auto = 0.0f;
-    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+    for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
     {
+        const int order_n = TableGetLayoutColumn(table, layout_n);
         const int column_n = table->DisplayOrderToIndex[order_n];
         if (column_n != order_n)
             table->IsDefaultDisplayOrder = false;
@@ -824,6 +979,17 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             column->NameOffset = -1;
             column->UserID = 0;
             column->InitStretchWeightOrWidth = -1.0f;
+
+            // Behave as if declared with the width passed to TableSetupVirtualColumns()
+            if (is_virtualized && table->VirtualColumnsDefaultWidth > 0.0f)
+            {
+                column->InitStretchWeightOrWidth = table->VirtualColumnsDefaultWidth;
+                if (column->WidthRequest < 0.0f)
+                {
+                    column->WidthRequest = table->VirtualColumnsDefaultWidth;
+                    column->AutoFitQueue = 0x00;
+                }
+            }
         }
 
         // Update Enabled state, mark settings and sort specs dirty
@@ -853,17 +1019,21 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         }
 
         // Mark as enabled and link to previous/next enabled column
-        column->PrevEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
-        column->NextEnabledColumn = -1;
-        if (prev_visible_column_idx != -1)
-            table->Columns[prev_visible_column_idx].NextEnabledColumn = (ImGuiTableColumnIdx)column_n;
-        else
-            table->LeftMostEnabledColumn = (ImGuiTableColumnIdx)column_n;
-        column->IndexWithinEnabledSet = table->ColumnsEnabledCount++;
-        ImBitArraySetBit(table->EnabledMaskByIndex, column_n);
-        ImBitArraySetBit(table->EnabledMaskByDisplayOrder, column->DisplayOrder);
-        prev_visible_column_idx = column_n;
-        IM_ASSERT(column->IndexWithinEnabledSet <= column->DisplayOrder);
+        // (with ImGuiTableFlags_VirtualizeColumns all columns are enabled and this was done once by TableUpdateVirtualColumns())
+        if (!is_virtualized)
+        {
+            column->PrevEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
+            column->NextEnabledColumn = -1;
+            if (prev_visible_column_idx != -1)
+                table->Columns[prev_visible_column_idx].NextEnabledColumn = (ImGuiTableColumnIdx)column_n;
+            else
+                table->LeftMostEnabledColumn = (ImGuiTableColumnIdx)column_n;
+            column->IndexWithinEnabledSet = table->ColumnsEnabledCount++;
+            ImBitArraySetBit(table->EnabledMaskByIndex, column_n);
+            ImBitArraySetBit(table->EnabledMaskByDisplayOrder, column->DisplayOrder);
+            prev_visible_column_idx = column_n;
+            IM_ASSERT(column->IndexWithinEnabledSet <= column->DisplayOrder);
+        }
 
         // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
         // Combine width from regular rows + width from headers unless requested not to.
@@ -890,6 +1060,13 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             count_fixed++;
         }
     }
+    if (is_virtualized)
+    {
+        table->ColumnsEnabledCount = (ImGuiTableColumnIdx)table->ColumnsCount;
+        table->LeftMostEnabledColumn = 0;
+        prev_visible_column_idx = table->ColumnsCount - 1;
+        count_fixed = table->ColumnsCount;
+    }
     if ((table->Flags & ImGuiTableFlags_Sortable) && table->SortSpecsCount == 0 && !(table->Flags & ImGuiTableFlags_SortTristate))
         table->IsSortSpecsDirty = true;
     table->RightMostEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
@@ -907,8 +1084,9 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     float sum_width_requests = 0.0f;    // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
     float stretch_sum_weights = 0.0f;   // Sum of all weights for stretch columns.
     table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
     {
+        const int column_n = TableGetLayoutColumn(table, layout_n);
         if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -971,8 +1149,9 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     const float width_avail_for_stretched_columns = width_avail - width_spacings - sum_width_requests;
     float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
     table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
     {
+        const int column_n = TableGetLayoutColumn(table, layout_n);
         if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -1039,15 +1218,23 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     float offset_x = ((table->FreezeColumnsCount > 0) ? table->OuterRect.Min.x : work_rect.Min.x) + table->OuterPaddingX - table->CellSpacingX1;
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
-    ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
-    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+    if (!is_virtualized)
+        ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
+    for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
     {
+        const int order_n = TableGetLayoutColumn(table, layout_n);
         const int column_n = table->DisplayOrderToIndex[order_n];
         ImGuiTableColumn* column = &table->Columns[column_n];
 
         column->NavLayerCurrent = (ImS8)(table->FreezeRowsCount > 0 ? ImGuiNavLayer_Menu : ImGuiNavLayer_Main); // Use Count NOT request so Header line changes layer when frozen
 
-        if (offset_x_frozen && table->FreezeColumnsCount == visible_n)
+        if (is_virtualized)
+        {
+            // Columns in-between were not visited: position from the sum of widths of all columns on the left
+            visible_n = order_n;
+            offset_x = ((visible_n < table->FreezeColumnsCount) ? table->OuterRect.Min.x : work_rect.Min.x) + table->OuterPaddingX - table->CellSpacingX1 + TableGetVirtualColumnOffset(table, column_n);
+        }
+        else if (offset_x_frozen && table->FreezeColumnsCount == visible_n)
         {
             offset_x += work_rect.Min.x - table->OuterRect.Min.x;
             offset_x_frozen = false;
@@ -1079,6 +1266,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->WidthGiven = ImMin(column->WidthGiven, column->WidthMax);
         column->WidthGiven = ImMax(column->WidthGiven, ImMin(column->WidthRequest, table->MinColumnWidth));
         column->MaxX = offset_x + column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
+        if (is_virtualized)
+            table->VirtualColumnsWidths.SetItemHeight(column_n, column->WidthGiven);
 
         // Lock other positions
         // - ClipRect.Min.x: Because merging draw commands doesn't compare min boundaries, we make ClipRect.Min.x match left bounds to be consistent regardless of merging.
@@ -1173,6 +1362,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         offset_x += column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
         visible_n++;
     }
+    if (is_virtualized)
+        table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount + (float)table->VirtualColumnsWidths.GetTotalHeight();
 
     // In case the table is visible (e.g. decorations) but all columns clipped, we keep a column visible.
     // Else if give no chance to a clipper-savy user to submit rows and therefore total contents height used by scrollbar.
@@ -1282,8 +1473,10 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
     const float hit_y2_body = ImMax(table->OuterRect.Max.y, hit_y1 + table_instance->LastOuterHeight - table->AngledHeadersHeight);
     const float hit_y2_head = hit_y1 + table_instance->LastTopHeadersRowHeight;
 
-    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+    const int layout_columns_count = TableGetLayoutColumnsCount(table);
+    for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
     {
+        const int order_n = TableGetLayoutColumn(table, layout_n);
         if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
             continue;
 
@@ -1419,7 +1612,9 @@ void    ImGui::EndTable()
     float auto_fit_width_for_fixed = 0.0f;
     float auto_fit_width_for_stretched = 0.0f;
     float auto_fit_width_for_stretched_min = 0.0f;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    if (table->Flags & ImGuiTableFlags_VirtualizeColumns)
+        auto_fit_width_for_fixed = (float)table->VirtualColumnsWidths.GetTotalHeight(); // All columns are fixed: use last known widths instead of visiting every column
+    else for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         if (IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
         {
             ImGuiTableColumn* column = &table->Columns[column_n];
@@ -1586,6 +1781,8 @@ void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, flo
     TableSetupColumnFlags(table, column, flags);
     column->UserID = user_id;
     flags = column->Flags;
+    if (table->Flags & ImGuiTableFlags_VirtualizeColumns)
+        IM_ASSERT((flags & (ImGuiTableColumnFlags_WidthStretch | ImGuiTableColumnFlags_Disabled)) == 0 && "ImGuiTableFlags_VirtualizeColumns only supports fixed width columns, which cannot be disabled.");
 
     // Initialize defaults
     column->InitStretchWeightOrWidth = init_width_or_weight;
@@ -1653,6 +1850,23 @@ void ImGui::TableSetupScrollFreeze(int columns, int rows)
     }
 }
 
+// [Public]
+// Columns not declared with TableSetupColumn() are auto-fit when they are first laid out, which with ImGuiTableFlags_VirtualizeColumns
+// is when they come into view: this gives them a width ahead, so the total contents width and scrollbar are stable.
+void ImGui::TableSetupVirtualColumns(float default_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableSetupVirtualColumns() after BeginTable()!");
+    IM_ASSERT(table->IsLayoutLocked == false && "Need to call TableSetupVirtualColumns() before first row!");
+    IM_ASSERT((table->Flags & ImGuiTableFlags_VirtualizeColumns) && "Need to use ImGuiTableFlags_VirtualizeColumns!");
+    if (table->VirtualColumnsDefaultWidth != default_width)
+    {
+        table->VirtualColumnsDefaultWidth = default_width;
+        table->IsVirtualColumnsDirty = true;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Tables: Simple accessors
 //-----------------------------------------------------------------------------
@@ -1665,6 +1879,7 @@ void ImGui::TableSetupScrollFreeze(int columns, int rows)
 // - TableGetColumnResizeID() [Internal]
 // - TableGetHoveredColumn() [Internal]
 // - TableGetHoveredRow() [Internal]
+// - TableGetVisibleColumnsRange()
 // - TableSetBgColor()
 //-----------------------------------------------------------------------------
 
@@ -1782,6 +1997,27 @@ int ImGui::TableGetHoveredRow()
     return (int)table_instance->HoveredRowLast;
 }
 
+// Return range of non-frozen columns to submit, to avoid submitting every column of a table using ImGuiTableFlags_VirtualizeColumns.
+// Frozen columns [0, FreezeColumnsRequest) are always to be submitted.
+void ImGui::TableGetVisibleColumnsRange(int* out_start, int* out_end)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableGetVisibleColumnsRange() after BeginTable()!");
+    if (!table->IsLayoutLocked)
+        TableUpdateLayout(table);
+    if (table->Flags & ImGuiTableFlags_VirtualizeColumns)
+    {
+        *out_start = table->VirtualColumnsVisibleStart;
+        *out_end = table->VirtualColumnsVisibleEnd;
+    }
+    else
+    {
+        *out_start = table->FreezeColumnsRequest;
+        *out_end = table->ColumnsCount;
+    }
+}
+
 void ImGui::TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n)
 {
     ImGuiContext& g = *GImGui;
@@ -1831,6 +2067,7 @@ void ImGui::TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n
 // - TableNextRow()
 // - TableBeginRow() [Internal]
 // - TableEndRow() [Internal]
+// - TableSimpleCells()
 //-------------------------------------------------------------------------
 
 // [Public] Note: for row coloring we use ->RowBgColorCounter which is the same value without counting header rows
@@ -1963,9 +2200,15 @@ void ImGui::TableEndRow(ImGuiTable* table)
         {
             // In theory we could call SetWindowClipRectBeforeSetChannel() but since we know TableEndRow() is
             // always followed by a change of clipping rectangle we perform the smallest overwrite possible here.
+            // Rows without cells (e.g. from TableSimpleCells(), or TableNextRow() calls with no TableNextColumn()) are still on the background channel,
+            // so SetCurrentChannel() would be a no-op: apply the overwrite to the current command instead. Otherwise, leading rows without cells
+            // would keep the clip rectangle of the previous command and split the backgrounds into an extra draw command.
             if ((table->Flags & ImGuiTableFlags_NoClip) == 0)
                 window->DrawList->_CmdHeader.ClipRect = table->Bg0ClipRectForDrawCmd.ToVec4();
-            table->DrawSplitter->SetCurrentChannel(window->DrawList, TABLE_DRAW_CHANNEL_BG0);
+            if (table->DrawSplitter->_Current == TABLE_DRAW_CHANNEL_BG0)
+                window->DrawList->_OnChangedClipRect();
+            else
+                table->DrawSplitter->SetCurrentChannel(window->DrawList, TABLE_DRAW_CHANNEL_BG0);
         }
 
         // Draw row background
@@ -2010,10 +2253,11 @@ void ImGui::TableEndRow(ImGuiTable* table)
     // End frozen rows (when we are past the last frozen row line, teleport cursor and alter clipping rectangle)
     // We need to do that in TableEndRow() instead of TableBeginRow() so the list clipper can mark end of row and
     // get the new cursor position.
+    const int layout_columns_count = TableGetLayoutColumnsCount(table);
     if (unfreeze_rows_request)
     {
-        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-            table->Columns[column_n].NavLayerCurrent = ImGuiNavLayer_Main;
+        for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
+            table->Columns[TableGetLayoutColumn(table, layout_n)].NavLayerCurrent = ImGuiNavLayer_Main;
         const float y0 = ImMax(table->RowPosY2 + 1, table->InnerClipRect.Min.y);
         table_instance->LastFrozenHeight = y0 - table->OuterRect.Min.y;
 
@@ -2031,16 +2275,18 @@ void ImGui::TableEndRow(ImGuiTable* table)
             float row_height = table->RowPosY2 - table->RowPosY1;
             table->RowPosY2 = window->DC.CursorPos.y = table->WorkRect.Min.y + table->RowPosY2 - table->OuterRect.Min.y;
             table->RowPosY1 = table->RowPosY2 - row_height;
-            for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+            for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
             {
-                ImGuiTableColumn* column = &table->Columns[column_n];
+                ImGuiTableColumn* column = &table->Columns[TableGetLayoutColumn(table, layout_n)];
                 column->DrawChannelCurrent = column->DrawChannelUnfrozen;
                 column->ClipRect.Min.y = table->Bg2ClipRectForDrawCmd.Min.y;
             }
 
             // Update cliprect ahead of TableBeginCell() so clipper can access to new ClipRect->Min.y
-            SetWindowClipRectBeforeSetChannel(window, table->Columns[0].ClipRect);
-            table->DrawSplitter->SetCurrentChannel(window->DrawList, table->Columns[0].DrawChannelCurrent);
+            // (with ImGuiTableFlags_VirtualizeColumns, column 0 may not have been laid out: use first column that was)
+            ImGuiTableColumn* first_column = &table->Columns[TableGetLayoutColumn(table, 0)];
+            SetWindowClipRectBeforeSetChannel(window, first_column->ClipRect);
+            table->DrawSplitter->SetCurrentChannel(window->DrawList, first_column->DrawChannelCurrent);
         }
     }
 
@@ -2049,6 +2295,97 @@ void ImGui::TableEndRow(ImGuiTable* table)
     table->IsInsideRow = false;
 }
 
+// [Public] Submit rows [row_start, row_end) where each cell is a single line of non-interactive text provided by 'getter'.
+// - Rows are clipped with an ImGuiListClipper: all rows have the same height, so the range can be the whole data set.
+// - Rather than going through TableBeginCell()/TableEndCell() and Text() for each cell, we handle one clipper step at a time:
+//   rows are laid out first, then for each column we switch draw channel once and emit the text of all rows.
+//   Therefore 'getter' is called column by column, and not necessarily for cells of columns which are out of sight.
+// - 'getter' may return a pointer to its own string, or format into 'buf' and return 'buf'. Text after '##' is not hidden.
+void ImGui::TableSimpleCells(int row_start, int row_end, const char* (*getter)(void* user_data, int row, int column, char* buf, int buf_size), void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableSimpleCells() after BeginTable()!");
+    IM_ASSERT(getter != NULL && row_start <= row_end);
+    if (!table->IsLayoutLocked)
+        TableUpdateLayout(table);
+
+    ImGuiWindow* window = table->InnerWindow;
+    ImVector<float>& rows_pos_y = table->TempData->SimpleCellsRowsPosY;
+    const float row_height = g.FontSize + g.Style.CellPadding.y * 2.0f;
+    const ImU32 text_col = GetColorU32(ImGuiCol_Text);
+    char buf[512];
+
+    ImGuiListClipper clipper;
+    clipper.Begin(row_end - row_start, row_height);
+    while (clipper.Step())
+    {
+        // Logging: submit cells in regular order
+        if (g.LogEnabled)
+        {
+            for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+            {
+                TableNextRow(ImGuiTableRowFlags_None, row_height);
+                for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+                    if (TableSetColumnIndex(column_n))
+                        TextUnformatted(getter(user_data, row_start + row_n, column_n, buf, IM_ARRAYSIZE(buf)));
+            }
+            continue;
+        }
+
+        // Lay out rows. A clipper step never straddles the last frozen row, so all rows share the same draw channels and clipping rectangles.
+        rows_pos_y.resize(0);
+        for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+        {
+            TableNextRow(ImGuiTableRowFlags_None, row_height);
+            rows_pos_y.push_back(table->RowPosY1 + table->RowCellPaddingY);
+        }
+
+        // Emit text column by column
+        const int layout_columns_count = TableGetLayoutColumnsCount(table);
+        for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
+        {
+            const int column_n = TableGetLayoutColumn(table, layout_n);
+            ImGuiTableColumn* column = &table->Columns[column_n];
+            if (!column->IsRequestOutput || column->IsSkipItems)
+                continue;
+            const bool is_visible = column->IsVisibleX;
+            if (is_visible)
+            {
+                if (table->Flags & ImGuiTableFlags_NoClip)
+                {
+                    table->DrawSplitter->SetCurrentChannel(window->DrawList, TABLE_DRAW_CHANNEL_NOCLIP);
+                }
+                else
+                {
+                    SetWindowClipRectBeforeSetChannel(window, column->ClipRect);
+                    table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
+                }
+            }
+
+            // Report maximum position so we can infer content size (same as Text() + TableEndCell() would do)
+            // Cull text the same way ItemAdd() would.
+            const float start_x = (column->Flags & ImGuiTableColumnFlags_IndentEnable) ? column->WorkMinX + table->RowIndentOffsetX : column->WorkMinX;
+            float max_pos_x = start_x;
+            for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+            {
+                const char* text = getter(user_data, row_start + row_n, column_n, buf, IM_ARRAYSIZE(buf));
+                const char* text_end = text + strlen(text);
+                if (text == text_end)
+                    continue;
+                const ImVec2 text_pos(start_x, rows_pos_y[row_n - clipper.DisplayStart]);
+                ImVec2 text_size = g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, text, text_end); // Same as CalcTextSize(), bypassing the measure cache which is a loss for short and short-lived cell contents
+                text_size.x = IM_TRUNC(text_size.x + 0.99999f);
+                max_pos_x = ImMax(max_pos_x, text_pos.x + text_size.x);
+                if (is_visible && ImRect(text_pos, text_pos + text_size).Overlaps(window->ClipRect))
+                    window->DrawList->AddText(g.Font, g.FontSize, text_pos, text_col, text, text_end);
+            }
+            float* p_max_pos_x = table->IsUnfrozenRows ? &column->ContentMaxXUnfrozen : &column->ContentMaxXFrozen;
+            *p_max_pos_x = ImMax(*p_max_pos_x, max_pos_x);
+        }
+    }
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Columns changes
 //-------------------------------------------------------------------------
@@ -2160,8 +2497,9 @@ void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
     else
     {
         // FIXME-TABLE: Could avoid this if draw channel is dummy channel?
+        // (columns clipped by ImGuiTableFlags_VirtualizeColumns have a stale DrawChannelCurrent, so use the dummy channel directly)
         SetWindowClipRectBeforeSetChannel(window, column->ClipRect);
-        table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
+        table->DrawSplitter->SetCurrentChannel(window->DrawList, column->IsVisibleX ? column->DrawChannelCurrent : table->DummyDrawChannel);
     }
 
     // Logging
@@ -2428,7 +2766,7 @@ void ImGui::TablePopBackgroundChannel()
 
     // Optimization: avoid PopClipRect() + SetCurrentChannel()
     SetWindowClipRectBeforeSetChannel(window, table->HostBackupInnerClipRect);
-    table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
+    table->DrawSplitter->SetCurrentChannel(window->DrawList, column->IsVisibleX ? column->DrawChannelCurrent : table->DummyDrawChannel);
 }
 
 // Allocate draw channels. Called by TableUpdateLayout()
@@ -2447,12 +2785,23 @@ void ImGui::TablePopBackgroundChannel()
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
 // Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// With ImGuiTableFlags_VirtualizeColumns, N is the number of visible columns, and D is always 1.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
+    const bool is_virtualized = (table->Flags & ImGuiTableFlags_VirtualizeColumns) != 0;
+    const int layout_columns_count = TableGetLayoutColumnsCount(table);
+    int columns_for_row = table->ColumnsEnabledCount;
+    if (is_virtualized)
+    {
+        columns_for_row = 0;
+        for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
+            if (table->Columns[TableGetLayoutColumn(table, layout_n)].IsVisibleX)
+                columns_for_row++;
+    }
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : columns_for_row;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
-    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
+    const int channels_for_dummy = (is_virtualized || table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
@@ -2460,9 +2809,9 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
     table->Bg2DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)((table->FreezeRowsCount > 0) ? 2 + channels_for_row : TABLE_DRAW_CHANNEL_BG2_FROZEN);
 
     int draw_channel_current = 2;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
     {
-        ImGuiTableColumn* column = &table->Columns[column_n];
+        ImGuiTableColumn* column = &table->Columns[TableGetLayoutColumn(table, layout_n)];
         if (column->IsVisibleX && column->IsVisibleY)
         {
             column->DrawChannelFrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current);
@@ -2534,7 +2883,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     MergeGroup merge_groups[4];
 
     // Use a reusable temp buffer for the merge masks as they are dynamically sized.
-    const int max_draw_channels = (4 + table->ColumnsCount * 2);
+    const int max_draw_channels = (table->Flags & ImGuiTableFlags_VirtualizeColumns) ? splitter->_Count : (4 + table->ColumnsCount * 2);
     const int size_for_masks_bitarrays_one = (int)ImBitArrayGetStorageSizeInBytes(max_draw_channels);
     g.TempBuffer.reserve(size_for_masks_bitarrays_one * 5);
     memset(g.TempBuffer.Data, 0, size_for_masks_bitarrays_one * 5);
@@ -2543,8 +2892,10 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     ImBitArrayPtr remaining_mask = (ImBitArrayPtr)(void*)(g.TempBuffer.Data + (size_for_masks_bitarrays_one * 4));
 
     // 1. Scan channels and take note of those which can be merged
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    const int layout_columns_count = TableGetLayoutColumnsCount(table);
+    for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
     {
+        const int column_n = TableGetLayoutColumn(table, layout_n);
         if (!IM_BITARRAY_TESTBIT(table->VisibleMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -2716,8 +3067,10 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
     const float draw_y2_head = table->IsUsingHeaders ? ImMin(table->InnerRect.Max.y, (table->FreezeRowsCount >= 1 ? table->InnerRect.Min.y : table->WorkRect.Min.y) + table_instance->LastTopHeadersRowHeight) : draw_y1;
     if (table->Flags & ImGuiTableFlags_BordersInnerV)
     {
-        for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+        const int layout_columns_count = TableGetLayoutColumnsCount(table);
+        for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
         {
+            const int order_n = TableGetLayoutColumn(table, layout_n);
             if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
                 continue;
 
@@ -2999,7 +3352,7 @@ float ImGui::TableGetHeaderRowHeight()
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     float row_height = g.FontSize;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    for (int column_n = 0; column_n < table->DeclColumnsCount; column_n++) // Only declared columns have a name
         if (IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
             if ((table->Columns[column_n].Flags & ImGuiTableColumnFlags_NoHeaderLabel) == 0)
                 row_height = ImMax(row_height, CalcTextSize(TableGetColumnName(table, column_n)).y);
@@ -3011,13 +3364,26 @@ float ImGui::TableGetHeaderAngledMaxLabelWidth()
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     float width = 0.0f;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    for (int column_n = 0; column_n < table->DeclColumnsCount; column_n++) // Only declared columns have a name
         if (IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
             if (table->Columns[column_n].Flags & ImGuiTableColumnFlags_AngledHeader)
                 width = ImMax(width, CalcTextSize(TableGetColumnName(table, column_n), NULL, true).x);
     return width + g.Style.CellPadding.y * 2.0f; // Swap padding
 }
 
+// Submit header of a single column from TableHeadersRow()
+static void TableHeadersRowColumn(int column_n)
+{
+    if (!ImGui::TableSetColumnIndex(column_n))
+        return;
+
+    // Push an id to allow empty/unnamed headers. This is also idiomatic as it ensure there is a consistent ID path to access columns (for e.g. automation)
+    const char* name = (ImGui::TableGetColumnFlags(column_n) & ImGuiTableColumnFlags_NoHeaderLabel) ? "" : ImGui::TableGetColumnName(column_n);
+    ImGui::PushID(column_n);
+    ImGui::TableHeader(name);
+    ImGui::PopID();
+}
+
 // [Public] This is a helper to output TableHeader() calls based on the column names declared in TableSetupColumn().
 // The intent is that advanced users willing to create customized headers would not need to use this helper
 // and can create their own! For example: TableHeader() may be preceded by Checkbox() or other custom widgets.
@@ -3043,18 +3409,14 @@ void ImGui::TableHeadersRow()
     if (table->HostSkipItems) // Merely an optimization, you may skip in your own code.
         return;
 
+    // Only submit frozen columns and columns in sight (this only makes a difference with ImGuiTableFlags_VirtualizeColumns)
     const int columns_count = TableGetColumnCount();
-    for (int column_n = 0; column_n < columns_count; column_n++)
-    {
-        if (!TableSetColumnIndex(column_n))
-            continue;
-
-        // Push an id to allow empty/unnamed headers. This is also idiomatic as it ensure there is a consistent ID path to access columns (for e.g. automation)
-        const char* name = (TableGetColumnFlags(column_n) & ImGuiTableColumnFlags_NoHeaderLabel) ? "" : TableGetColumnName(column_n);
-        PushID(column_n);
-        TableHeader(name);
-        PopID();
-    }
+    int visible_start, visible_end;
+    TableGetVisibleColumnsRange(&visible_start, &visible_end);
+    for (int column_n = 0; column_n < table->FreezeColumnsRequest; column_n++)
+        TableHeadersRowColumn(column_n);
+    for (int column_n = visible_start; column_n < visible_end; column_n++)
+        TableHeadersRowColumn(column_n);
 
     // Allow opening popup from the right-most section after the last column.
     ImVec2 mouse_pos = ImGui::GetMousePos();
@@ -3227,16 +3589,19 @@ void ImGui::TableAngledHeadersRow()
     // Build up request
     ImU32 col_header_bg = GetColorU32(ImGuiCol_TableHeaderBg);
     ImU32 col_text = GetColorU32(ImGuiCol_Text);
-    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
-        if (IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
-        {
-            const int column_n = table->DisplayOrderToIndex[order_n];
-            ImGuiTableColumn* column = &table->Columns[column_n];
-            if ((column->Flags & ImGuiTableColumnFlags_AngledHeader) == 0) // Note: can't rely on ImGuiTableColumnFlags_IsVisible test here.
-                continue;
-            ImGuiTableHeaderData request = { (ImGuiTableColumnIdx)column_n, col_text, col_header_bg, (column_n == highlight_column_n) ? GetColorU32(ImGuiCol_Header) : 0 };
-            temp_data->AngledHeadersRequests.push_back(request);
-        }
+    const int layout_columns_count = TableGetLayoutColumnsCount(table); // Angled headers are declared columns, which are always laid out
+    for (int layout_n = 0; layout_n < layout_columns_count; layout_n++)
+    {
+        const int order_n = TableGetLayoutColumn(table, layout_n);
+        if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
+            continue;
+        const int column_n = table->DisplayOrderToIndex[order_n];
+        ImGuiTableColumn* column = &table->Columns[column_n];
+        if ((column->Flags & ImGuiTableColumnFlags_AngledHeader) == 0) // Note: can't rely on ImGuiTableColumnFlags_IsVisible test here.
+            continue;
+        ImGuiTableHeaderData request = { (ImGuiTableColumnIdx)column_n, col_text, col_header_bg, (column_n == highlight_column_n) ? GetColorU32(ImGuiCol_Header) : 0 };
+        temp_data->AngledHeadersRequests.push_back(request);
+    }
 
     // Render row
     TableAngledHeadersRowEx(row_id, g.Style.TableAngledHeadersAngle, 0.0f, temp_data->AngledHeadersRequests.Data, temp_data->AngledHeadersRequests.Size);
@@ -3341,11 +3706,14 @@ void ImGui::TableAngledHeadersRowEx(ImGuiID row_id, float angle, float max_label
                     float clip_width = max_label_width - padding.y; // Using padding.y*2.0f would be symmetrical but hide more text.
                     float clip_height = ImMin(label_size.y, column->ClipRect.Max.x - column->WorkMinX - line_off_curr_x);
                     ImRect clip_r(window->ClipRect.Min, window->ClipRect.Min + ImVec2(clip_width, clip_height));
+                    ImDrawListFlags backup_flags = draw_list->Flags;
+                    draw_list->Flags &= ~ImDrawListFlags_QuadInstances; // Vertices are rotated below, quad instances are axis-aligned.
                     int vtx_idx_begin = draw_list->_VtxCurrentIdx;
                     PushStyleColor(ImGuiCol_Text, request->TextColor);
                     RenderTextEllipsis(draw_list, clip_r.Min, clip_r.Max, clip_r.Max.x, clip_r.Max.x, label_name, label_name_eol, &label_size);
                     PopStyleColor();
                     int vtx_idx_end = draw_list->_VtxCurrentIdx;
+                    draw_list->Flags = backup_flags;
 
                     // Up<>Down alignment
                     const float available_space = ImMax(clip_width - label_size.x + ImAbs(padding.x * cos_a) * 2.0f - ImAbs(padding.y * sin_a) * 2.0f, 0.0f);
@@ -3679,6 +4047,7 @@ void ImGui::TableLoadSettings(ImGuiTable* table)
 
     table->SettingsLoadedFlags = settings->SaveFlags;
     table->RefScale = settings->RefScale;
+    table->IsVirtualColumnsDirty = true;
 
     // Serialize ImGuiTableSettings/ImGuiTableColumnSettings into ImGuiTable/ImGuiTableColumn
     ImGuiTableColumnSettings* column_settings = settings->GetColumnSettings();
@@ -3946,6 +4315,8 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
+    if (table->Flags & ImGuiTableFlags_VirtualizeColumns)
+        BulletText("VirtualizeColumns: %d laid out, visible range: %d to %d, default width: %.1f", table->VirtualActiveColumns.Size, table->VirtualColumnsVisibleStart, table->VirtualColumnsVisibleEnd, table->VirtualColumnsDefaultWidth);
     for (int n = 0; n < table->InstanceCurrent + 1; n++)
     {
         ImGuiTableInstanceData* table_instance = TableGetInstanceData(table, n);
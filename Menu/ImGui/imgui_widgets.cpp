@@ -715,6 +715,15 @@ bool ImGui::ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool
 }
 
 bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(window->GetID(label), label, size_arg, flags);
+}
+
+// Same as above with a precomputed ID (e.g. from a ImGuiLabel)
+bool ImGui::ButtonEx(ImGuiID id, const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -722,7 +731,6 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
     const ImVec2 label_size = CalcTextSize(label, NULL, true);
 
     ImVec2 pos = window->DC.CursorPos;
@@ -760,6 +768,14 @@ bool ImGui::Button(const char* label, const ImVec2& size_arg)
     return ButtonEx(label, size_arg, ImGuiButtonFlags_None);
 }
 
+bool ImGui::Button(const ImGuiLabel& label, const ImVec2& size_arg)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(window->GetID(label), label.Text, size_arg, ImGuiButtonFlags_None);
+}
+
 // Small buttons fits within text without additional vertical spacing.
 bool ImGui::SmallButton(const char* label)
 {
@@ -1136,6 +1152,15 @@ bool ImGui::ImageButton(ImTextureID user_texture_id, const ImVec2& size, const I
 #endif // #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 
 bool ImGui::Checkbox(const char* label, bool* v)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return CheckboxEx(window->GetID(label), label, v);
+}
+
+// Same as above with a precomputed ID (e.g. from a ImGuiLabel)
+bool ImGui::CheckboxEx(ImGuiID id, const char* label, bool* v)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -1143,7 +1168,6 @@ bool ImGui::Checkbox(const char* label, bool* v)
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
     const ImVec2 label_size = CalcTextSize(label, NULL, true);
 
     const float square_sz = GetFrameHeight();
@@ -1210,6 +1234,14 @@ bool ImGui::Checkbox(const char* label, bool* v)
     return pressed;
 }
 
+bool ImGui::Checkbox(const ImGuiLabel& label, bool* v)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return CheckboxEx(window->GetID(label), label.Text, v);
+}
+
 template<typename T>
 bool ImGui::CheckboxFlagsT(const char* label, T* flags, T flags_value)
 {
@@ -6309,6 +6341,11 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
 // - GetTreeNodeToLabelSpacing()
 // - SetNextItemOpen()
 // - CollapsingHeader()
+// - ImGuiTreeView
+// - BeginTreeView()
+// - TreeViewNode()
+// - TreeViewNodeV()
+// - EndTreeView()
 //-------------------------------------------------------------------------
 
 bool ImGui::TreeNode(const char* str_id, const char* fmt, ...)
@@ -6338,6 +6375,15 @@ bool ImGui::TreeNode(const char* label)
     return TreeNodeBehavior(id, ImGuiTreeNodeFlags_None, label, NULL);
 }
 
+bool ImGui::TreeNode(const ImGuiLabel& label)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    ImGuiID id = window->GetID(label);
+    return TreeNodeBehavior(id, ImGuiTreeNodeFlags_None, label.Text, NULL);
+}
+
 bool ImGui::TreeNodeV(const char* str_id, const char* fmt, va_list args)
 {
     return TreeNodeExV(str_id, 0, fmt, args);
@@ -6827,6 +6873,15 @@ bool ImGui::CollapsingHeader(const char* label, ImGuiTreeNodeFlags flags)
     return TreeNodeBehavior(id, flags | ImGuiTreeNodeFlags_CollapsingHeader, label);
 }
 
+bool ImGui::CollapsingHeader(const ImGuiLabel& label, ImGuiTreeNodeFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    ImGuiID id = window->GetID(label);
+    return TreeNodeBehavior(id, flags | ImGuiTreeNodeFlags_CollapsingHeader, label.Text);
+}
+
 // p_visible == NULL                        : regular collapsing header
 // p_visible != NULL && *p_visible == true  : show a small close button on the corner of the header, clicking the button will set *p_visible = false
 // p_visible != NULL && *p_visible == false : do not show the header at all
@@ -6864,6 +6919,237 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
     return is_open;
 }
 
+ImGuiTreeView::ImGuiTreeView()
+{
+    UserData = NULL;
+    AdapterGetChildCount = NULL;
+    AdapterGetChild = NULL;
+    AdapterIndexToStorageId = [](ImGuiTreeView*, int idx) { return (ImGuiID)idx; };
+    ID = 0;
+    _NeedRebuild = true;
+}
+
+ImGuiID ImGuiTreeView::GetNodeID(int node_idx)
+{
+    IM_ASSERT(ID != 0);
+    ImGuiID storage_id = AdapterIndexToStorageId(this, node_idx);
+    return ImHashData(&storage_id, sizeof(storage_id), ID);
+}
+
+int ImGuiTreeView::FindParentRow(int row_n) const
+{
+    const int depth = Rows[row_n].Depth;
+    while (--row_n >= 0)
+        if (Rows[row_n].Depth < depth)
+            return row_n;
+    return -1;
+}
+
+// Collect visible descendants of a node into tree->_BuildRows[], in display order.
+// Iterative depth-first walk: the stack holds (node_idx, next child_n, child_count) for each open ancestor.
+static void TreeViewBuildRows(ImGuiTreeView* tree, int parent_node_idx, int parent_depth)
+{
+    ImVector<ImGuiTreeViewRow>& rows = tree->_BuildRows;
+    ImVector<int>& stack = tree->_BuildStack;
+    rows.resize(0);
+    stack.resize(0);
+    stack.push_back(parent_node_idx);
+    stack.push_back(0);
+    stack.push_back(tree->AdapterGetChildCount(tree, parent_node_idx));
+    while (stack.Size > 0)
+    {
+        int* top = &stack.Data[stack.Size - 3];
+        if (top[1] >= top[2])
+        {
+            stack.resize(stack.Size - 3);
+            continue;
+        }
+        const int node_idx = tree->AdapterGetChild(tree, top[0], top[1]++);
+        const int child_count = tree->AdapterGetChildCount(tree, node_idx);
+        ImGuiTreeViewRow row;
+        row.NodeIdx = node_idx;
+        row.Depth = parent_depth + stack.Size / 3;
+        row.IsLeaf = (child_count == 0);
+        row.IsOpen = !row.IsLeaf && ImGui::TreeNodeGetOpen(tree->GetNodeID(node_idx));
+        rows.push_back(row);
+        if (row.IsOpen)
+        {
+            stack.push_back(node_idx);
+            stack.push_back(0);
+            stack.push_back(child_count);
+        }
+    }
+}
+
+static int IMGUI_CDECL TreeViewCompareRowsDesc(const void* lhs, const void* rhs)
+{
+    return *(const int*)rhs - *(const int*)lhs;
+}
+
+// Apply open/close toggles, from last row to first so that indices of pending rows stay valid.
+static void TreeViewApplyToggledRows(ImGuiTreeView* tree)
+{
+    ImVector<int>& toggled_rows = tree->_ToggledRows;
+    if (toggled_rows.Size > 1)
+        ImQsort(toggled_rows.Data, (size_t)toggled_rows.Size, sizeof(int), TreeViewCompareRowsDesc);
+    for (int toggle_n = 0; toggle_n < toggled_rows.Size; toggle_n++)
+    {
+        const int row_n = toggled_rows[toggle_n];
+        if (toggle_n > 0 && toggled_rows[toggle_n - 1] == row_n)
+            continue;
+        ImVector<ImGuiTreeViewRow>& rows = tree->Rows;
+        const ImGuiTreeViewRow row = rows[row_n];
+        if (row.IsOpen)
+        {
+            // Insert visible descendants after the row
+            TreeViewBuildRows(tree, row.NodeIdx, row.Depth);
+            const int insert_count = tree->_BuildRows.Size;
+            const int tail_count = rows.Size - (row_n + 1);
+            rows.resize(rows.Size + insert_count);
+            memmove(rows.Data + row_n + 1 + insert_count, rows.Data + row_n + 1, (size_t)tail_count * sizeof(ImGuiTreeViewRow));
+            memcpy(rows.Data + row_n + 1, tree->_BuildRows.Data, (size_t)insert_count * sizeof(ImGuiTreeViewRow));
+        }
+        else
+        {
+            // Remove descendants, which are all following rows with a greater depth
+            int row_end = row_n + 1;
+            while (row_end < rows.Size && rows[row_end].Depth > row.Depth)
+                row_end++;
+            rows.erase(rows.Data + row_n + 1, rows.Data + row_end);
+        }
+    }
+    toggled_rows.resize(0);
+}
+
+// Write open state to storage, like TreeNodeSetOpen(), and patch Rows[] if the node is visible.
+// Between BeginTreeView()/EndTreeView() the row is queued like a toggle done by TreeViewNode(), otherwise Rows[] is patched immediately.
+void ImGuiTreeView::SetNodeOpen(int node_idx, bool open)
+{
+    ImGuiContext& g = *GImGui;
+    ImGui::TreeNodeSetOpen(GetNodeID(node_idx), open);
+    if (_NeedRebuild)
+        return;
+    for (int row_n = 0; row_n < Rows.Size; row_n++)
+    {
+        ImGuiTreeViewRow* row = &Rows[row_n];
+        if (row->NodeIdx != node_idx)
+            continue;
+        if (row->IsLeaf || row->IsOpen == open)
+            return;
+        row->IsOpen = open;
+
+        // Toggling a row back in the same frame cancels the pending toggle, otherwise its descendants would be inserted twice.
+        int* toggled_row = _ToggledRows.find(row_n);
+        if (toggled_row != _ToggledRows.end())
+            _ToggledRows.erase(toggled_row);
+        else
+            _ToggledRows.push_back(row_n);
+        if (g.CurrentTreeView != this)
+            TreeViewApplyToggledRows(this);
+        return;
+    }
+}
+
+// Rows[] only needs a full rebuild the first time, or when the hierarchy changed (SetDirty()).
+// Afterwards it is patched by EndTreeView() when nodes are opened/closed, so the cost of a frame is proportional to visible rows.
+bool ImGui::BeginTreeView(const char* str_id, ImGuiTreeView* tree)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(g.CurrentTreeView == NULL && "Nesting BeginTreeView() is not supported!");
+    IM_ASSERT(tree->AdapterGetChildCount != NULL && tree->AdapterGetChild != NULL && tree->AdapterIndexToStorageId != NULL);
+    if (window->SkipItems)
+        return false;
+
+    const ImGuiID id = window->GetID(str_id);
+    if (tree->ID != id)
+    {
+        tree->ID = id;
+        tree->_NeedRebuild = true;
+    }
+    if (tree->_NeedRebuild)
+    {
+        TreeViewBuildRows(tree, -1, -1);
+        tree->Rows.swap(tree->_BuildRows);
+        tree->_NeedRebuild = false;
+    }
+    tree->_ToggledRows.resize(0);
+    g.CurrentTreeView = tree;
+    return true;
+}
+
+bool ImGui::TreeViewNode(int row_n, ImGuiTreeNodeFlags flags, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    bool is_open = TreeViewNodeV(row_n, flags, fmt, args);
+    va_end(args);
+    return is_open;
+}
+
+bool ImGui::TreeViewNodeV(int row_n, ImGuiTreeNodeFlags flags, const char* fmt, va_list args)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiTreeView* tree = g.CurrentTreeView;
+    IM_ASSERT(tree != NULL && "Call TreeViewNode() between BeginTreeView() and EndTreeView()!");
+    if (window->SkipItems)
+        return false;
+
+    ImGuiTreeViewRow* row = &tree->Rows[row_n];
+    const ImGuiID id = tree->GetNodeID(row->NodeIdx);
+    const char* label, *label_end;
+    ImFormatStringToTempBufferV(&label, &label_end, fmt, args);
+
+    // Indent by depth instead of relying on TreePush(), as ancestors may have been clipped.
+    flags |= ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    if (row->IsLeaf)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    const float indent_w = row->Depth * g.Style.IndentSpacing;
+    if (indent_w > 0.0f)
+        Indent(indent_w);
+    const float backup_cursor_y = window->DC.CursorPos.y;
+    const bool is_open = TreeNodeBehavior(id, flags, label, label_end);
+    const float row_pitch = window->DC.CursorPos.y - backup_cursor_y;
+    if (indent_w > 0.0f)
+        Unindent(indent_w);
+
+    // Read back stored state rather than 'is_open', which may be temporarily forced (e.g. by logging).
+    const bool is_open_stored = !row->IsLeaf && TreeNodeGetOpen(id);
+    if (is_open_stored != row->IsOpen)
+    {
+        row->IsOpen = is_open_stored;
+        tree->_ToggledRows.push_back(row_n);
+    }
+
+    // Left on a closed node or on a leaf: move to parent row (same as ImGuiTreeNodeFlags_NavLeftJumpsBackHere with regular tree nodes).
+    // The parent may be clipped: its rectangle is extrapolated from this one, which is enough for the navigation system to scroll to it.
+    if (g.NavId == id && g.NavMoveDir == ImGuiDir_Left && g.NavWindow == window && NavMoveRequestButNoResultYet() && row->Depth > 0)
+    {
+        const int parent_row_n = tree->FindParentRow(row_n);
+        const ImGuiTreeViewRow* parent_row = &tree->Rows[parent_row_n];
+        ImGuiTreeNodeStackData parent_data;
+        parent_data.ID = tree->GetNodeID(parent_row->NodeIdx);
+        parent_data.TreeFlags = flags & ~ImGuiTreeNodeFlags_Leaf;
+        parent_data.ItemFlags = g.LastItemData.ItemFlags;
+        parent_data.NavRect = g.LastItemData.NavRect;
+        parent_data.NavRect.Translate(ImVec2(-(row->Depth - parent_row->Depth) * g.Style.IndentSpacing, -(row_n - parent_row_n) * row_pitch));
+        ImGuiLastItemData last_item_backup = g.LastItemData;
+        NavMoveRequestResolveWithPastTreeNode(&g.NavMoveResultLocal, &parent_data);
+        g.LastItemData = last_item_backup;
+    }
+    return is_open;
+}
+
+void ImGui::EndTreeView()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTreeView* tree = g.CurrentTreeView;
+    IM_ASSERT(tree != NULL && "Mismatched BeginTreeView()/EndTreeView() calls!");
+    TreeViewApplyToggledRows(tree);
+    g.CurrentTreeView = NULL;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Selectable
 //-------------------------------------------------------------------------
@@ -6875,6 +7161,15 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
 // With this scheme, ImGuiSelectableFlags_SpanAllColumns and ImGuiSelectableFlags_AllowOverlap are also frequently used flags.
 // FIXME: Selectable() with (size.x == 0.0f) and (SelectableTextAlign.x > 0.0f) followed by SameLine() is currently not supported.
 bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return SelectableEx(window->GetID(label), label, selected, flags, size_arg);
+}
+
+// Same as above with a precomputed ID (e.g. from a ImGuiLabel)
+bool ImGui::SelectableEx(ImGuiID id, const char* label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -6884,7 +7179,6 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     const ImGuiStyle& style = g.Style;
 
     // Submit label or explicit size to ItemSize(), whereas ItemAdd() will submit a larger/spanning rectangle.
-    ImGuiID id = window->GetID(label);
     ImVec2 label_size = CalcTextSize(label, NULL, true);
     ImVec2 size(size_arg.x != 0.0f ? size_arg.x : label_size.x, size_arg.y != 0.0f ? size_arg.y : label_size.y);
     ImVec2 pos = window->DC.CursorPos;
@@ -7058,6 +7352,14 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     return pressed; //-V1020
 }
 
+bool ImGui::Selectable(const ImGuiLabel& label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return SelectableEx(window->GetID(label), label.Text, selected, flags, size_arg);
+}
+
 bool ImGui::Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags flags, const ImVec2& size_arg)
 {
     if (Selectable(label, *p_selected, flags, size_arg))
@@ -8000,6 +8302,7 @@ void ImGui::DebugNodeMultiSelectState(ImGuiMultiSelectState* storage)
 //-------------------------------------------------------------------------
 // - ImGuiSelectionBasicStorage
 // - ImGuiSelectionExternalStorage
+// - ImGuiSelectionRangeStorage
 //-------------------------------------------------------------------------
 
 ImGuiSelectionBasicStorage::ImGuiSelectionBasicStorage()
@@ -8187,6 +8490,174 @@ void ImGuiSelectionExternalStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
     }
 }
 
+//-------------------------------------------------------------------------
+
+ImGuiSelectionRangeStorage::ImGuiSelectionRangeStorage()
+{
+    Size = 0;
+    _IterBoundsHint = 0;
+}
+
+// Return number of boundaries <= idx. An item is selected when this is odd.
+static int ImGuiSelectionRangeStorage_CountBounds(const ImVector<int>& bounds, int idx)
+{
+    int count = 0;
+    int len = bounds.Size;
+    while (len > 0)
+    {
+        const int half = len >> 1;
+        if (bounds.Data[count + half] <= idx)
+        {
+            count += half + 1;
+            len -= half + 1;
+        }
+        else
+        {
+            len = half;
+        }
+    }
+    return count;
+}
+
+// Replace _Bounds[lo..hi) with 'new_count' values
+static void ImGuiSelectionRangeStorage_ReplaceBounds(ImVector<int>& bounds, int lo, int hi, const int* new_bounds, int new_count)
+{
+    const int old_count = hi - lo;
+    const int tail_count = bounds.Size - hi;
+    if (new_count > old_count)
+        bounds.resize(bounds.Size + new_count - old_count);
+    if (new_count != old_count)
+        memmove(bounds.Data + lo + new_count, bounds.Data + hi, (size_t)tail_count * sizeof(int));
+    if (new_count < old_count)
+        bounds.resize(bounds.Size - (old_count - new_count));
+    if (new_count > 0)
+        memcpy(bounds.Data + lo, new_bounds, (size_t)new_count * sizeof(int));
+}
+
+// Apply requests coming from BeginMultiSelect() and EndMultiSelect().
+// Unlike ImGuiSelectionBasicStorage, SetAll and large SetRange requests don't need to iterate items.
+void ImGuiSelectionRangeStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
+{
+    IM_ASSERT(ms_io->ItemsCount != -1 && "Missing value for items_count in BeginMultiSelect() call!");
+    for (ImGuiSelectionRequest& req : ms_io->Requests)
+    {
+        if (req.Type == ImGuiSelectionRequestType_SetAll)
+        {
+            Clear();
+            if (req.Selected && ms_io->ItemsCount > 0)
+                SetRangeSelected(0, ms_io->ItemsCount - 1, true);
+        }
+        else if (req.Type == ImGuiSelectionRequestType_SetRange)
+        {
+            SetRangeSelected((int)req.RangeFirstItem, (int)req.RangeLastItem, req.Selected);
+        }
+    }
+}
+
+bool ImGuiSelectionRangeStorage::Contains(int idx) const
+{
+    return (ImGuiSelectionRangeStorage_CountBounds(_Bounds, idx) & 1) != 0;
+}
+
+void ImGuiSelectionRangeStorage::Clear()
+{
+    Size = 0;
+    _IterBoundsHint = 0;
+    _Bounds.resize(0);
+}
+
+void ImGuiSelectionRangeStorage::Swap(ImGuiSelectionRangeStorage& r)
+{
+    ImSwap(Size, r.Size);
+    ImSwap(_IterBoundsHint, r._IterBoundsHint);
+    _Bounds.swap(r._Bounds);
+}
+
+void ImGuiSelectionRangeStorage::SetRangeSelected(int idx_first, int idx_last, bool selected)
+{
+    IM_ASSERT(idx_first >= 0 && idx_first <= idx_last && idx_last < INT_MAX);
+    const int range_min = idx_first;
+    const int range_max = idx_last + 1;
+
+    // Boundaries in [lo, hi) are within the range and get removed. Parity of 'lo' and 'hi' tells if items before and after the range are selected.
+    const int lo = ImGuiSelectionRangeStorage_CountBounds(_Bounds, range_min - 1);
+    const int hi = ImGuiSelectionRangeStorage_CountBounds(_Bounds, range_max);
+
+    // Count items of the range which were already selected, to maintain Size
+    int prev_selected_count = 0;
+    int pos = range_min;
+    bool pos_selected = (lo & 1) != 0;
+    for (int n = lo; n < hi; n++, pos_selected = !pos_selected)
+    {
+        if (pos_selected)
+            prev_selected_count += _Bounds.Data[n] - pos;
+        pos = _Bounds.Data[n];
+    }
+    if (pos_selected)
+        prev_selected_count += range_max - pos;
+
+    // Add boundaries where selection state changes, merging with neighbor ranges otherwise
+    int new_bounds[2];
+    int new_count = 0;
+    if (((lo & 1) != 0) != selected)
+        new_bounds[new_count++] = range_min;
+    if (((hi & 1) != 0) != selected)
+        new_bounds[new_count++] = range_max;
+    ImGuiSelectionRangeStorage_ReplaceBounds(_Bounds, lo, hi, new_bounds, new_count);
+    Size += selected ? (range_max - range_min) - prev_selected_count : -prev_selected_count;
+}
+
+// Inverting a selection only toggles boundaries at 0 and 'items_count', regardless of the number of selected items.
+void ImGuiSelectionRangeStorage::InvertAll(int items_count)
+{
+    IM_ASSERT(_Bounds.Size == 0 || _Bounds.back() <= items_count);
+    if (items_count <= 0)
+        return;
+    const int toggle_bounds[2] = { items_count, 0 }; // Last one first so index of first one stays valid
+    for (int bound : toggle_bounds)
+    {
+        const int n = ImGuiSelectionRangeStorage_CountBounds(_Bounds, bound - 1);
+        if (n < _Bounds.Size && _Bounds.Data[n] == bound)
+            ImGuiSelectionRangeStorage_ReplaceBounds(_Bounds, n, n + 1, NULL, 0);
+        else
+            ImGuiSelectionRangeStorage_ReplaceBounds(_Bounds, n, n, &bound, 1);
+    }
+    Size = items_count - Size;
+}
+
+// The iterator stores the next index to consider, so a NULL iterator starts at index 0.
+// _IterBoundsHint is verified before use: when iterating, it avoids searching for the range of each item.
+bool ImGuiSelectionRangeStorage::GetNextSelectedItem(void** opaque_it, int* out_idx)
+{
+    int idx = (int)(intptr_t)*opaque_it;
+    int n = _IterBoundsHint;
+    if (n <= 0 || n > _Bounds.Size || _Bounds.Data[n - 1] > idx || (n < _Bounds.Size && _Bounds.Data[n] <= idx))
+        n = ImGuiSelectionRangeStorage_CountBounds(_Bounds, idx);
+    if ((n & 1) == 0)
+    {
+        // Not in a range: jump to start of next range
+        if (n >= _Bounds.Size)
+            return false;
+        idx = _Bounds.Data[n++];
+    }
+    _IterBoundsHint = n;
+    *out_idx = idx;
+    *opaque_it = (void*)(intptr_t)(idx + 1);
+    return true;
+}
+
+// The iterator stores the next range number.
+bool ImGuiSelectionRangeStorage::GetNextSelectedRange(void** opaque_it, int* out_first, int* out_last)
+{
+    const int range_n = (int)(intptr_t)*opaque_it;
+    if (range_n * 2 >= _Bounds.Size)
+        return false;
+    *out_first = _Bounds.Data[range_n * 2];
+    *out_last = _Bounds.Data[range_n * 2 + 1] - 1;
+    *opaque_it = (void*)(intptr_t)(range_n + 1);
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ListBox
 //-------------------------------------------------------------------------
@@ -0,0 +1,25 @@
+#!/bin/bash
+## Build and run the standalone tests and benchmarks in this directory against the Dear ImGui sources in '..'.
+## Usage: ./run_tests.sh [test_name...]     (e.g. ./run_tests.sh test_upload_arena, default: all tests)
+## CXX and CXXFLAGS can be overridden, e.g. CXXFLAGS="-O1 -g -fsanitize=address,undefined" ./run_tests.sh
+set -e
+cd "$(dirname "$0")"
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-O2"}
+OUT=${OUT:-build}
+mkdir -p "$OUT"
+SOURCES="../imgui.cpp ../imgui_draw.cpp ../imgui_widgets.cpp ../imgui_tables.cpp ../imgui_demo.cpp"
+if [ ! -f "$OUT/libimgui.a" ] || [ -n "$(find .. -maxdepth 1 -name 'imgui*' -newer "$OUT/libimgui.a")" ]; then
+    for src in $SOURCES; do
+        $CXX -std=c++11 $CXXFLAGS -I.. -c "$src" -o "$OUT/$(basename "$src" .cpp).o"
+    done
+    rm -f "$OUT/libimgui.a"
+    ar rcs "$OUT/libimgui.a" "$OUT"/imgui*.o
+fi
+TESTS=${@:-$(ls *.cpp | sed 's/\.cpp$//')}
+FAILED=0
+for test in $TESTS; do
+    $CXX -std=c++11 $CXXFLAGS -I.. "$test.cpp" "$OUT/libimgui.a" -o "$OUT/$test"
+    "./$OUT/$test" || FAILED=$((FAILED + 1))
+done
+[ $FAILED -eq 0 ] || { echo "$FAILED test(s) failed"; exit 1; }
@@ -0,0 +1,161 @@
+// Dear ImGui: AddLines()/AddRectsFilled()/AddCirclesFilled() equivalence test (see tests/run_tests.sh)
+// - Lines and rectangles must produce the same vertices and indices as AddLine()/AddRectFilled() called for each item.
+// - Circles of the same radius must produce the same indices and vertex count as AddCircleFilled(), with positions within 0.002 pixels.
+// - Culled lines must be fully outside of the clip rectangle, anti-aliasing fringe included.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+static int g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+static const ImVec4 CLIP_RECT(0.0f, 0.0f, 1280.0f, 720.0f);
+
+static ImDrawList* NewDrawList(ImDrawListFlags flags)
+{
+    ImDrawList* draw_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+    draw_list->_ResetForNewFrame();
+    draw_list->Flags = flags;
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->PushClipRect(ImVec2(CLIP_RECT.x, CLIP_RECT.y), ImVec2(CLIP_RECT.z, CLIP_RECT.w));
+    return draw_list;
+}
+
+// Return max position difference, or -1.0f if anything else differs
+static float CompareDrawLists(const ImDrawList* a, const ImDrawList* b)
+{
+    if (a->IdxBuffer.Size != b->IdxBuffer.Size || a->VtxBuffer.Size != b->VtxBuffer.Size || a->QuadBuffer.Size != b->QuadBuffer.Size)
+        return -1.0f;
+    if (a->IdxBuffer.Size > 0 && memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.size_in_bytes()) != 0)
+        return -1.0f;
+    if (a->QuadBuffer.Size > 0 && memcmp(a->QuadBuffer.Data, b->QuadBuffer.Data, (size_t)a->QuadBuffer.size_in_bytes()) != 0)
+        return -1.0f;
+    float diff_max = 0.0f;
+    for (int n = 0; n < a->VtxBuffer.Size; n++)
+    {
+        const ImDrawVert& va = a->VtxBuffer[n];
+        const ImDrawVert& vb = b->VtxBuffer[n];
+        if (va.col != vb.col || va.uv.x != vb.uv.x || va.uv.y != vb.uv.y)
+            return -1.0f;
+        diff_max = ImMax(diff_max, ImMax(ImFabs(va.pos.x - vb.pos.x), ImFabs(va.pos.y - vb.pos.y)));
+    }
+    return diff_max;
+}
+
+static float RandomFloat(float min, float max) { return min + (max - min) * (rand() / (float)RAND_MAX); }
+
+int main()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 720);
+    unsigned char* pixels; int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &tex_w, &tex_h);
+    ImGui::NewFrame();
+
+    const int N = 5000;
+    srand(1234);
+    std::vector<ImVec2> points(N * 2), sizes(N);
+    std::vector<ImU32> cols(N);
+    for (int n = 0; n < N; n++)
+    {
+        points[n * 2] = ImVec2(RandomFloat(-100, 1380), RandomFloat(-100, 820));
+        points[n * 2 + 1] = ImVec2(points[n * 2].x + RandomFloat(-50, 50), points[n * 2].y + RandomFloat(-50, 50));
+        sizes[n] = ImVec2(RandomFloat(0, 40), RandomFloat(0, 40));
+        cols[n] = IM_COL32(rand() & 255, rand() & 255, rand() & 255, (n % 13 == 0) ? 0 : (rand() & 255));
+    }
+    points[2] = points[3]; // Zero-length line
+
+    const ImDrawListFlags flags_variants[] =
+    {
+        0,
+        ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill,
+        ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill,
+    };
+    const float thicknesses[] = { 0.5f, 1.0f, 2.0f, 3.5f, 4.0f };
+    int compared_count = 0;
+    float circles_diff_max = 0.0f;
+    for (ImDrawListFlags flags : flags_variants)
+    {
+        flags |= ImDrawListFlags_AllowVtxOffset;
+
+        // Lines: exact
+        for (float thickness : thicknesses)
+        {
+            ImDrawList* bulk = NewDrawList(flags);
+            ImDrawList* single = NewDrawList(flags);
+            bulk->AddLines(points.data(), N, 0, thickness, cols.data());
+            for (int n = 0; n < N; n++)
+                single->AddLine(points[n * 2], points[n * 2 + 1], cols[n], thickness);
+            CHECK(CompareDrawLists(bulk, single) == 0.0f);
+            IM_DELETE(bulk);
+            IM_DELETE(single);
+            compared_count++;
+        }
+
+        // Lines: culling is conservative
+        for (float thickness : thicknesses)
+        {
+            ImDrawList* draw_list = NewDrawList(flags);
+            for (int n = 0; n < N; n++)
+            {
+                if ((cols[n] & IM_COL32_A_MASK) == 0)
+                    continue;
+                draw_list->VtxBuffer.resize(0);
+                draw_list->IdxBuffer.resize(0);
+                draw_list->_VtxWritePtr = draw_list->VtxBuffer.Data;
+                draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data;
+                draw_list->_VtxCurrentIdx = 0;
+                const int culled_count = draw_list->_CulledCount;
+                draw_list->AddLines(&points[n * 2], 1, cols[n], thickness, NULL, ImDrawFlags_CullItems);
+                if (draw_list->_CulledCount == culled_count)
+                    continue;
+                draw_list->AddLine(points[n * 2], points[n * 2 + 1], cols[n], thickness);
+                for (const ImDrawVert& v : draw_list->VtxBuffer)
+                    CHECK(v.pos.x < CLIP_RECT.x || v.pos.y < CLIP_RECT.y || v.pos.x > CLIP_RECT.z || v.pos.y > CLIP_RECT.w || v.col != cols[n]);
+            }
+            IM_DELETE(draw_list);
+        }
+
+        // Rectangles: exact
+        {
+            ImDrawList* bulk = NewDrawList(flags);
+            ImDrawList* single = NewDrawList(flags);
+            bulk->AddRectsFilled(points.data(), N, ImVec2(0, 0), 0, sizes.data(), cols.data());
+            for (int n = 0; n < N; n++)
+                single->AddRectFilled(points[n], ImVec2(points[n].x + sizes[n].x, points[n].y + sizes[n].y), cols[n]);
+            CHECK(CompareDrawLists(bulk, single) == 0.0f);
+            IM_DELETE(bulk);
+            IM_DELETE(single);
+            compared_count++;
+        }
+
+        // Circles of the same radius: same tessellation, fringe within 0.002 pixels
+        const float radii[] = { 3.0f, 12.0f, 90.0f };
+        for (float radius : radii)
+        {
+            ImDrawList* bulk = NewDrawList(flags);
+            ImDrawList* single = NewDrawList(flags);
+            bulk->AddCirclesFilled(points.data(), N, radius, 0, NULL, cols.data());
+            for (int n = 0; n < N; n++)
+                single->AddCircleFilled(points[n], radius, cols[n]);
+            const float diff = CompareDrawLists(bulk, single);
+            CHECK(diff >= 0.0f && diff <= 0.002f);
+            circles_diff_max = ImMax(circles_diff_max, diff);
+            IM_DELETE(bulk);
+            IM_DELETE(single);
+            compared_count++;
+        }
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    printf("test_bulk_primitives: %d batches of %d items, lines and rects exact, circles max diff %.5f px: %s\n", compared_count, N, circles_diff_max, g_Fails ? "FAILED" : "OK");
+    return g_Fails ? 1 : 0;
+}
@@ -0,0 +1,258 @@
+// Dear ImGui: AddConcavePolyFilled() triangulation test and benchmark (see tests/run_tests.sh)
+// - Stars, random outlines, spirals, combs, zigzags and grids with collinear points, rotated, with 4 to 1000 points (ear clipping below
+//   IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS, monotone decomposition above): output must be N-2 triangles covering the polygon area exactly once,
+//   with each polygon edge used by one triangle and each diagonal by two.
+// - Above the threshold the same shapes are also checked with counter-clockwise winding, which ear clipping does not support: this checks the
+//   monotone path is actually used, rather than its ear clipping fallback.
+// - Self-intersecting, coincident and collinear points must still output N-2 triangles with valid indices.
+// - Benchmark: anti-aliased fill of star, outline and spiral shapes. Timings are printed, not checked.
+//   Compare with ear clipping: OUT=build_ear CXXFLAGS="-O2 -DIM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS=1000000" ./run_tests.sh test_concave_fill
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <vector>
+
+static int g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+typedef std::vector<ImVec2> Polygon;
+
+static double GetTime() { return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+static unsigned int g_RandomState = 12345;
+static float RandomFloat() { g_RandomState = g_RandomState * 1664525u + 1013904223u; return (g_RandomState >> 8) / 16777216.0f; }
+
+// Shapes, all clockwise in screen space (y down)
+static Polygon MakeStar(int count, float r0, float r1)
+{
+    Polygon p;
+    for (int n = 0; n < count; n++)
+    {
+        const float a = n * IM_PI * 2.0f / count, r = (n & 1) ? r0 : r1;
+        p.push_back(ImVec2(500.0f + cosf(a) * r, 500.0f + sinf(a) * r));
+    }
+    return p;
+}
+
+static Polygon MakeOutline(int count)
+{
+    Polygon p;
+    for (int n = 0; n < count; n++)
+    {
+        const float a = n * IM_PI * 2.0f / count, r = 100.0f + RandomFloat() * 300.0f;
+        p.push_back(ImVec2(500.0f + cosf(a) * r, 500.0f + sinf(a) * r));
+    }
+    return p;
+}
+
+static Polygon MakeSpiral(int count) // Fewer turns for low point counts, so it is not self-intersecting
+{
+    Polygon p;
+    const int half = count / 2;
+    const float t_max = ImMin(count * 0.15f, 18.0f);
+    for (int n = 0; n < half; n++)
+    {
+        const float t = n / (float)half * t_max;
+        p.push_back(ImVec2(500.0f + cosf(t) * (32.0f + t * 20.0f), 500.0f + sinf(t) * (32.0f + t * 20.0f)));
+    }
+    for (int n = half - 1; n >= 0; n--)
+    {
+        const float t = n / (float)half * t_max;
+        p.push_back(ImVec2(500.0f + cosf(t) * (20.0f + t * 20.0f), 500.0f + sinf(t) * (20.0f + t * 20.0f)));
+    }
+    return p;
+}
+
+static Polygon MakeComb(int count)
+{
+    Polygon p;
+    const int teeth = (count - 2) / 4;
+    for (int n = 0; n < teeth; n++)
+    {
+        const float x = n * 10.0f;
+        p.push_back(ImVec2(x, 0.0f));
+        p.push_back(ImVec2(x + 5.0f, 0.0f));
+        p.push_back(ImVec2(x + 5.0f, 100.0f));
+        p.push_back(ImVec2(x + 10.0f, 100.0f));
+    }
+    p.push_back(ImVec2(teeth * 10.0f, 200.0f));
+    p.push_back(ImVec2(0.0f, 200.0f));
+    return p;
+}
+
+static Polygon MakeZigzag(int count)
+{
+    Polygon p;
+    const int half = count / 2;
+    for (int n = 0; n < half; n++)
+        p.push_back(ImVec2(n * 4.0f, (n & 1) ? 10.0f : 0.0f));
+    for (int n = half - 1; n >= 0; n--)
+        p.push_back(ImVec2(n * 4.0f, (n & 1) ? 30.0f : 40.0f));
+    return p;
+}
+
+static Polygon MakeGrid(int count) // Square with collinear points on each side
+{
+    Polygon p;
+    const int k = count / 4;
+    for (int n = 0; n < k; n++) p.push_back(ImVec2((float)n, 0.0f));
+    for (int n = 0; n < k; n++) p.push_back(ImVec2((float)k, (float)n));
+    for (int n = 0; n < k; n++) p.push_back(ImVec2((float)(k - n), (float)k));
+    for (int n = 0; n < k; n++) p.push_back(ImVec2(0.0f, (float)(k - n)));
+    return p;
+}
+
+static Polygon Rotate(Polygon p, float angle)
+{
+    for (ImVec2& v : p)
+        v = ImVec2(v.x * cosf(angle) - v.y * sinf(angle), v.x * sinf(angle) + v.y * cosf(angle));
+    return p;
+}
+
+static Polygon Reverse(Polygon p)
+{
+    std::reverse(p.begin(), p.end());
+    return p;
+}
+
+static double TriangleArea(const ImVec2& a, const ImVec2& b, const ImVec2& c) { return 0.5 * ((double)(b.x - a.x) * (c.y - a.y) - (double)(b.y - a.y) * (c.x - a.x)); }
+
+static ImDrawList* FillPolygon(ImDrawList* draw_list, const Polygon& p, ImDrawListFlags flags)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRect(ImVec2(-100000.0f, -100000.0f), ImVec2(100000.0f, 100000.0f));
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->Flags = flags | ImDrawListFlags_AllowVtxOffset;
+    draw_list->AddConcavePolyFilled(p.data(), (int)p.size(), IM_COL32_WHITE);
+    return draw_list;
+}
+
+// Without anti-aliasing, vertex n is point n
+static bool IsValidTriangulation(ImDrawList* draw_list, const Polygon& p)
+{
+    FillPolygon(draw_list, p, ImDrawListFlags_None);
+    const int count = (int)p.size();
+    if (draw_list->IdxBuffer.Size != (count - 2) * 3)
+        return false;
+    double polygon_area = 0.0, triangles_area = 0.0;
+    for (int n = 0; n < count; n++)
+        polygon_area += TriangleArea(ImVec2(0, 0), p[n], p[(n + 1) % count]);
+    std::map<std::pair<int, int>, int> edges;
+    for (int n = 0; n < draw_list->IdxBuffer.Size; n += 3)
+    {
+        const int v[3] = { draw_list->IdxBuffer[n], draw_list->IdxBuffer[n + 1], draw_list->IdxBuffer[n + 2] };
+        triangles_area += fabs(TriangleArea(p[v[0]], p[v[1]], p[v[2]]));
+        for (int k = 0; k < 3; k++)
+            edges[std::make_pair(ImMin(v[k], v[(k + 1) % 3]), ImMax(v[k], v[(k + 1) % 3]))]++;
+    }
+    if (fabs(triangles_area - fabs(polygon_area)) > 1e-4 * fabs(polygon_area) + 1e-3)
+        return false;
+    for (const auto& edge : edges)
+    {
+        const bool is_polygon_edge = (edge.first.second - edge.first.first == 1) || (edge.first.first == 0 && edge.first.second == count - 1);
+        if (edge.second != (is_polygon_edge ? 1 : 2))
+            return false;
+    }
+    return true;
+}
+
+static void TestTriangulation(ImDrawList* draw_list)
+{
+    int polygons_count = 0;
+    for (int count = 4; count < 1000; count += (count < 80) ? 1 : 37)
+        for (int rotation = 0; rotation < 4; rotation++)
+        {
+            const float angle = rotation * 0.4f;
+            Polygon shapes[] =
+            {
+                Rotate(MakeStar(count & ~1, 50.0f, 300.0f), angle),
+                Rotate(MakeOutline(count), angle),
+                Rotate(MakeSpiral(count), angle),
+                Rotate(MakeZigzag(count & ~1), rotation * IM_PI * 0.5f),
+                (count >= 10) ? Rotate(MakeComb(count), rotation * IM_PI * 0.5f) : Polygon(),
+                (count >= 8) ? Rotate(MakeGrid(count), rotation * IM_PI * 0.5f) : Polygon(),
+                MakeStar(count, 200.0f, 200.0f),
+            };
+            for (const Polygon& shape : shapes)
+            {
+                if (shape.size() < 3)
+                    continue;
+                CHECK(IsValidTriangulation(draw_list, shape));
+                if ((int)shape.size() >= IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS)
+                    CHECK(IsValidTriangulation(draw_list, Reverse(shape)));
+                polygons_count++;
+            }
+        }
+
+    // Invalid polygons: the triangulation is undefined, but must have the expected size and valid indices
+    int invalid_count = 0;
+    for (int count = 3; count < 300; count += 13)
+    {
+        Polygon random_points, same_point(count, ImVec2(5.0f, 5.0f)), line;
+        for (int n = 0; n < count; n++)
+        {
+            random_points.push_back(ImVec2(RandomFloat() * 100.0f, RandomFloat() * 100.0f));
+            line.push_back(ImVec2((float)n, (float)n));
+        }
+        for (const Polygon* shape : { &random_points, &same_point, &line })
+        {
+            FillPolygon(draw_list, *shape, ImDrawListFlags_None);
+            CHECK(draw_list->IdxBuffer.Size == (count - 2) * 3);
+            for (const ImDrawIdx idx : draw_list->IdxBuffer)
+                CHECK((int)idx < count);
+            invalid_count++;
+        }
+    }
+    printf("test_concave_fill: %d polygons checked (monotone from %d points), %d invalid polygons\n", polygons_count, IM_DRAWLIST_CONCAVE_MONOTONE_MIN_POINTS, invalid_count);
+}
+
+static void Benchmark(ImDrawList* draw_list)
+{
+    const int counts[] = { 16, 32, 48, 64, 128, 256, 1024, 4096 };
+    for (int count : counts)
+    {
+        const Polygon shapes[] = { MakeStar(count, 50.0f, 300.0f), MakeOutline(count), MakeSpiral(count) };
+        double us[IM_ARRAYSIZE(shapes)];
+        for (int shape_n = 0; shape_n < IM_ARRAYSIZE(shapes); shape_n++)
+        {
+            const int iterations = ImMax(10, 100000 / count);
+            double best = 1e9;
+            for (int rep = 0; rep < 5; rep++) // Best of 5 runs
+            {
+                const double t0 = GetTime();
+                for (int n = 0; n < iterations; n++)
+                    FillPolygon(draw_list, shapes[shape_n], ImDrawListFlags_AntiAliasedFill);
+                best = ImMin(best, (GetTime() - t0) / iterations);
+            }
+            us[shape_n] = best * 1e6;
+        }
+        printf("test_concave_fill: %4d points, AA fill: star %9.2f us, outline %9.2f us, spiral %9.2f us\n", count, us[0], us[1], us[2]);
+    }
+}
+
+int main()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 720);
+    unsigned char* pixels; int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &tex_w, &tex_h);
+    ImGui::NewFrame();
+    ImDrawList* draw_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+
+    TestTriangulation(draw_list);
+    Benchmark(draw_list);
+
+    IM_DELETE(draw_list);
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    printf("test_concave_fill: %s\n", g_Fails ? "FAILED" : "OK");
+    return g_Fails ? 1 : 0;
+}
@@ -0,0 +1,172 @@
+// Dear ImGui: ImFormatString() fast path test and benchmark (see tests/run_tests.sh)
+// - ImFormatString() must output the same text and return value as vsnprintf() for random %d %i %u %x %X %c %s %f %F %g %G specifiers with
+//   random flags, widths and precisions: random doubles, exact ties, float values, values near powers of 10, subnormals, 32/64-bit integers,
+//   plus truncating buffer sizes and buf == NULL. Unsupported specifiers are forwarded to vsnprintf() and are not checked here.
+//   The reference is the C library vsnprintf(), which must round exactly (e.g. glibc).
+// - Benchmark: common formats, vsnprintf() vs ImFormatString(). Timings are printed, not checked.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+
+static int g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+static double GetTime() { return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+static unsigned long long g_RandomState = 88172645463325252ull;
+static unsigned int Random() { g_RandomState ^= g_RandomState << 13; g_RandomState ^= g_RandomState >> 7; g_RandomState ^= g_RandomState << 17; return (unsigned int)g_RandomState; }
+
+static double RandomDouble()
+{
+    switch (Random() % 8)
+    {
+    case 0: { unsigned long long bits = ((unsigned long long)Random() << 32) | Random(); double d; memcpy(&d, &bits, sizeof(d)); return d; } // Any bits, including inf/nan
+    case 1: return (double)(int)Random() / (1 << (Random() % 20));                          // Dyadic: exact ties
+    case 2: return (double)(float)((Random() % 2000000) / 1000.0 - 1000.0);                 // Float values, as from DragFloat()
+    case 3: return (Random() % 100000) * pow(10.0, (int)(Random() % 24) - 12);
+    case 4: return ldexp((double)Random(), (int)(Random() % 140) - 100);
+    case 5: return ((Random() % 2) ? -1.0 : 1.0) * (double)(Random() % 1000) + 0.5;          // x.5 ties
+    case 6: return pow(10.0, (int)(Random() % 12) - 5) * (1.0 - ldexp(1.0, -(int)(Random() % 40))); // Near powers of 10
+    default: return (double)Random() * 1e-3;
+    }
+}
+
+static std::string RandomSpec(const char* length_modifier, char conversion)
+{
+    std::string spec = "%";
+    for (int n = Random() % 3; n > 0; n--)
+        spec += "-0+ "[Random() % 4];
+    if (Random() % 3 == 0)
+        spec += std::to_string(Random() % 25);
+    if (Random() % 2 == 0)
+    {
+        spec += ".";
+        if (Random() % 4 != 0)
+            spec += std::to_string(Random() % 20);
+    }
+    return spec + length_modifier + conversion;
+}
+
+// Same semantic as ImFormatString(): always zero-terminated, returns the number of characters written (or needed, when buf is NULL)
+static int RefFormatString(char* buf, size_t buf_size, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int w = vsnprintf(buf, buf_size, fmt, args);
+    va_end(args);
+    if (buf == NULL)
+        return w;
+    if (w == -1 || w >= (int)buf_size)
+        w = (int)buf_size - 1;
+    buf[w] = 0;
+    return w;
+}
+
+// Compare ImFormatString() and RefFormatString() on a given format and argument, with a buffer of 'buf_size' bytes (NULL when 0)
+template<typename T>
+static bool CompareFormat(size_t buf_size, const std::string& fmt, T value)
+{
+    char out_ref[512], out[512];
+    memset(out_ref, 0x55, sizeof(out_ref));
+    memset(out, 0x55, sizeof(out));
+    const int w_ref = RefFormatString(buf_size ? out_ref : NULL, buf_size, fmt.c_str(), value);
+    const int w = ImFormatString(buf_size ? out : NULL, buf_size, fmt.c_str(), value);
+    if (w == w_ref && memcmp(out_ref, out, sizeof(out)) == 0)
+        return true;
+    printf("test_format_string: '%s' with buffer size %d: '%s' (%d) expected '%s' (%d)\n", fmt.c_str(), (int)buf_size, buf_size ? out : "", w, buf_size ? out_ref : "", w_ref);
+    return false;
+}
+
+static void TestRandomSpecs()
+{
+    const int iterations = 500000;
+    const char* strings[] = { "", "a", "Hello world", "0123456789012345678901234567890" };
+    int mismatches = 0;
+    for (int n = 0; n < iterations && mismatches < 20; n++)
+    {
+        const size_t buf_size = (Random() % 4 == 0) ? Random() % 12 : 512; // Including 0: buf == NULL
+        const char conversions[] = "fFgGdiuxXsc";
+        const char conversion = conversions[Random() % (sizeof(conversions) - 1)];
+        const bool is_long_long = (strchr("diuxX", conversion) != NULL) && (Random() % 2 == 0);
+        const std::string fmt = "v=" + RandomSpec(is_long_long ? "ll" : "", conversion) + ((Random() % 2) ? " | %%" : "");
+        bool ok;
+        if (strchr("fFgG", conversion))
+            ok = CompareFormat(buf_size, fmt, RandomDouble());
+        else if (conversion == 's')
+            ok = CompareFormat(buf_size, fmt, strings[Random() % IM_ARRAYSIZE(strings)]);
+        else if (conversion == 'c')
+            ok = CompareFormat(buf_size, fmt, (int)('A' + Random() % 26));
+        else if (is_long_long)
+            ok = CompareFormat(buf_size, fmt, (long long)(((unsigned long long)Random() << 32) | Random()) >> (Random() % 64));
+        else
+            ok = CompareFormat(buf_size, fmt, (Random() % 8 == 0) ? 0 : (int)Random() >> (Random() % 32));
+        if (!ok)
+            mismatches++;
+    }
+    CHECK(mismatches == 0);
+    printf("test_format_string: %d random specifiers compared with vsnprintf()\n", iterations);
+}
+
+static void TestFixedCases()
+{
+    const char* fmts[] = { "%.3f", "%.0f", "%g", "%.2f", "%f", "%.1f", "%8.2f", "%-8.2f|", "%+.3f", "% .3f", "%08.3f", "%.9g", "%G", "%.3g" };
+    const double values[] = { 0.0, -0.0, 0.5, 1.5, 2.5, 0.125, 0.375, -0.0004, 1e-300, 5e-324, 1e15, 1.8e19, 1e20, 1e300, 123456.789, 0.1, 0.7f, 99999.95, 1e-5, 0.0001, 9.9999996 };
+    for (const char* fmt : fmts)
+        for (double value : values)
+            CHECK(CompareFormat(512, fmt, value));
+    CHECK(CompareFormat(512, "%s", (const char*)"Text")); // Used by Text() family
+    CHECK(CompareFormat(512, "%d%%", 42));
+
+    // Width and precision from arguments
+    char out_ref[64], out[64];
+    const int w_ref = RefFormatString(out_ref, sizeof(out_ref), "%*.*f|%-*d|", 9, 2, 3.14159, 5, -12);
+    CHECK(ImFormatString(out, sizeof(out), "%*.*f|%-*d|", 9, 2, 3.14159, 5, -12) == w_ref && strcmp(out, out_ref) == 0);
+}
+
+static void Benchmark()
+{
+    const int iterations = 1000000;
+    const char* fmts[] = { "%d", "%.3f", "%g", "label %s: %5.1f%%", "%08X", "%lld" };
+    for (const char* fmt : fmts)
+    {
+        double ns[2];
+        for (int impl = 0; impl < 2; impl++)
+        {
+            char out[64];
+            volatile int sink = 0;
+            const double t0 = GetTime();
+            for (int n = 0; n < iterations; n++)
+            {
+                const double d = (n & 1023) * 0.37 - 50.0;
+                const int i = (int)((n * 2654435761u) >> 8);
+                const long long ll = (long long)i * 1000003;
+                if (fmt[1] == 'd' || fmt[1] == '0')
+                    sink += impl ? ImFormatString(out, sizeof(out), fmt, i) : RefFormatString(out, sizeof(out), fmt, i);
+                else if (fmt[1] == 'l')
+                    sink += impl ? ImFormatString(out, sizeof(out), fmt, ll) : RefFormatString(out, sizeof(out), fmt, ll);
+                else if (fmt[0] == 'l')
+                    sink += impl ? ImFormatString(out, sizeof(out), fmt, "speed", d) : RefFormatString(out, sizeof(out), fmt, "speed", d);
+                else
+                    sink += impl ? ImFormatString(out, sizeof(out), fmt, d) : RefFormatString(out, sizeof(out), fmt, d);
+            }
+            ns[impl] = (GetTime() - t0) / iterations * 1e9;
+        }
+        printf("test_format_string: %-22s vsnprintf() %6.1f ns, ImFormatString() %6.1f ns\n", fmt, ns[0], ns[1]);
+    }
+}
+
+int main()
+{
+    TestRandomSpecs();
+    TestFixedCases();
+    Benchmark();
+    printf("test_format_string: %s\n", g_Fails ? "FAILED" : "OK");
+    return g_Fails ? 1 : 0;
+}
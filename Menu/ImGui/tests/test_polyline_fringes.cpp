@@ -0,0 +1,230 @@
+// Dear ImGui: anti-aliased polyline and fill vertices test and benchmark (see tests/run_tests.sh)
+// - AddPolyline() and AddConvexPolyFilled() vertices must be bit-exact with a scalar reference written the way the code was before
+//   ImPolylineCalcNormals()/ImPolylineCalcMiters()/ImPolylineCalcFringes(): textured, thin and thick lines, open and closed, fringe scales,
+//   zero-length segments and sharp turns, for every point count covering the 4-wide loops and their scalar tails.
+//   Run it once more with OUT=build_nosse CXXFLAGS="-O2 -DIMGUI_DISABLE_SSE" ./run_tests.sh test_polyline_fringes for the scalar path.
+// - Benchmark: 6000 points polylines and convex fill. Timings are printed, not checked.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+static int g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+// Same as the macros in imgui_draw.cpp
+#define REF_NORMALIZE2F_OVER_ZERO(VX,VY)    { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = ImRsqrt(d2); VX *= inv_len; VY *= inv_len; } } (void)0
+#define REF_FIXNORMAL2F(VX,VY)              { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > 100.0f) inv_len2 = 100.0f; VX *= inv_len2; VY *= inv_len2; } } (void)0
+
+static double GetTime() { return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+static std::vector<ImVec2> MakeNoisyWave(int count, unsigned int seed)
+{
+    std::vector<ImVec2> points;
+    for (int n = 0; n < count; n++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const float r = (seed >> 8) / 16777216.0f;
+        ImVec2 p(n * 0.37f + 20.0f, 300.0f + sinf(n * 0.05f) * 100.0f + r * 10.0f);
+        if ((seed & 31) == 0 && n > 0)
+            p = points.back();  // Zero-length segment
+        if ((seed & 63) == 1)
+            p.x += r * 50.0f;   // Sharp turn
+        points.push_back(p);
+    }
+    return points;
+}
+
+static std::vector<ImVec2> MakeCircle(int count)
+{
+    std::vector<ImVec2> points;
+    for (int n = 0; n < count; n++)
+        points.push_back(ImVec2(400.0f + cosf(n * IM_PI * 2.0f / count) * 200.0f, 300.0f + sinf(n * IM_PI * 2.0f / count) * 200.0f));
+    return points;
+}
+
+// Expected positions of the vertices written by AddPolyline() with ImDrawListFlags_AntiAliasedLines, in VtxBuffer order.
+static std::vector<ImVec2> RefPolylinePositions(const ImDrawList* draw_list, const ImVec2* points, int points_count, bool closed, float thickness)
+{
+    const float AA_SIZE = draw_list->_FringeScale;
+    const bool thick_line = (thickness > AA_SIZE);
+    thickness = ImMax(thickness, 1.0f);
+    const int integer_thickness = (int)thickness;
+    const bool use_texture = (draw_list->Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (thickness - integer_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+    const int count = closed ? points_count : points_count - 1;
+
+    std::vector<ImVec2> normals(points_count);
+    for (int i1 = 0; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        REF_NORMALIZE2F_OVER_ZERO(dx, dy);
+        normals[i1] = ImVec2(dy, -dx);
+    }
+    if (!closed)
+        normals[points_count - 1] = normals[points_count - 2];
+
+    // Offsets from each point along its averaged normal, in vertex order (the center vertex of thin untextured lines has offset 0)
+    float offsets[4];
+    int offsets_count;
+    if (use_texture || !thick_line)
+    {
+        const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
+        offsets_count = use_texture ? 2 : 3;
+        const float offsets_tex[] = { half_draw_size, -half_draw_size };
+        const float offsets_thin[] = { 0.0f, half_draw_size, -half_draw_size };
+        memcpy(offsets, use_texture ? offsets_tex : offsets_thin, sizeof(float) * offsets_count);
+    }
+    else
+    {
+        const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+        const float offsets_thick[] = { half_inner_thickness + AA_SIZE, half_inner_thickness, -half_inner_thickness, -(half_inner_thickness + AA_SIZE) };
+        offsets_count = 4;
+        memcpy(offsets, offsets_thick, sizeof(offsets_thick));
+    }
+
+    std::vector<ImVec2> out;
+    for (int i = 0; i < points_count; i++)
+    {
+        // The first point of open lines uses the segment normal, other points the averaged normals (the last point of open lines averages two equal normals)
+        float dm_x = normals[i].x, dm_y = normals[i].y;
+        if (closed || i > 0)
+        {
+            const int i0 = (i == 0) ? points_count - 1 : i - 1;
+            dm_x = (normals[i0].x + normals[i].x) * 0.5f;
+            dm_y = (normals[i0].y + normals[i].y) * 0.5f;
+            REF_FIXNORMAL2F(dm_x, dm_y);
+        }
+        for (int n = 0; n < offsets_count; n++)
+            out.push_back(offsets[n] == 0.0f ? points[i] : ImVec2(points[i].x + dm_x * offsets[n], points[i].y + dm_y * offsets[n]));
+    }
+    return out;
+}
+
+// Expected positions of the vertices written by AddConvexPolyFilled() with ImDrawListFlags_AntiAliasedFill: inner and outer vertex for each point.
+static std::vector<ImVec2> RefConvexFillPositions(const ImDrawList* draw_list, const ImVec2* points, int points_count)
+{
+    const float AA_SIZE = draw_list->_FringeScale;
+    std::vector<ImVec2> normals(points_count);
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+    {
+        float dx = points[i1].x - points[i0].x;
+        float dy = points[i1].y - points[i0].y;
+        REF_NORMALIZE2F_OVER_ZERO(dx, dy);
+        normals[i0] = ImVec2(dy, -dx);
+    }
+    std::vector<ImVec2> out;
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+    {
+        float dm_x = (normals[i0].x + normals[i1].x) * 0.5f;
+        float dm_y = (normals[i0].y + normals[i1].y) * 0.5f;
+        REF_FIXNORMAL2F(dm_x, dm_y);
+        dm_x *= AA_SIZE * 0.5f;
+        dm_y *= AA_SIZE * 0.5f;
+        out.push_back(ImVec2(points[i1].x - dm_x, points[i1].y - dm_y));
+        out.push_back(ImVec2(points[i1].x + dm_x, points[i1].y + dm_y));
+    }
+    return out;
+}
+
+static bool SamePositions(const ImDrawList* draw_list, const std::vector<ImVec2>& expected)
+{
+    if (draw_list->VtxBuffer.Size != (int)expected.size())
+        return false;
+    for (int n = 0; n < draw_list->VtxBuffer.Size; n++)
+        if (memcmp(&draw_list->VtxBuffer[n].pos, &expected[n], sizeof(ImVec2)) != 0)
+            return false;
+    return true;
+}
+
+static void ResetDrawList(ImDrawList* draw_list, ImDrawListFlags flags, float fringe_scale)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->Flags = flags | ImDrawListFlags_AllowVtxOffset;
+    draw_list->_FringeScale = fringe_scale;
+}
+
+int main()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 720);
+    unsigned char* pixels; int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &tex_w, &tex_h);
+    ImGui::NewFrame();
+    ImDrawList* draw_list = ImGui::GetForegroundDrawList();
+
+    const ImDrawListFlags flags_variants[] =
+    {
+        ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill,
+        ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill,
+    };
+    const float thicknesses[] = { 0.5f, 1.0f, 1.5f, 2.0f, 3.0f, 5.0f };
+    const float fringe_scales[] = { 1.0f, 0.5f };
+    int lines_count = 0, fills_count = 0;
+    for (ImDrawListFlags flags : flags_variants)
+        for (float fringe_scale : fringe_scales)
+            for (int points_count = 2; points_count < 40; points_count++)
+                for (int shape = 0; shape < 3; shape++)
+                {
+                    const std::vector<ImVec2> points = (shape == 2) ? MakeCircle(points_count) : MakeNoisyWave(points_count, (unsigned int)(shape + points_count * 7));
+                    for (float thickness : thicknesses)
+                        for (int closed = 0; closed < 2; closed++)
+                        {
+                            ResetDrawList(draw_list, flags, fringe_scale);
+                            draw_list->AddPolyline(points.data(), points_count, IM_COL32(255, 128, 64, 200), closed ? ImDrawFlags_Closed : 0, thickness);
+                            CHECK(SamePositions(draw_list, RefPolylinePositions(draw_list, points.data(), points_count, closed != 0, thickness)));
+                            lines_count++;
+                        }
+                    if (points_count >= 3)
+                    {
+                        ResetDrawList(draw_list, flags, fringe_scale);
+                        draw_list->AddConvexPolyFilled(points.data(), points_count, IM_COL32(10, 20, 30, 255));
+                        CHECK(SamePositions(draw_list, RefConvexFillPositions(draw_list, points.data(), points_count)));
+                        fills_count++;
+                    }
+                }
+    printf("test_polyline_fringes: %d polylines, %d convex fills compared: %s\n", lines_count, fills_count, g_Fails ? "FAILED" : "OK");
+
+    // Benchmark
+    const std::vector<ImVec2> wave = MakeNoisyWave(6000, 1), circle = MakeCircle(6000);
+    struct Bench { const char* Name; ImDrawListFlags Flags; float Thickness; bool Fill; };
+    const Bench benches[] =
+    {
+        { "AddPolyline(), AA textured, thickness 1",    ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex, 1.0f, false },
+        { "AddPolyline(), AA, thickness 1.5",           ImDrawListFlags_AntiAliasedLines, 1.5f, false },
+        { "AddPolyline(), AA, thickness 3.5",           ImDrawListFlags_AntiAliasedLines, 3.5f, false },
+        { "AddConvexPolyFilled(), AA",                  ImDrawListFlags_AntiAliasedFill, 1.0f, true },
+    };
+    for (const Bench& bench : benches)
+    {
+        double best = 1e9;
+        for (int rep = 0; rep < 60; rep++) // Best of 60 runs of 20 calls
+        {
+            const double t0 = GetTime();
+            for (int n = 0; n < 20; n++)
+            {
+                ResetDrawList(draw_list, bench.Flags, 1.0f);
+                if (bench.Fill)
+                    draw_list->AddConvexPolyFilled(circle.data(), (int)circle.size(), IM_COL32_WHITE);
+                else
+                    draw_list->AddPolyline(wave.data(), (int)wave.size(), IM_COL32_WHITE, 0, bench.Thickness);
+            }
+            best = ImMin(best, GetTime() - t0);
+        }
+        printf("test_polyline_fringes: 6000 points, %-40s %6.1f Mpoints/s\n", bench.Name, 20 * 6000 / best / 1e6);
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return g_Fails ? 1 : 0;
+}
@@ -0,0 +1,148 @@
+// Dear ImGui: ImDrawQuad precision test (see tests/run_tests.sh)
+// - Renders the same frames with and without ImGuiBackendFlags_RendererHasQuadInstances.
+// - Quads are expanded the way backends/vulkan/glsl_shader_quad.vert does, then compared to the triangles of the regular path:
+//   positions within 1/32th of a pixel, UV within 1/131070th (half a unorm16 step), same colors, clip rectangles and textures.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+static int g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+struct Vert
+{
+    ImVec2      Pos, UV;
+    ImU32       Col;
+    ImVec4      ClipRect;
+    ImTextureID TexId;
+};
+
+// Expand a frame to a non-indexed triangle list per draw list, in submission order.
+// Quads use the same two triangles (a, b, c), (a, c, d) as ImDrawList::PrimRectUV().
+static std::vector<std::vector<Vert> > ExpandFrame(const ImDrawData* draw_data, int* out_quads_count)
+{
+    std::vector<std::vector<Vert> > lists;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        lists.push_back(std::vector<Vert>());
+        std::vector<Vert>& out = lists.back();
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != NULL)
+                continue;
+            Vert v;
+            v.ClipRect = cmd.ClipRect;
+            v.TexId = cmd.TextureId;
+            if (cmd.QuadInstances)
+            {
+                CHECK(cmd.QuadInstances == ImDrawQuadKind_Textured);
+                for (unsigned int n = 0; n < cmd.ElemCount; n++)
+                {
+                    const ImDrawQuad& q = draw_list->QuadBuffer[cmd.IdxOffset + n];
+                    const ImVec2 p_min = q.Pos;
+                    const ImVec2 p_max(q.Pos.x + q.Size[0] * (1.0f / 16.0f), q.Pos.y + q.Size[1] * (1.0f / 16.0f));
+                    const ImVec2 uv_min(q.UV[0] / 65535.0f, q.UV[1] / 65535.0f);
+                    const ImVec2 uv_max(q.UV[2] / 65535.0f, q.UV[3] / 65535.0f);
+                    const ImVec2 pos[4] = { p_min, ImVec2(p_max.x, p_min.y), p_max, ImVec2(p_min.x, p_max.y) };
+                    const ImVec2 uv[4] = { uv_min, ImVec2(uv_max.x, uv_min.y), uv_max, ImVec2(uv_min.x, uv_max.y) };
+                    const int order[6] = { 0, 1, 2, 0, 2, 3 };
+                    for (int k = 0; k < 6; k++)
+                    {
+                        v.Pos = pos[order[k]];
+                        v.UV = uv[order[k]];
+                        v.Col = q.Col;
+                        out.push_back(v);
+                    }
+                }
+                *out_quads_count += (int)cmd.ElemCount;
+            }
+            else
+            {
+                for (unsigned int n = 0; n < cmd.ElemCount; n++)
+                {
+                    const ImDrawVert& src = draw_list->VtxBuffer[cmd.VtxOffset + draw_list->IdxBuffer[cmd.IdxOffset + n]];
+                    v.Pos = src.pos;
+                    v.UV = src.uv;
+                    v.Col = src.col;
+                    out.push_back(v);
+                }
+            }
+        }
+    }
+    return lists;
+}
+
+static void RunFrames(bool quad_instances, int frames_count, std::vector<std::vector<std::vector<Vert> > >* out_frames, int* out_quads_count)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 720);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    if (quad_instances)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasQuadInstances;
+    unsigned char* pixels; int w, h;
+    io.Fonts->GetTexDataAsAlpha8(&pixels, &w, &h);
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        ImGui::NewFrame();
+        ImGui::ShowDemoWindow();
+        ImGui::SetNextWindowPos(ImVec2(700, 50), ImGuiCond_Once);
+        ImGui::Begin("Images");
+        ImGui::Image(io.Fonts->TexID, ImVec2((float)w, (float)h)); // Whole atlas: UV range 0.0f..1.0f
+        ImGui::Image(io.Fonts->TexID, ImVec2(33.3f, 17.7f), ImVec2(0.1f, 0.2f), ImVec2(0.7f, 0.3f));
+        ImGui::End();
+        ImGui::Render();
+        out_frames->push_back(ExpandFrame(ImGui::GetDrawData(), out_quads_count));
+    }
+    ImGui::DestroyContext();
+}
+
+int main()
+{
+    const int frames_count = 4;
+    std::vector<std::vector<std::vector<Vert> > > frames_ref, frames_quad;
+    int quads_count_ref = 0, quads_count = 0;
+    RunFrames(false, frames_count, &frames_ref, &quads_count_ref);
+    RunFrames(true, frames_count, &frames_quad, &quads_count);
+    CHECK(quads_count_ref == 0 && quads_count > 0);
+
+    const float pos_tolerance = 1.0f / 32.0f + 1e-4f;
+    const float uv_tolerance = 0.5f / 65535.0f + 1e-7f;
+    float pos_err_max = 0.0f, uv_err_max = 0.0f;
+    int vtx_count = 0;
+    CHECK(frames_ref.size() == frames_quad.size());
+    for (size_t frame = 0; frame < frames_ref.size() && frame < frames_quad.size(); frame++)
+    {
+        CHECK(frames_ref[frame].size() == frames_quad[frame].size());
+        for (size_t list_n = 0; list_n < frames_ref[frame].size() && list_n < frames_quad[frame].size(); list_n++)
+        {
+            const std::vector<Vert>& a = frames_ref[frame][list_n];
+            const std::vector<Vert>& b = frames_quad[frame][list_n];
+            CHECK(a.size() == b.size());
+            for (size_t n = 0; n < a.size() && n < b.size(); n++, vtx_count++)
+            {
+                pos_err_max = ImMax(pos_err_max, ImMax(ImFabs(a[n].Pos.x - b[n].Pos.x), ImFabs(a[n].Pos.y - b[n].Pos.y)));
+                uv_err_max = ImMax(uv_err_max, ImMax(ImFabs(a[n].UV.x - b[n].UV.x), ImFabs(a[n].UV.y - b[n].UV.y)));
+                const bool same_state = a[n].Col == b[n].Col && a[n].TexId == b[n].TexId &&
+                    a[n].ClipRect.x == b[n].ClipRect.x && a[n].ClipRect.y == b[n].ClipRect.y && a[n].ClipRect.z == b[n].ClipRect.z && a[n].ClipRect.w == b[n].ClipRect.w;
+                if (!same_state)
+                {
+                    CHECK(same_state);
+                    break;
+                }
+            }
+        }
+    }
+    CHECK(pos_err_max <= pos_tolerance);
+    CHECK(uv_err_max <= uv_tolerance);
+
+    printf("test_quad_instances: %d frames, %d quads, %d vertices compared, max error pos %.5f px, uv %.8f: %s\n",
+        frames_count, quads_count, vtx_count, pos_err_max, uv_err_max, g_Fails ? "FAILED" : "OK");
+    return g_Fails ? 1 : 0;
+}
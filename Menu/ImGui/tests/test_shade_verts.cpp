@@ -0,0 +1,265 @@
+// Dear ImGui: ShadeVertsXXX() and ImDrawData::DeIndexAllBuffers() test and benchmark (see tests/run_tests.sh)
+// - ShadeVertsLinearColorGradientKeepAlpha(), ShadeVertsLinearUV() and ShadeVertsTransformPos() must be bit-exact with the scalar code they replaced,
+//   for start offsets 0-4 and counts 0-18 plus 100000 (4-wide loops and their scalar tails), clamped or not, degenerate gradients and signed zeros.
+//   Run it once more with OUT=build_nosse CXXFLAGS="-O2 -DIMGUI_DISABLE_SSE" ./run_tests.sh test_shade_verts for the scalar path.
+// - DeIndexAllBuffers() on demo frames using VtxOffset and ImDrawQuad instances must output, for each command, the vertices referenced by
+//   its indices, or 6 vertices per quad in PrimRectUV() order.
+// - Benchmark: 100000 vertices. Timings are printed, not checked.
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+static int g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+static double GetTime() { return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+static unsigned int g_RandomState = 12345;
+static float RandomFloat() { g_RandomState = g_RandomState * 1664525u + 1013904223u; return (g_RandomState >> 8) / 16777216.0f; }
+
+static void FillVertices(ImVector<ImDrawVert>& vertices, int count)
+{
+    vertices.resize(count);
+    for (int n = 0; n < count; n++)
+    {
+        ImDrawVert& v = vertices[n];
+        v.pos = ImVec2(RandomFloat() * 400.0f - 50.0f, RandomFloat() * 300.0f - 50.0f);
+        if (n % 7 == 0)
+            v.pos.x = 0.0f;
+        if (n % 11 == 0)
+            v.pos.y = -0.0f;
+        if (n % 13 == 0)
+            v.pos = ImVec2(100.0f, 200.0f); // On the gradient/UV origin of some variants below
+        v.uv = ImVec2(RandomFloat(), RandomFloat());
+        v.col = g_RandomState ^ 0x9E3779B9u;
+    }
+}
+
+// Scalar reference implementations: same code as the ShadeVertsXXX() functions before they were vectorized.
+static void RefShadeVertsLinearColorGradientKeepAlpha(ImDrawVert* vert_start, ImDrawVert* vert_end, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
+{
+    ImVec2 gradient_extent = gradient_p1 - gradient_p0;
+    float gradient_inv_length2 = 1.0f / ImLengthSqr(gradient_extent);
+    const int col0_r = (int)(col0 >> IM_COL32_R_SHIFT) & 0xFF;
+    const int col0_g = (int)(col0 >> IM_COL32_G_SHIFT) & 0xFF;
+    const int col0_b = (int)(col0 >> IM_COL32_B_SHIFT) & 0xFF;
+    const int col_delta_r = ((int)(col1 >> IM_COL32_R_SHIFT) & 0xFF) - col0_r;
+    const int col_delta_g = ((int)(col1 >> IM_COL32_G_SHIFT) & 0xFF) - col0_g;
+    const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
+    for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
+    {
+        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
+        int r = (int)(col0_r + col_delta_r * t);
+        int g = (int)(col0_g + col_delta_g * t);
+        int b = (int)(col0_b + col_delta_b * t);
+        vert->col = (r << IM_COL32_R_SHIFT) | (g << IM_COL32_G_SHIFT) | (b << IM_COL32_B_SHIFT) | (vert->col & IM_COL32_A_MASK);
+    }
+}
+
+static void RefShadeVertsLinearUV(ImDrawVert* vert_start, ImDrawVert* vert_end, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp)
+{
+    const ImVec2 size = b - a;
+    const ImVec2 uv_size = uv_b - uv_a;
+    const ImVec2 scale = ImVec2(
+        size.x != 0.0f ? (uv_size.x / size.x) : 0.0f,
+        size.y != 0.0f ? (uv_size.y / size.y) : 0.0f);
+    if (clamp)
+    {
+        const ImVec2 min = ImMin(uv_a, uv_b);
+        const ImVec2 max = ImMax(uv_a, uv_b);
+        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+    }
+    else
+    {
+        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+    }
+}
+
+static void RefShadeVertsTransformPos(ImDrawVert* vert_start, ImDrawVert* vert_end, const ImVec2& pivot_in, float cos_a, float sin_a, const ImVec2& pivot_out)
+{
+    for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        vertex->pos = ImRotate(vertex->pos - pivot_in, cos_a, sin_a) + pivot_out;
+}
+
+static void TestShadeVerts()
+{
+    ImDrawList* draw_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+    ImVector<ImDrawVert> expected;
+    int compared_count = 0;
+    for (int start = 0; start < 5; start++)
+        for (int count_n = 0; count_n < 20; count_n++)
+            for (int variant = 0; variant < 4; variant++)
+            {
+                const int count = (count_n < 19) ? count_n : 100000; // Plus a long range, for rounding differences which only show up on a few vertices
+                FillVertices(draw_list->VtxBuffer, start + count + 5);
+                expected = draw_list->VtxBuffer;
+                ImDrawVert* ref_start = expected.Data + start;
+                ImDrawVert* ref_end = ref_start + count;
+
+                // Variant 3 has a horizontal gradient (zero y extent)
+                const ImVec2 a(100.0f + variant, 200.0f), b(300.0f, variant == 3 ? 200.0f : 100.0f + variant * 40.0f);
+                ImGui::ShadeVertsLinearColorGradientKeepAlpha(draw_list, start, start + count, a, b, IM_COL32(255, 0, 10, 255), IM_COL32(3, 250, 128, 0));
+                RefShadeVertsLinearColorGradientKeepAlpha(ref_start, ref_end, a, b, IM_COL32(255, 0, 10, 255), IM_COL32(3, 250, 128, 0));
+                ImGui::ShadeVertsLinearUV(draw_list, start, start + count, a, b, ImVec2(0.25f, 0.5f), ImVec2(variant * 0.3f, 0.1f), (variant & 1) != 0);
+                RefShadeVertsLinearUV(ref_start, ref_end, a, b, ImVec2(0.25f, 0.5f), ImVec2(variant * 0.3f, 0.1f), (variant & 1) != 0);
+                ImGui::ShadeVertsLinearUV(draw_list, start + 1, start + count, ImVec2(100, 200), ImVec2(100, 200), ImVec2(0, 0), ImVec2(1, 1), true); // Zero size
+                RefShadeVertsLinearUV(ref_start + 1, ref_end, ImVec2(100, 200), ImVec2(100, 200), ImVec2(0, 0), ImVec2(1, 1), true);
+                ImGui::ShadeVertsTransformPos(draw_list, start, start + count, a, cosf(variant * 0.7f), sinf(variant * 0.7f), b);
+                RefShadeVertsTransformPos(ref_start, ref_end, a, cosf(variant * 0.7f), sinf(variant * 0.7f), b);
+
+                CHECK(memcmp(draw_list->VtxBuffer.Data, expected.Data, (size_t)expected.size_in_bytes()) == 0);
+                compared_count++;
+            }
+    IM_DELETE(draw_list);
+    printf("test_shade_verts: %d ShadeVertsXXX() ranges compared\n", compared_count);
+}
+
+// Expected non-indexed vertices of a draw list, per command
+static std::vector<std::vector<ImDrawVert> > RefDeIndex(const ImDrawList* draw_list)
+{
+    std::vector<std::vector<ImDrawVert> > out;
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        out.push_back(std::vector<ImDrawVert>());
+        if (cmd.UserCallback != NULL)
+            continue;
+        for (unsigned int n = 0; n < cmd.ElemCount; n++)
+        {
+            if (cmd.QuadInstances == ImDrawQuadKind_None)
+            {
+                out.back().push_back(draw_list->VtxBuffer[cmd.VtxOffset + draw_list->IdxBuffer[cmd.IdxOffset + n]]);
+                continue;
+            }
+            const ImDrawQuad& q = draw_list->QuadBuffer[cmd.IdxOffset + n];
+            const ImVec2 a = q.Pos, c(q.Pos.x + q.Size[0] * (1.0f / 16.0f), q.Pos.y + q.Size[1] * (1.0f / 16.0f));
+            const ImVec2 uv_a(q.UV[0] * (1.0f / 65535.0f), q.UV[1] * (1.0f / 65535.0f)), uv_c(q.UV[2] * (1.0f / 65535.0f), q.UV[3] * (1.0f / 65535.0f));
+            const ImDrawVert v[4] = { { a, uv_a, q.Col }, { ImVec2(c.x, a.y), ImVec2(uv_c.x, uv_a.y), q.Col }, { c, uv_c, q.Col }, { ImVec2(a.x, c.y), ImVec2(uv_a.x, uv_c.y), q.Col } };
+            const int order[6] = { 0, 1, 2, 0, 2, 3 };
+            for (int k = 0; k < 6; k++)
+                out.back().push_back(v[order[k]]);
+        }
+    }
+    return out;
+}
+
+static void TestDeIndexAllBuffers()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasQuadInstances;
+    int quads_count = 0, vtx_count = 0;
+    for (int frame = 0; frame < 3; frame++)
+    {
+        ImGui::NewFrame();
+        ImGui::ShowDemoWindow();
+        ImGui::Render();
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        std::vector<std::vector<std::vector<ImDrawVert> > > expected;
+        for (const ImDrawList* draw_list : draw_data->CmdLists)
+        {
+            expected.push_back(RefDeIndex(draw_list));
+            for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+                quads_count += cmd.QuadInstances ? (int)cmd.ElemCount : 0;
+        }
+        draw_data->DeIndexAllBuffers();
+        CHECK(draw_data->TotalIdxCount == 0 && draw_data->TotalQuadCount == 0);
+        int total_vtx_count = 0;
+        for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+        {
+            const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+            CHECK(draw_list->IdxBuffer.Size == 0 && draw_list->QuadBuffer.Size == 0);
+            CHECK(draw_list->CmdBuffer.Size == (int)expected[list_n].size());
+            for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size && cmd_n < (int)expected[list_n].size(); cmd_n++)
+            {
+                const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+                const std::vector<ImDrawVert>& cmd_expected = expected[list_n][cmd_n];
+                if (cmd.UserCallback != NULL)
+                    continue;
+                CHECK(cmd.VtxOffset == 0 && cmd.QuadInstances == ImDrawQuadKind_None);
+                CHECK(cmd.ElemCount == cmd_expected.size() && cmd.IdxOffset + cmd.ElemCount <= (unsigned int)draw_list->VtxBuffer.Size);
+                if (cmd.ElemCount == cmd_expected.size() && cmd.IdxOffset + cmd.ElemCount <= (unsigned int)draw_list->VtxBuffer.Size && cmd.ElemCount > 0)
+                    CHECK(memcmp(&draw_list->VtxBuffer[cmd.IdxOffset], cmd_expected.data(), cmd_expected.size() * sizeof(ImDrawVert)) == 0);
+                vtx_count += (int)cmd.ElemCount;
+            }
+            total_vtx_count += draw_list->VtxBuffer.Size;
+        }
+        CHECK(draw_data->TotalVtxCount == total_vtx_count);
+    }
+    CHECK(quads_count > 0);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasQuadInstances);
+    printf("test_shade_verts: DeIndexAllBuffers() on 3 demo frames, %d quads, %d vertices compared\n", quads_count, vtx_count);
+}
+
+static void Benchmark()
+{
+    const int N = 100000;
+    ImDrawList* draw_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+    FillVertices(draw_list->VtxBuffer, N);
+    ImVector<ImDrawIdx> indices;
+    indices.resize(N * 3 / 2);
+    for (ImDrawIdx& idx : indices)
+        idx = (ImDrawIdx)(RandomFloat() * 65535.0f);
+
+    const char* names[] = { "ShadeVertsLinearColorGradientKeepAlpha()", "ShadeVertsLinearUV(), clamped", "ShadeVertsTransformPos()", "DeIndexAllBuffers()" };
+    for (int bench_n = 0; bench_n < IM_ARRAYSIZE(names); bench_n++)
+    {
+        double best = 1e9;
+        for (int rep = 0; rep < 30; rep++) // Best of 30 runs
+        {
+            ImDrawData draw_data;
+            ImDrawList* indexed_list = NULL;
+            if (bench_n == 3)
+            {
+                indexed_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+                FillVertices(indexed_list->VtxBuffer, 65536);
+                indexed_list->IdxBuffer = indices;
+                indexed_list->CmdBuffer.push_back(ImDrawCmd());
+                indexed_list->CmdBuffer[0].ElemCount = (unsigned int)indices.Size;
+                draw_data.CmdLists.push_back(indexed_list);
+                draw_data.CmdListsCount = 1;
+            }
+            const double t0 = GetTime();
+            switch (bench_n)
+            {
+            case 0: ImGui::ShadeVertsLinearColorGradientKeepAlpha(draw_list, 0, N, ImVec2(0, 0), ImVec2(300, 200), IM_COL32(255, 0, 0, 255), IM_COL32(0, 0, 255, 255)); break;
+            case 1: ImGui::ShadeVertsLinearUV(draw_list, 0, N, ImVec2(0, 0), ImVec2(300, 200), ImVec2(0, 0), ImVec2(1, 1), true); break;
+            case 2: ImGui::ShadeVertsTransformPos(draw_list, 0, N, ImVec2(100, 100), 0.8f, 0.6f, ImVec2(100, 100)); break;
+            case 3: draw_data.DeIndexAllBuffers(); break;
+            }
+            best = ImMin(best, GetTime() - t0);
+            if (indexed_list)
+                IM_DELETE(indexed_list);
+        }
+        const int items_count = (bench_n == 3) ? indices.Size : N;
+        printf("test_shade_verts: %6d %s, %-42s %7.1f M/s\n", items_count, (bench_n == 3) ? "indices " : "vertices", names[bench_n], items_count / best / 1e6);
+    }
+    IM_DELETE(draw_list);
+}
+
+int main()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 720);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* pixels; int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &tex_w, &tex_h);
+
+    TestShadeVerts();
+    TestDeIndexAllBuffers();
+    Benchmark();
+
+    ImGui::DestroyContext();
+    printf("test_shade_verts: %s\n", g_Fails ? "FAILED" : "OK");
+    return g_Fails ? 1 : 0;
+}
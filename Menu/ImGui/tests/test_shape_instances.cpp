@@ -0,0 +1,197 @@
+// Dear ImGui: ImDrawQuadKind_Shape equivalence test (see tests/run_tests.sh)
+// - Draws rounded rectangles, circles and borders with and without ImDrawListFlags_ShapeInstances.
+// - Triangles are rasterized with one sample per pixel center. Shape instances are evaluated with a C++ port of
+//   backends/vulkan/glsl_shader_shape.vert/.frag. The two coverage images are compared per pixel, and their total
+//   coverage against the exact area of the shape.
+// - Expected: per-pixel difference <= 0.3 (anti-aliasing fringe of the polygon vs distance field), and shape instances
+//   at least as close to the exact area as the tessellated shapes (within 1%).
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+static const int W = 160, H = 160;
+static int g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+struct Image
+{
+    std::vector<float> Alpha;
+    Image() : Alpha(W * H, 0.0f) {}
+    void Blend(int x, int y, float a) { float& dst = Alpha[y * W + x]; dst = a + dst * (1.0f - a); }
+};
+
+static float EdgeFunction(const ImVec2& a, const ImVec2& b, float x, float y) { return (b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x); }
+static bool  IsTopLeftEdge(const ImVec2& a, const ImVec2& b) { return (a.y == b.y && b.x < a.x) || (b.y > a.y); }
+
+// Rasterize triangles (ImDrawQuadKind_None commands) with top-left fill rule and interpolated vertex alpha
+static void RasterizeTriangles(Image* img, const ImDrawList* draw_list)
+{
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.QuadInstances || cmd.UserCallback)
+            continue;
+        for (unsigned int i = 0; i < cmd.ElemCount; i += 3)
+        {
+            ImDrawVert v[3];
+            for (int k = 0; k < 3; k++)
+                v[k] = draw_list->VtxBuffer[cmd.VtxOffset + draw_list->IdxBuffer[cmd.IdxOffset + i + k]];
+            float area = EdgeFunction(v[0].pos, v[1].pos, v[2].pos.x, v[2].pos.y);
+            if (area == 0.0f)
+                continue;
+            if (area < 0.0f)
+            {
+                ImSwap(v[1], v[2]);
+                area = -area;
+            }
+            const int x0 = ImMax(0, (int)floorf(ImMin(v[0].pos.x, ImMin(v[1].pos.x, v[2].pos.x))));
+            const int y0 = ImMax(0, (int)floorf(ImMin(v[0].pos.y, ImMin(v[1].pos.y, v[2].pos.y))));
+            const int x1 = ImMin(W - 1, (int)ceilf(ImMax(v[0].pos.x, ImMax(v[1].pos.x, v[2].pos.x))));
+            const int y1 = ImMin(H - 1, (int)ceilf(ImMax(v[0].pos.y, ImMax(v[1].pos.y, v[2].pos.y))));
+            for (int y = y0; y <= y1; y++)
+                for (int x = x0; x <= x1; x++)
+                {
+                    const float px = x + 0.5f, py = y + 0.5f;
+                    const float w0 = EdgeFunction(v[1].pos, v[2].pos, px, py);
+                    const float w1 = EdgeFunction(v[2].pos, v[0].pos, px, py);
+                    const float w2 = EdgeFunction(v[0].pos, v[1].pos, px, py);
+                    if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f)
+                        continue;
+                    if ((w0 == 0.0f && !IsTopLeftEdge(v[1].pos, v[2].pos)) || (w1 == 0.0f && !IsTopLeftEdge(v[2].pos, v[0].pos)) || (w2 == 0.0f && !IsTopLeftEdge(v[0].pos, v[1].pos)))
+                        continue;
+                    img->Blend(x, y, (w0 * (v[0].col >> IM_COL32_A_SHIFT) + w1 * (v[1].col >> IM_COL32_A_SHIFT) + w2 * (v[2].col >> IM_COL32_A_SHIFT)) / area / 255.0f);
+                }
+        }
+    }
+}
+
+// Evaluate instances of ImDrawQuadKind_Textured (as a solid fill: tests only sample the white pixel) and ImDrawQuadKind_Shape commands
+static void RasterizeQuads(Image* img, const ImDrawList* draw_list)
+{
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.QuadInstances == ImDrawQuadKind_None)
+            continue;
+        for (unsigned int i = 0; i < cmd.ElemCount; i++)
+        {
+            const ImDrawQuad& q = draw_list->QuadBuffer[cmd.IdxOffset + i];
+            const float size_x = q.Size[0] / 16.0f, size_y = q.Size[1] / 16.0f;
+            const float col_a = (q.Col >> IM_COL32_A_SHIFT) / 255.0f;
+
+            // glsl_shader_shape.vert: flat outputs
+            const float half_x = size_x * 0.5f - q.UV[3] / 16.0f, half_y = size_y * 0.5f - q.UV[3] / 16.0f;
+            float radius[4];
+            for (int k = 0; k < 4; k++)
+                radius[k] = ((q.UV[2] >> k) & 1) * (q.UV[0] / 16.0f);
+            const float stroke_x = (q.UV[1] != 0) ? 1.0f : 0.0f, stroke_y = q.UV[1] / 32.0f, stroke_z = (q.UV[2] & 0x10) ? 1.0f : 65536.0f;
+
+            const int x0 = ImMax(0, (int)floorf(q.Pos.x)), x1 = ImMin(W - 1, (int)ceilf(q.Pos.x + size_x));
+            const int y0 = ImMax(0, (int)floorf(q.Pos.y)), y1 = ImMin(H - 1, (int)ceilf(q.Pos.y + size_y));
+            for (int y = y0; y <= y1; y++)
+                for (int x = x0; x <= x1; x++)
+                {
+                    const float px = x + 0.5f, py = y + 0.5f;
+                    if (px < q.Pos.x || px >= q.Pos.x + size_x || py < q.Pos.y || py >= q.Pos.y + size_y)
+                        continue;
+                    if (cmd.QuadInstances == ImDrawQuadKind_Textured)
+                    {
+                        img->Blend(x, y, col_a);
+                        continue;
+                    }
+
+                    // glsl_shader_shape.frag
+                    const float pos_x = px - q.Pos.x - size_x * 0.5f, pos_y = py - q.Pos.y - size_y * 0.5f;
+                    const float r = (pos_y > 0.0f) ? (pos_x > 0.0f ? radius[3] : radius[2]) : (pos_x > 0.0f ? radius[1] : radius[0]);
+                    const float qx = fabsf(pos_x) - half_x + r, qy = fabsf(pos_y) - half_y + r;
+                    float d = ImMin(ImMax(qx, qy), 0.0f) + sqrtf(ImMax(qx, 0.0f) * ImMax(qx, 0.0f) + ImMax(qy, 0.0f) * ImMax(qy, 0.0f)) - r;
+                    d = d * (1.0f - stroke_x) + (fabsf(d) - stroke_y) * stroke_x;
+                    img->Blend(x, y, col_a * ImClamp(0.5f - d * stroke_z, 0.0f, 1.0f));
+                }
+        }
+    }
+}
+
+typedef void (*DrawFunc)(ImDrawList* draw_list);
+
+struct TestCase
+{
+    const char* Name;
+    float       Area;       // Exact area covered by the shape (times alpha)
+    DrawFunc    Draw;
+};
+
+static const float PI = 3.14159265f;
+static const ImU32 COL = IM_COL32(255, 255, 255, 255);
+
+static const TestCase g_Cases[] =
+{
+    { "RectFilled r=8",          100*60 - (4-PI)*64,           [](ImDrawList* dl) { dl->AddRectFilled(ImVec2(20, 30), ImVec2(120, 90), COL, 8.0f); } },
+    { "RectFilled r=8 top",      100*60 - (4-PI)*32,           [](ImDrawList* dl) { dl->AddRectFilled(ImVec2(20, 30), ImVec2(120, 90), COL, 8.0f, ImDrawFlags_RoundCornersTop); } },
+    { "RectFilled r=30 clamped", 100*40 - (4-PI)*361,          [](ImDrawList* dl) { dl->AddRectFilled(ImVec2(20, 30), ImVec2(120, 70), COL, 30.0f); } }, // Rounding clamped to h/2-1
+    { "RectFilled r=4 small",    12*9 - (4-PI)*12.25f,         [](ImDrawList* dl) { dl->AddRectFilled(ImVec2(10, 10), ImVec2(22, 19), COL, 4.0f); } },
+    { "RectFilled r=8 alpha",    0.5f*(100*60 - (4-PI)*64),    [](ImDrawList* dl) { dl->AddRectFilled(ImVec2(20, 30), ImVec2(120, 90), IM_COL32(255, 255, 255, 128), 8.0f); } },
+    { "Rect r=0 t=1",            2*(99+59),                    [](ImDrawList* dl) { dl->AddRect(ImVec2(20, 30), ImVec2(120, 90), COL, 0.0f, 0, 1.0f); } },
+    { "Rect r=6 t=1",            2*(99+59) - (8-2*PI)*5.5f,    [](ImDrawList* dl) { dl->AddRect(ImVec2(20, 30), ImVec2(120, 90), COL, 6.0f, 0, 1.0f); } },
+    { "Rect r=10 t=3",           3*(2*(99+59) - (8-2*PI)*9.5f),[](ImDrawList* dl) { dl->AddRect(ImVec2(20, 30), ImVec2(120, 90), COL, 10.0f, 0, 3.0f); } },
+    { "CircleFilled r=40",       PI*40*40,                     [](ImDrawList* dl) { dl->AddCircleFilled(ImVec2(80, 80), 40.0f, COL); } },
+    { "CircleFilled r=5",        PI*5*5,                       [](ImDrawList* dl) { dl->AddCircleFilled(ImVec2(30.5f, 30.5f), 5.0f, COL); } },
+    { "Circle r=40 t=1",         2*PI*39.5f,                   [](ImDrawList* dl) { dl->AddCircle(ImVec2(80, 80), 40.0f, COL, 0, 1.0f); } },
+    { "Circle r=20 t=2.5",       2.5f*2*PI*19.5f,              [](ImDrawList* dl) { dl->AddCircle(ImVec2(80, 80), 20.0f, COL, 0, 2.5f); } },
+};
+
+int main()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2((float)W, (float)H);
+    unsigned char* pixels; int tex_w, tex_h;
+    io.Fonts->GetTexDataAsAlpha8(&pixels, &tex_w, &tex_h);
+    ImGui::NewFrame();
+
+    printf("%-24s %10s %10s %10s %8s %8s\n", "", "exact", "vertices", "shapes", "max|d|", "mean|d|");
+    for (const TestCase& test : g_Cases)
+    {
+        Image img[2];
+        int shapes_count = 0;
+        for (int use_shapes = 0; use_shapes < 2; use_shapes++)
+        {
+            ImDrawList draw_list(ImGui::GetDrawListSharedData());
+            draw_list._ResetForNewFrame();
+            draw_list.Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AllowVtxOffset;
+            if (use_shapes)
+                draw_list.Flags |= ImDrawListFlags_QuadInstances | ImDrawListFlags_ShapeInstances;
+            draw_list.PushClipRect(ImVec2(0, 0), ImVec2((float)W, (float)H));
+            draw_list.PushTextureID(io.Fonts->TexID);
+            test.Draw(&draw_list);
+            if (use_shapes)
+                for (const ImDrawCmd& cmd : draw_list.CmdBuffer)
+                    shapes_count += (cmd.QuadInstances == ImDrawQuadKind_Shape) ? (int)cmd.ElemCount : 0;
+            RasterizeTriangles(&img[use_shapes], &draw_list);
+            RasterizeQuads(&img[use_shapes], &draw_list);
+        }
+
+        float diff_max = 0.0f, diff_sum = 0.0f, area_vtx = 0.0f, area_shape = 0.0f;
+        for (int i = 0; i < W * H; i++)
+        {
+            const float diff = fabsf(img[0].Alpha[i] - img[1].Alpha[i]);
+            diff_max = ImMax(diff_max, diff);
+            diff_sum += diff;
+            area_vtx += img[0].Alpha[i];
+            area_shape += img[1].Alpha[i];
+        }
+        const float diff_mean = diff_sum / ImMax(1.0f, area_vtx); // Mean difference per covered pixel
+        printf("%-24s %10.1f %10.1f %10.1f %8.3f %8.4f\n", test.Name, test.Area, area_vtx, area_shape, diff_max, diff_mean);
+        CHECK(shapes_count == 1);
+        CHECK(diff_max <= 0.3f);
+        CHECK(fabsf(area_shape - test.Area) <= ImMax(fabsf(area_vtx - test.Area), test.Area * 0.01f) + 1.0f);
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    printf("test_shape_instances: %d shapes: %s\n", IM_ARRAYSIZE(g_Cases), g_Fails ? "FAILED" : "OK");
+    return g_Fails ? 1 : 0;
+}
@@ -0,0 +1,256 @@
+// Dear ImGui: TableSimpleCells() test and benchmark (see tests/run_tests.sh)
+// - TableSimpleCells() must produce the same draw data, content size, scroll limits, row background counter and auto-fit widths
+//   as TableNextColumn() + TextUnformatted() for each cell, on various table configurations and scroll positions.
+//   (ImGuiTableFlags_NoClip tables are not compared: all their cells share a draw channel, and submission order differs)
+// - The backgrounds of rows with and without cells, frozen or not, must share the same draw command, whose clip rectangle contains them.
+// - Benchmark: 100000 rows x 12 columns, scrolling to pseudo-random positions. Timings are printed, not checked.
+//   Run alone with ./run_tests.sh test_table_simple_cells (built with -O2 by default).
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+static int g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+static double GetTime() { return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+static const char* GetCellText(void*, int row, int column, char* buf, int buf_size)
+{
+    if (column == 3 && row % 5 == 0)
+        return ""; // Empty cells
+    if (column == 0)
+        snprintf(buf, buf_size, "%d", row);
+    else
+        snprintf(buf, buf_size, "%d.%02d%s", (row * 7 + column * 13) % 1000, (row + column) % 100, (row % 97 == 0) ? " wider text here" : "");
+    return buf;
+}
+
+struct TableConfig
+{
+    ImGuiTableFlags Flags;
+    int             ColumnsCount;
+    int             FreezeColumns, FreezeRows;
+    bool            Headers;
+    int             RowsCount;
+    float           Height;
+};
+
+struct TableResult
+{
+    std::vector<ImDrawVert> Vertices;   // Resolved vertices of the whole frame
+    std::vector<ImVec4>     ClipRects;  // Clip rectangle of each vertex
+    ImVec2                  ContentSize;
+    ImVec2                  ScrollMax;
+    int                     RowBgColorCounter;
+    std::vector<float>      WidthAuto;
+};
+
+enum SubmitMode { SubmitMode_Regular, SubmitMode_SimpleCells };
+
+static void SubmitTable(const TableConfig& cfg, SubmitMode mode, float scroll_y, TableResult* out_result)
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(1200, 1070));
+    ImGui::Begin("Window", NULL, ImGuiWindowFlags_NoSavedSettings);
+    if (ImGui::BeginTable("table", cfg.ColumnsCount, cfg.Flags, ImVec2(0.0f, cfg.Height)))
+    {
+        ImGui::TableSetupScrollFreeze(cfg.FreezeColumns, cfg.FreezeRows);
+        for (int column = 0; column < cfg.ColumnsCount; column++)
+            ImGui::TableSetupColumn(column == 0 ? "Row" : "Value");
+        if (cfg.Headers)
+            ImGui::TableHeadersRow();
+        ImGui::SetScrollY(scroll_y);
+        ImGui::SetScrollX(scroll_y * 0.3f);
+        if (mode == SubmitMode_SimpleCells)
+        {
+            ImGui::TableSimpleCells(0, cfg.RowsCount, GetCellText, NULL);
+        }
+        else
+        {
+            // Explicit row height: a measuring clipper would submit row 0 in full, affecting auto-fit widths
+            char buf[64];
+            const float row_height = ImGui::GetFontSize() + ImGui::GetStyle().CellPadding.y * 2.0f;
+            ImGuiListClipper clipper;
+            clipper.Begin(cfg.RowsCount, row_height);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow(0, row_height);
+                    for (int column = 0; column < cfg.ColumnsCount; column++)
+                        if (ImGui::TableSetColumnIndex(column))
+                            ImGui::TextUnformatted(GetCellText(NULL, row, column, buf, IM_ARRAYSIZE(buf)));
+                }
+        }
+        ImGuiTable* table = ImGui::GetCurrentTable();
+        ImGuiWindow* inner_window = ImGui::GetCurrentWindow();
+        if (out_result)
+        {
+            out_result->RowBgColorCounter = table->RowBgColorCounter;
+            for (int column = 0; column < cfg.ColumnsCount; column++)
+                out_result->WidthAuto.push_back(table->Columns[column].WidthAuto);
+        }
+        ImGui::EndTable();
+        if (out_result)
+        {
+            out_result->ContentSize = inner_window->ContentSize;
+            out_result->ScrollMax = inner_window->ScrollMax;
+        }
+    }
+    ImGui::End();
+}
+
+static void ResolveDrawData(const ImDrawData* draw_data, TableResult* out_result)
+{
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+            for (unsigned int n = 0; n < cmd.ElemCount && !cmd.QuadInstances; n++)
+            {
+                out_result->Vertices.push_back(draw_list->VtxBuffer[cmd.VtxOffset + draw_list->IdxBuffer[cmd.IdxOffset + n]]);
+                out_result->ClipRects.push_back(cmd.ClipRect);
+            }
+}
+
+static void NewContext()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* pixels; int w, h;
+    io.Fonts->GetTexDataAsAlpha8(&pixels, &w, &h);
+}
+
+static void TestEquivalence()
+{
+    const ImGuiTableFlags base_flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersV | ImGuiTableFlags_BordersOuter;
+    const TableConfig configs[] =
+    {
+        { base_flags | ImGuiTableFlags_Resizable, 12, 0, 1, true, 100000, 500.0f },
+        { base_flags, 12, 0, 1, true, 100000, 500.0f },                                                                    // Auto-fit columns
+        { base_flags | ImGuiTableFlags_ScrollX, 12, 2, 3, true, 1000, 500.0f },                                            // Frozen data rows
+        { base_flags | ImGuiTableFlags_ScrollX | ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersInnerH, 40, 1, 0, false, 5000, 500.0f },
+        { ImGuiTableFlags_Borders, 5, 0, 0, true, 30, 0.0f },                                                               // Not scrolling
+    };
+    const float scroll_positions[] = { 0.0f, 17.0f, 2000.0f, 35000.0f, 1e7f };
+    int compared_count = 0;
+    for (const TableConfig& cfg : configs)
+        for (float scroll_y : scroll_positions)
+        {
+            TableResult results[2];
+            for (int mode = 0; mode < 2; mode++)
+            {
+                NewContext();
+                for (int frame = 0; frame < 6; frame++)
+                {
+                    ImGui::NewFrame();
+                    results[mode] = TableResult();
+                    SubmitTable(cfg, (SubmitMode)mode, scroll_y, &results[mode]);
+                    ImGui::Render();
+                }
+                ResolveDrawData(ImGui::GetDrawData(), &results[mode]);
+                ImGui::DestroyContext();
+            }
+            const TableResult& a = results[0];
+            const TableResult& b = results[1];
+            CHECK(a.Vertices.size() == b.Vertices.size() && a.Vertices.size() > 0);
+            CHECK(a.Vertices.size() == b.Vertices.size() && memcmp(a.Vertices.data(), b.Vertices.data(), a.Vertices.size() * sizeof(ImDrawVert)) == 0);
+            CHECK(a.ClipRects.size() == b.ClipRects.size() && memcmp(a.ClipRects.data(), b.ClipRects.data(), a.ClipRects.size() * sizeof(ImVec4)) == 0);
+            CHECK(a.ContentSize.x == b.ContentSize.x && a.ContentSize.y == b.ContentSize.y);
+            CHECK(a.ScrollMax.x == b.ScrollMax.x && a.ScrollMax.y == b.ScrollMax.y);
+            CHECK(a.RowBgColorCounter == b.RowBgColorCounter);
+            CHECK(a.WidthAuto == b.WidthAuto);
+            compared_count++;
+        }
+    printf("test_table_simple_cells: %d configurations compared to TableNextColumn() + TextUnformatted()\n", compared_count);
+}
+
+// Rows submitted with TableNextRow() and no cell, some of them frozen: each row background must be inside its command clip rectangle.
+static void TestRowsWithoutCells()
+{
+    NewContext();
+    for (int frame = 0; frame < 3; frame++)
+    {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(500, 400));
+        ImGui::Begin("Window", NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::PushStyleColor(ImGuiCol_TableRowBg, IM_COL32(255, 0, 0, 255));
+        ImGui::PushStyleColor(ImGuiCol_TableRowBgAlt, IM_COL32(255, 0, 0, 255));
+        if (ImGui::BeginTable("table", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY, ImVec2(0, 250)))
+        {
+            ImGui::TableSetupScrollFreeze(0, 2);
+            for (int row = 0; row < 8; row++)
+            {
+                ImGui::TableNextRow(0, 20.0f);
+                if (row % 3 == 2)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("Cell %d", row);
+                }
+            }
+            ImGui::EndTable(); // Also ends the last row
+        }
+        ImGui::PopStyleColor(2);
+        ImGui::End();
+        ImGui::Render();
+    }
+    int row_bg_count = 0;
+    const ImDrawCmd* row_bg_cmd = NULL;
+    for (const ImDrawList* draw_list : ImGui::GetDrawData()->CmdLists)
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+            for (unsigned int n = 0; n < cmd.ElemCount; n += 6)
+            {
+                const ImDrawVert& v0 = draw_list->VtxBuffer[cmd.VtxOffset + draw_list->IdxBuffer[cmd.IdxOffset + n]];
+                const ImDrawVert& v2 = draw_list->VtxBuffer[cmd.VtxOffset + draw_list->IdxBuffer[cmd.IdxOffset + n + 2]];
+                if (v0.col != IM_COL32(255, 0, 0, 255))
+                    continue;
+                CHECK(ImMin(v0.pos.y, v2.pos.y) >= cmd.ClipRect.y && ImMax(v0.pos.y, v2.pos.y) <= cmd.ClipRect.w); // Already clipped by the CPU
+                CHECK(row_bg_cmd == NULL || row_bg_cmd == &cmd);
+                row_bg_cmd = &cmd;
+                row_bg_count++;
+            }
+    CHECK(row_bg_count == 8);
+    ImGui::DestroyContext();
+    printf("test_table_simple_cells: %d row backgrounds of rows with and without cells checked\n", row_bg_count);
+}
+
+static void Benchmark()
+{
+    NewContext();
+    const TableConfig cfg = { ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable, 12, 0, 1, true, 100000, 0.0f };
+    const float heights[] = { 300.0f, 1000.0f };
+    const char* mode_names[] = { "TableNextColumn() + TextUnformatted()", "TableSimpleCells()" };
+    const int frames_count = 500;
+    for (float height : heights)
+        for (int mode = 0; mode < 2; mode++)
+        {
+            TableConfig bench_cfg = cfg;
+            bench_cfg.Height = height;
+            double t0 = 0.0;
+            for (int frame = -50; frame < frames_count; frame++) // 50 warm-up frames
+            {
+                if (frame == 0)
+                    t0 = GetTime();
+                ImGui::NewFrame();
+                SubmitTable(bench_cfg, (SubmitMode)mode, (float)(((frame + 50) * 7919) % 100000) * 17.0f, NULL);
+                ImGui::Render();
+            }
+            printf("test_table_simple_cells: 100000x12, %4.0f px tall table, %-38s %7.1f us/frame\n", height, mode_names[mode], (GetTime() - t0) / frames_count * 1e6);
+        }
+    ImGui::DestroyContext();
+}
+
+int main()
+{
+    TestEquivalence();
+    TestRowsWithoutCells();
+    Benchmark();
+    printf("test_table_simple_cells: %s\n", g_Fails ? "FAILED" : "OK");
+    return g_Fails ? 1 : 0;
+}
@@ -0,0 +1,115 @@
+// Dear ImGui: ImGuiTextMeasureCache test (see tests/run_tests.sh)
+// - Two texts of same length with colliding keys must each measure as their own text (source text is compared on lookup).
+// - Cached sizes of wrapped and unwrapped text must match ImFont::CalcTextSizeA() over several frames, across evictions.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static int g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+static ImVec2 CalcTextSizeRef(const char* text, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImVec2 size = g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, wrap_width, text, NULL, NULL);
+    size.x = IM_TRUNC(size.x + 0.99999f);
+    return size;
+}
+
+static bool SizeEquals(const ImVec2& a, const ImVec2& b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+// Build a pseudo-random multi-line text from a seed (the default font is monospace: line breaks are what make sizes differ).
+static std::string MakeText(unsigned int seed, int len)
+{
+    const char glyphs[] = "abcdefgh\n\n\n\n\n\n\n\n";
+    unsigned long long state = seed;
+    std::string s;
+    for (int n = 0; n < len; n++)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        s += glyphs[(state >> 60) & 15];
+    }
+    return s;
+}
+
+// Same key as TextMeasureCacheLookup()
+static ImGuiID CacheKey(const std::string& text, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    struct { ImFont* Font; float FontSize; float WrapWidth; } key_data = { g.Font, g.FontSize, wrap_width };
+    return ImHashData(text.data(), text.size(), ImHashData(&key_data, sizeof(key_data)));
+}
+
+int main()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 720);
+    unsigned char* pixels; int w, h;
+    io.Fonts->GetTexDataAsAlpha8(&pixels, &w, &h);
+    ImGui::NewFrame();
+    ImGui::EndFrame();
+    ImGui::NewFrame();
+
+    // Find two texts with colliding keys and different sizes (birthday search, expect ~100K texts)
+    const int len = 16;
+    std::string text_a, text_b;
+    std::unordered_map<ImGuiID, unsigned int> seen;
+    for (unsigned int seed = 1; seed < 10000000 && text_a.empty(); seed++)
+    {
+        std::string text = MakeText(seed, len);
+        std::unordered_map<ImGuiID, unsigned int>::iterator it = seen.find(CacheKey(text, -1.0f));
+        if (it == seen.end())
+            seen[CacheKey(text, -1.0f)] = seed;
+        else if (!SizeEquals(CalcTextSizeRef(text.c_str(), -1.0f), CalcTextSizeRef(MakeText(it->second, len).c_str(), -1.0f)))
+            text_a = MakeText(it->second, len), text_b = text;
+    }
+    seen.clear();
+    CHECK(!text_a.empty());
+    const ImGuiID collision_key = CacheKey(text_a, -1.0f);
+
+    // Wrapped and unwrapped texts, more than Capacity so some get evicted
+    std::vector<std::string> texts;
+    for (int n = 0; n < 1500; n++)
+        texts.push_back(std::string("Item ") + std::to_string(n) + ((n % 3) ? "" : " with a longer description which will wrap\nover a few lines"));
+
+    ImGuiTextMeasureCache* cache = &GImGui->TextMeasureCache;
+    for (int frame = 0; frame < 8; frame++)
+    {
+        // Text A gets admitted, then text B must not be answered with the size of text A
+        CHECK(SizeEquals(ImGui::CalcTextSize(text_a.c_str()), CalcTextSizeRef(text_a.c_str(), -1.0f)));
+        CHECK(SizeEquals(ImGui::CalcTextSize(text_b.c_str()), CalcTextSizeRef(text_b.c_str(), -1.0f)));
+
+        const int first = (frame < 4) ? 0 : 500; // Stop using the first 500 texts halfway
+        for (int n = first; n < (int)texts.size(); n++)
+        {
+            const float wrap_width = (n % 2) ? 60.0f : -1.0f;
+            ImVec2 size = ImGui::CalcTextSize(texts[n].c_str(), NULL, false, wrap_width);
+            ImVec2 size_ref = CalcTextSizeRef(texts[n].c_str(), wrap_width);
+            CHECK(SizeEquals(size, size_ref));
+        }
+        ImGui::EndFrame();
+        ImGui::NewFrame();
+    }
+    CHECK(cache->StatEvictions > 0);
+    int text_len_total = 0;
+    for (const ImGuiTextMeasureCacheEntry& entry : cache->Entries)
+        text_len_total += entry.TextLen;
+    CHECK(text_len_total == cache->TextBuf.Size);
+    const int evictions = cache->StatEvictions;
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    printf("test_text_measure_cache: colliding texts of %d bytes (key 0x%08X), %d evictions: %s\n", len, collision_key, evictions, g_Fails ? "FAILED" : "OK");
+    return g_Fails ? 1 : 0;
+}
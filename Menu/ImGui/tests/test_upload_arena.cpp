@@ -0,0 +1,148 @@
+// Dear ImGui: ImDrawUploadArena test (see tests/run_tests.sh)
+// - Emulates a backend with 3 arena regions (one per frame in flight), poisoning each region when it is recycled.
+// - Draw data resolved through GetOffset() must match rendering without an arena.
+// - A draw list built once on GetDrawListSharedData() and kept must stay intact after 3+1 frames, and never use the arena.
+// - A window skipping refresh must still render its last contents after 3+1 frames.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static const int        REGIONS = 3;
+static ImDrawUploadArena g_Arena;
+static std::vector<char> g_ArenaMem;
+static int              g_Fails = 0;
+
+#define CHECK(EXPR) do { if (!(EXPR)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #EXPR); g_Fails++; } } while (0)
+
+static void BackendNewFrame(int frame)
+{
+    const size_t region_size = g_ArenaMem.size() / REGIONS;
+    const int region = frame % REGIONS;
+    g_Arena.FrameBegin = region_size * region;
+    g_Arena.FrameEnd = region_size * (region + 1);
+    memset((char*)g_Arena.Data + g_Arena.FrameBegin, 0xCD, region_size); // GPU is done with this region
+}
+
+// Serialize draw data the way a backend sees it: buffers in the arena are read through their offset.
+static std::string SerializeList(const ImDrawList* dl, bool* out_in_arena = NULL)
+{
+    const ImDrawVert* vtx = dl->VtxBuffer.Data;
+    const ImDrawIdx* idx = dl->IdxBuffer.Data;
+    ImS64 vtx_offset = g_Arena.Data ? g_Arena.GetOffset(vtx) : -1;
+    ImS64 idx_offset = g_Arena.Data ? g_Arena.GetOffset(idx) : -1;
+    if (vtx_offset >= 0)
+        vtx = (const ImDrawVert*)(const void*)((const char*)g_Arena.Data + vtx_offset);
+    if (idx_offset >= 0)
+        idx = (const ImDrawIdx*)(const void*)((const char*)g_Arena.Data + idx_offset);
+    if (out_in_arena)
+        *out_in_arena = (vtx_offset >= 0);
+    std::string s;
+    for (const ImDrawCmd& cmd : dl->CmdBuffer)
+    {
+        s.append((const char*)&cmd.ClipRect, sizeof(cmd.ClipRect));
+        s.append((const char*)&cmd.ElemCount, sizeof(cmd.ElemCount));
+    }
+    s.append((const char*)vtx, (size_t)dl->VtxBuffer.Size * sizeof(ImDrawVert));
+    s.append((const char*)idx, (size_t)dl->IdxBuffer.Size * sizeof(ImDrawIdx));
+    return s;
+}
+
+struct RunResult
+{
+    std::vector<std::string> Frames;
+    int ListsInArena = 0;
+};
+
+static RunResult Run(bool use_arena, int frames_count)
+{
+    RunResult res;
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 720);
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    unsigned char* pixels; int w, h;
+    io.Fonts->GetTexDataAsAlpha8(&pixels, &w, &h);
+    g_Arena = ImDrawUploadArena();
+    if (use_arena)
+    {
+        g_ArenaMem.assign(REGIONS * 1024 * 1024, 0);
+        g_Arena.Data = g_ArenaMem.data();
+        g_Arena.Size = g_ArenaMem.size();
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasUploadArena;
+        ImGui::GetPlatformIO().Renderer_UploadArena = &g_Arena;
+    }
+
+    ImDrawList* retained = NULL;
+    std::string retained_ref;
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        if (use_arena)
+            BackendNewFrame(frame);
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui::NewFrame();
+
+        // Retained draw list, built once
+        if (frame == 0)
+        {
+            retained = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+            retained->_ResetForNewFrame();
+            retained->PushTextureID(io.Fonts->TexID);
+            retained->PushClipRectFullScreen();
+            for (int i = 0; i < 100; i++)
+                retained->AddRectFilled(ImVec2(i * 2.0f, 0.0f), ImVec2(i * 2.0f + 1.0f, 10.0f), IM_COL32(i, 255, 0, 255));
+            retained->AddText(ImVec2(10, 20), IM_COL32_WHITE, "Retained");
+            retained_ref = SerializeList(retained);
+        }
+
+        // Window skipping refresh after its first frames
+        ImGui::SetNextWindowPos(ImVec2(10, 10));
+        ImGui::SetNextWindowSize(ImVec2(300, 300));
+        if (frame >= 2)
+            ImGui::SetNextWindowRefreshPolicy(ImGuiWindowRefreshFlags_TryToAvoidRefresh);
+        ImGui::Begin("Skip Refresh");
+        if (!ImGui::GetCurrentWindow()->SkipRefresh)
+            for (int i = 0; i < 20; i++)
+                ImGui::Text("Line %d", i);
+        ImGui::End();
+
+        ImGui::ShowDemoWindow();
+        ImGui::Render();
+
+        std::string s;
+        for (const ImDrawList* dl : ImGui::GetDrawData()->CmdLists)
+        {
+            bool in_arena = false;
+            s += SerializeList(dl, &in_arena);
+            res.ListsInArena += in_arena;
+        }
+        res.Frames.push_back(s);
+
+        // Retained draw list must never use the arena, and must stay intact
+        CHECK(g_Arena.Data == NULL || g_Arena.GetOffset(retained->VtxBuffer.Data) < 0);
+        CHECK(SerializeList(retained) == retained_ref);
+    }
+    IM_DELETE(retained);
+    ImGui::DestroyContext();
+    return res;
+}
+
+int main()
+{
+    const int frames_count = REGIONS + 1 + 4;
+    RunResult ref = Run(false, frames_count);
+    RunResult arena = Run(true, frames_count);
+    for (int frame = 0; frame < frames_count; frame++)
+        if (ref.Frames[frame] != arena.Frames[frame])
+        {
+            printf("FAIL: frame %d differs from rendering without arena\n", frame);
+            g_Fails++;
+        }
+    CHECK(arena.ListsInArena > 0);
+    printf("test_upload_arena: %d frames, %d draw lists read from arena: %s\n", frames_count, arena.ListsInArena, g_Fails ? "FAILED" : "OK");
+    return g_Fails ? 1 : 0;
+}
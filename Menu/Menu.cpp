@@ -34,6 +34,12 @@ std::vector<VkImage> g_SwapChainImages;
 std::vector<VkFramebuffer> g_Framebuffers;
 std::vector<VkImageView> g_SwapChainImageViews;
 
+// Define to keep ImGui allocations in their own pages instead of scattering them across the game's heap
+//#define MENU_USE_IMGUI_POOL_ALLOCATOR
+#ifdef MENU_USE_IMGUI_POOL_ALLOCATOR
+static ImGuiPoolAllocator g_ImGuiAllocator;
+#endif
+
 bool g_ImGuiInitialized = false;
 bool g_InitInProgress = false;
 static bool g_InSubmit = false;
@@ -300,6 +306,9 @@ bool initializeImGui() {
     if (!createDescriptorPool()) return false;
 
     IMGUI_CHECKVERSION();
+#ifdef MENU_USE_IMGUI_POOL_ALLOCATOR
+    ImGui::SetAllocatorFunctions(ImGuiPoolAllocator::AllocFunc, ImGuiPoolAllocator::FreeFunc, &g_ImGuiAllocator);
+#endif
     ImGui::CreateContext();
     
     ImGuiIO& io = ImGui::GetIO();
@@ -367,7 +376,7 @@ void DesignAndDrawMenu() {
     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
     ImGui::Text("Menu Test");
     
-    if (ImGui::Button("Test Button", ImVec2(280, 40))) {
+    if (ImGui::Button(IM_LABEL("Test Button"), ImVec2(280, 40))) {
         LOGD("Button clicked!");
     }
 